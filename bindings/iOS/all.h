@@ -109,6 +109,7 @@
 #import <VerovioFramework/git_commit.h>
 #import <VerovioFramework/gliss.h>
 #import <VerovioFramework/glyph.h>
+#import <VerovioFramework/glyphmetrictable.h>
 #import <VerovioFramework/gracegrp.h>
 #import <VerovioFramework/graphic.h>
 #import <VerovioFramework/grpsym.h>
@@ -126,6 +127,7 @@
 #import <VerovioFramework/iomei.h>
 #import <VerovioFramework/iomusxml.h>
 #import <VerovioFramework/iopae.h>
+#import <VerovioFramework/jsonwriter.h>
 #import <VerovioFramework/jsonxx.h>
 #import <VerovioFramework/justifyfunctor.h>
 #import <VerovioFramework/keyaccid.h>
@@ -181,6 +183,7 @@
 #import <VerovioFramework/plistinterface.h>
 #import <VerovioFramework/positioninterface.h>
 #import <VerovioFramework/preparedatafunctor.h>
+#import <VerovioFramework/profiler.h>
 #import <VerovioFramework/proport.h>
 #import <VerovioFramework/rdg.h>
 #import <VerovioFramework/ref.h>
@@ -229,6 +232,7 @@
 #import <VerovioFramework/textdirinterface.h>
 #import <VerovioFramework/textelement.h>
 #import <VerovioFramework/textlayoutelement.h>
+#import <VerovioFramework/threadpool.h>
 #import <VerovioFramework/tie.h>
 #import <VerovioFramework/timeinterface.h>
 #import <VerovioFramework/timemap.h>
@@ -237,6 +241,7 @@
 #import <VerovioFramework/toolkitdef.h>
 #import <VerovioFramework/transposefunctor.h>
 #import <VerovioFramework/transposition.h>
+#import <VerovioFramework/traversalindex.h>
 #import <VerovioFramework/trill.h>
 #import <VerovioFramework/tuning.h>
 #import <VerovioFramework/tuplet.h>
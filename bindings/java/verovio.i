@@ -18,6 +18,7 @@
 %ignore vrv::Toolkit::ResetLogBuffer( );
 %ignore vrv::Toolkit::SetShowBoundingBoxes( bool );
 %ignore vrv::Toolkit::SetCString( const std::string & );
+%ignore vrv::Toolkit::LoadDataBuffer( char *, size_t );
 
 %module verovio
 %include "std_string.i"
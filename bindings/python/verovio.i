@@ -18,6 +18,14 @@
 %ignore vrv::Toolkit::ResetLogBuffer( );
 %ignore vrv::Toolkit::SetShowBoundingBoxes( bool );
 %ignore vrv::Toolkit::SetCString( const std::string & );
+%ignore vrv::Toolkit::LoadDataBuffer( char *, size_t );
+%ignore vrv::Toolkit::SetCBuffer( std::vector<unsigned char> );
+%ignore vrv::Toolkit::GetCBuffer( int * );
+
+// Binary buffers are returned as bytes
+%typemap(out) std::vector<unsigned char> {
+    $result = PyBytes_FromStringAndSize(reinterpret_cast<const char *>($1.data()), $1.size());
+}
 
 %feature("autodoc", "1");
 
@@ -27,6 +35,15 @@
     from typing import Optional, Union
 %}
 
+// Toolkit::ConvertCollection
+%feature("shadow") vrv::Toolkit::ConvertCollection(const std::string &, const std::string & = "") %{
+def convertCollection(toolkit, data: str, options: Optional[dict] = None) -> list:
+    """Convert a collection of tunes or segments in parallel."""
+    if options is None:
+        options = {}
+    return json.loads($action(toolkit, data, json.dumps(options)))
+%}
+
 // Toolkit::Edit
 %feature("shadow") vrv::Toolkit::Edit( const std::string & ) %{
 def edit(toolkit, editor_action: dict) -> bool:
@@ -108,6 +125,13 @@ def getOptions(toolkit) -> dict:
     return json.loads($action(toolkit))
 %}
 
+// Toolkit::GetProfile
+%feature("shadow") vrv::Toolkit::GetProfile() const %{
+def getProfile(toolkit) -> dict:
+    """Return the time spent in the processing stages since the data was loaded."""
+    return json.loads($action(toolkit))
+%}
+
 // Toolkit::GetTimesForElement
 %feature("shadow") vrv::Toolkit::GetTimesForElement(const std::string &) %{
 def getTimesForElement(toolkit, xml_id: str) -> dict:
@@ -131,6 +155,20 @@ def renderData(toolkit, data, options: dict) -> str:
     return $action(toolkit, data, json.dumps(options))
 %}
 
+// Toolkit::RenderExcerptToSVG
+%feature("shadow") vrv::Toolkit::RenderExcerptToSVG(const std::string &, int = 1) %{
+def renderExcerptToSVG(toolkit, selection: dict, page_no: int = 1) -> str:
+    """Render a page of an excerpt of the document to SVG."""
+    return $action(toolkit, json.dumps(selection), page_no)
+%}
+
+// Toolkit::RenderExcerptsToSVG
+%feature("shadow") vrv::Toolkit::RenderExcerptsToSVG(const std::string &) %{
+def renderExcerptsToSVG(toolkit, options: dict) -> list:
+    """Render several excerpts of the document to SVG."""
+    return json.loads($action(toolkit, json.dumps(options)))
+%}
+
 // Toolkit::RenderToExpansionMap
 %feature("shadow") vrv::Toolkit::RenderToExpansionMap() %{
 def renderToExpansionMap(toolkit) -> list:
@@ -145,6 +183,15 @@ def renderToExpansionMapFile(toolkit, filename: str) -> bool:
     return $action(toolkit, filename)
 %}
 
+// Toolkit::RenderToSVGTiles
+%feature("shadow") vrv::Toolkit::RenderToSVGTiles(int, const std::string & = "") %{
+def renderToSVGTiles(toolkit, page_no: int, options: Optional[dict] = None) -> dict:
+    """Render a page to SVG tiles that can be displayed independently."""
+    if options is None:
+        options = {}
+    return json.loads($action(toolkit, page_no, json.dumps(options)))
+%}
+
 // Toolkit::RenderToTimemap
 %feature("shadow") vrv::Toolkit::RenderToTimemap(const std::string & = "") %{
 def renderToTimemap(toolkit, options: Optional[dict] = None) -> list:
@@ -154,6 +201,15 @@ def renderToTimemap(toolkit, options: Optional[dict] = None) -> list:
     return json.loads($action(toolkit, json.dumps(options)))
 %}
 
+// Toolkit::RenderToTimemapBuffer
+%feature("shadow") vrv::Toolkit::RenderToTimemapBuffer(const std::string & = "") %{
+def renderToTimemapBuffer(toolkit, options: Optional[dict] = None) -> bytes:
+    """Render a document to a columnar binary timemap."""
+    if options is None:
+        options = {}
+    return $action(toolkit, json.dumps(options))
+%}
+
 // Toolkit::RenderToTimemapFile
 %feature("shadow") vrv::Toolkit::RenderToTimemapFile(const std::string &, const std::string & = "") %{
 def renderToTimemapFile(toolkit, filename: str, options: Optional[dict] = None) -> bool:
@@ -0,0 +1,21 @@
+#!/bin/sh
+
+# Check that MEI files are loaded in the same way with and without --mei-stream
+
+dir="./tests/mei-stream/"
+tmp=`mktemp -d`
+status=0
+
+for k in `\ls $dir/*.mei`; do
+    l=${k##*/}
+    echo $k
+    ../tools/verovio -r ../data/ -x 1 -t mei -o $tmp/$l $k
+    ../tools/verovio -r ../data/ -x 1 -t mei -o $tmp/stream_$l --mei-stream $k
+    if ! diff -q $tmp/$l $tmp/stream_$l > /dev/null; then
+        echo "Output differs for $l"
+        status=1
+    fi
+done
+
+rm -rf $tmp
+exit $status
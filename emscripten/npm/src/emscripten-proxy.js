@@ -48,6 +48,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *convertMEIToHumdrum(Toolkit *ic, const char *meiData)
     mapping.convertMEIToHumdrum = VerovioModule.cwrap("vrvToolkit_convertMEIToHumdrum", "string", ["number", "string"]);
 
+    // char *convertCollection(Toolkit *ic, const char *data, const char *options)
+    mapping.convertCollection = VerovioModule.cwrap("vrvToolkit_convertCollection", "string", ["number", "string", "string"]);
+
     // char *convertHumdrumToHumdrum(Toolkit *ic, const char *humdrumData)
     mapping.convertHumdrumToHumdrum = VerovioModule.cwrap("vrvToolkit_convertHumdrumToHumdrum", "string", ["number", "string"]);
 
@@ -72,6 +75,9 @@ function getToolkitFunction(VerovioModule, method) {
     // int getPageWithElement(Toolkit *ic, const char *xmlId)
     mapping.getPageWithElement = VerovioModule.cwrap("vrvToolkit_getPageWithElement", "number", ["number", "string"]);
 
+    // char *getProfile(Toolkit *ic)
+    mapping.getProfile = VerovioModule.cwrap("vrvToolkit_getProfile", "string", ["number"]);
+
     // double getTimeForElement(Toolkit *ic, const char *xmlId)
     mapping.getTimeForElement = VerovioModule.cwrap("vrvToolkit_getTimeForElement", "number", ["number", "string"]);
 
@@ -102,6 +108,12 @@ function getToolkitFunction(VerovioModule, method) {
     // char *renderData(Toolkit *ic, const char *data, const char *options)
     mapping.renderData = VerovioModule.cwrap("vrvToolkit_renderData", "string", ["number", "string", "string"]);
 
+    // char *renderExcerptToSVG(Toolkit *ic, const char *selection, int pageNo)
+    mapping.renderExcerptToSVG = VerovioModule.cwrap("vrvToolkit_renderExcerptToSVG", "string", ["number", "string", "number"]);
+
+    // char *renderExcerptsToSVG(Toolkit *ic, const char *options)
+    mapping.renderExcerptsToSVG = VerovioModule.cwrap("vrvToolkit_renderExcerptsToSVG", "string", ["number", "string"]);
+
     // char *renderToExpansionMap(Toolkit *ic)
     mapping.renderToExpansionMap = VerovioModule.cwrap("vrvToolkit_renderToExpansionMap", "string", ["number"]);
 
@@ -114,6 +126,12 @@ function getToolkitFunction(VerovioModule, method) {
     // char *renderToSvg(Toolkit *ic, int pageNo, int xmlDeclaration)
     mapping.renderToSVG = VerovioModule.cwrap("vrvToolkit_renderToSVG", "string", ["number", "number", "number"]);
 
+    // char *renderToSVGRegion(Toolkit *ic, int pageNo, int x, int y, int width, int height, int xmlDeclaration)
+    mapping.renderToSVGRegion = VerovioModule.cwrap("vrvToolkit_renderToSVGRegion", "string", ["number", "number", "number", "number", "number", "number", "number"]);
+
+    // char *renderToSVGTiles(Toolkit *ic, int pageNo, const char *options)
+    mapping.renderToSVGTiles = VerovioModule.cwrap("vrvToolkit_renderToSVGTiles", "string", ["number", "number", "string"]);
+
     // char *renderToTimemap(Toolkit *ic)
     mapping.renderToTimemap = VerovioModule.cwrap("vrvToolkit_renderToTimemap", "string", ["number", "string"]);
 
@@ -54,6 +54,10 @@ export class VerovioToolkit {
         return this.proxy.getHumdrum(this.ptr);
     }
 
+    convertCollection(data, options) {
+        return JSON.parse(this.proxy.convertCollection(this.ptr, data, JSON.stringify(options)));
+    }
+
     convertHumdrumToHumdrum(data) {
         return this.proxy.convertHumdrumToHumdrum(this.ptr, data);
     }
@@ -104,6 +108,10 @@ export class VerovioToolkit {
         return this.proxy.getPageWithElement(this.ptr, xmlId);
     }
 
+    getProfile() {
+        return JSON.parse(this.proxy.getProfile(this.ptr));
+    }
+
     getTimeForElement(xmlId) {
         return this.proxy.getTimeForElement(this.ptr, xmlId);
     }
@@ -150,6 +158,14 @@ export class VerovioToolkit {
         return this.proxy.renderData(this.ptr, data, JSON.stringify(options));
     }
 
+    renderExcerptToSVG(selection, pageNo = 1) {
+        return this.proxy.renderExcerptToSVG(this.ptr, JSON.stringify(selection), pageNo);
+    }
+
+    renderExcerptsToSVG(options = {}) {
+        return JSON.parse(this.proxy.renderExcerptsToSVG(this.ptr, JSON.stringify(options)));
+    }
+
     renderToExpansionMap() {
         return JSON.parse(this.proxy.renderToExpansionMap(this.ptr));
     }
@@ -166,6 +182,14 @@ export class VerovioToolkit {
         return this.proxy.renderToSVG(this.ptr, pageNo, xmlDeclaration);
     }
 
+    renderToSVGRegion(pageNo, x, y, width, height, xmlDeclaration = false) {
+        return this.proxy.renderToSVGRegion(this.ptr, pageNo, x, y, width, height, xmlDeclaration);
+    }
+
+    renderToSVGTiles(pageNo = 1, options = {}) {
+        return JSON.parse(this.proxy.renderToSVGTiles(this.ptr, pageNo, JSON.stringify(options)));
+    }
+
     renderToTimemap(options = {}) {
         return JSON.parse(this.proxy.renderToTimemap(this.ptr, JSON.stringify(options)));
     }
@@ -11,7 +11,9 @@
 #include "devicecontextbase.h"
 #include "expansionmap.h"
 #include "facsimile.h"
+#include "glyphmetrictable.h"
 #include "options.h"
+#include "profiler.h"
 #include "resources.h"
 #include "scoredef.h"
 
@@ -27,6 +29,8 @@ class Glyph;
 class Pages;
 class Page;
 class Score;
+class System;
+class ThreadPool;
 
 enum DocType { Raw = 0, Rendering, Transcription, Facs };
 
@@ -81,6 +85,14 @@ public:
     Resources &GetResourcesForModification() { return m_resources; }
     ///@}
 
+    /**
+     * Getter for the profiler recording the time spent in the processing stages
+     */
+    ///@{
+    Profiler &GetProfiler() { return m_profiler; }
+    const Profiler &GetProfiler() const { return m_profiler; }
+    ///@}
+
     /**
      * Generate a document scoreDef when none is provided.
      * This only looks at the content first system of the document.
@@ -176,6 +188,12 @@ public:
     double GetCueScaling() const;
     ///@}
 
+    /**
+     * Return the metrics of a glyph from the glyph metric table, or NULL if the glyph is not in it.
+     * The table is rebuilt if the font, the music font size or the grace factor have changed.
+     */
+    const GlyphMetrics *GetGlyphMetrics(char32_t code, bool graceSize) const;
+
     Point ConvertFontPoint(const Glyph *glyph, const Point &fontPoint, int staffSize, bool graceSize) const;
 
     /**
@@ -252,6 +270,11 @@ public:
      */
     bool ExportTimemap(std::string &output, bool includeRests, bool includeMeasures);
 
+    /**
+     * Extract a timemap from the document to a columnar binary buffer (see Timemap::ToBuffer).
+     */
+    bool ExportTimemapBuffer(std::vector<unsigned char> &output, bool includeRests, bool includeMeasures);
+
     /**
      *  Extract expansionMap from the document to JSON string.
      */
@@ -452,6 +475,18 @@ public:
     void ReactivateSelection(bool resetAligners);
     ///@}
 
+    /**
+     * @name Methods for managing an excerpt.
+     * The pages are detached and the content of the systems from the start to the end measure is moved to a single
+     * page to be cast off and laid out alone. It is moved back to its systems when the excerpt is reset, and the pages
+     * have to be laid out again.
+     */
+    ///@{
+    bool InitExcerptDoc(const std::string &start, const std::string &end);
+    void ResetExcerptDoc();
+    bool HasExcerpt() const { return !m_excerptPages.empty(); }
+    ///@}
+
     //----------//
     // Functors //
     //----------//
@@ -477,6 +512,24 @@ private:
      */
     void PrepareMeasureIndices();
 
+    /**
+     * Return the objects of each score of the pages for preparing the scores separately.
+     * The score milestones are replaced by their content and the score milestone ends are left out, because
+     * processing them sets the current score.
+     * The list is empty if the document does not have at least two scores.
+     */
+    std::vector<ArrayOfObjects> GetObjectsByScore();
+
+    /**
+     * Return the thread pool for preparing the scores separately, created the first time it is needed
+     */
+    ThreadPool *GetThreadPool();
+
+    /**
+     * Process the functor on each of the objects (in reverse order when the functor goes backward)
+     */
+    static void ProcessObjects(const ArrayOfObjects &objects, Functor &functor);
+
 public:
     Page *m_selectionPreceding;
     Page *m_selectionFollowing;
@@ -545,6 +598,11 @@ private:
      */
     Resources m_resources;
 
+    /**
+     * The profiler of the processing stages (loading, data preparation, layout and rendering).
+     */
+    Profiler m_profiler;
+
     /**
      * @name Holds a pointer to the current score/scoreDef.
      * Set by Doc::GetCurrentScoreDef or explicitly through Doc::SetCurrentScoreDef
@@ -558,6 +616,21 @@ private:
      */
     bool m_isCastOff;
 
+    /**
+     * @name The pages detached for an excerpt, the content of the excerpt with the system it comes from, and the
+     * cast-off flag of the document to be restored when the excerpt is reset.
+     */
+    ///@{
+    ArrayOfObjects m_excerptPages;
+    std::vector<std::pair<Object *, System *>> m_excerptContent;
+    bool m_excerptIsCastOff;
+    ///@}
+
+    /**
+     * The thread pool for preparing the scores separately (owned)
+     */
+    ThreadPool *m_threadPool;
+
     /*
      * The following values are set in the Doc::SetDrawingPage.
      * They are all current values to be used when drawing a page in a View and
@@ -588,6 +661,8 @@ private:
     FontInfo m_drawingLyricFont;
     /** Current fingering font */
     FontInfo m_fingeringFont;
+    /** The scaled metrics of the music font glyphs (rebuilt lazily from the const getters) */
+    mutable GlyphMetricTable m_glyphMetricTable;
 
     /**
      * A flag to indicate whether the currentScoreDef has been set or not.
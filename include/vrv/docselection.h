@@ -10,6 +10,10 @@
 
 #include <string>
 
+//----------------------------------------------------------------------------
+
+#include "vrvdef.h"
+
 namespace vrv {
 
 class Doc;
@@ -44,6 +48,13 @@ public:
      */
     void Set(Doc *doc);
 
+    /**
+     * Get the IDs of the first and last element of the selection.
+     * The measures of the document are used for a measureRange selection.
+     * Return false if the selection could not be resolved.
+     */
+    bool GetRangeIds(const ListOfObjects &measures, std::string &startId, std::string &endId) const;
+
 private:
     //
 public:
@@ -56,6 +56,11 @@ public:
     bool IsSupportedChild(Object *object) override;
     ///@}
 
+    /**
+     * Set the visibility and mark the element as modified, since the content visited by the functors changes.
+     */
+    void SetVisibility(VisibilityType visibility);
+
     //----------//
     // Functors //
     //----------//
@@ -77,6 +82,7 @@ public:
      * Holds the visibility (hidden or visible) for an editorial element.
      * By default, all editorial elements are visible. However, in an <app>, only one <rdg> is visible at the time. When
      * loading the file, the first <rdg> (or the <lem>) is made visible.
+     * Use SetVisibility for changing it once the element is in the tree.
      */
     VisibilityType m_visibility;
 
@@ -10,11 +10,13 @@
 
 //----------------------------------------------------------------------------
 
-#include "options.h"
+#include <list>
+#include <string>
+#include <vector>
 
 //----------------------------------------------------------------------------
 
-#include "jsonxx.h"
+#include "options.h"
 
 namespace vrv {
 
@@ -54,15 +56,15 @@ public:
      */
     std::list<const Note *> m_previousNotes;
 
-    jsonxx::Array m_pitchesChromatic;
-    jsonxx::Array m_pitchesDiatonic;
-    jsonxx::Array m_pitchesIds;
+    std::vector<std::string> m_pitchesChromatic;
+    std::vector<std::string> m_pitchesDiatonic;
+    std::vector<std::vector<std::string>> m_pitchesIds;
 
-    jsonxx::Array m_intervalsChromatic;
-    jsonxx::Array m_intervalsDiatonic;
-    jsonxx::Array m_intervalGrossContour;
-    jsonxx::Array m_intervalRefinedContour;
-    jsonxx::Array m_intervalsIds;
+    std::vector<std::string> m_intervalsChromatic;
+    std::vector<std::string> m_intervalsDiatonic;
+    std::vector<std::string> m_intervalGrossContour;
+    std::vector<std::string> m_intervalRefinedContour;
+    std::vector<std::vector<std::string>> m_intervalsIds;
 
 private:
 };
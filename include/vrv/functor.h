@@ -8,6 +8,12 @@
 #ifndef __VRV_FUNCTOR_H__
 #define __VRV_FUNCTOR_H__
 
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+
+//----------------------------------------------------------------------------
+
 #include "comparison.h"
 #include "functorinterface.h"
 #include "vrvdef.h"
@@ -71,6 +77,24 @@ public:
     }
     ///@}
 
+    /**
+     * Getter/Setter for the classes visited by the functor
+     * When set, the subtrees without any object of these classes are not processed.
+     * It must include all the classes for which a Visit method is overridden, directly or through a base class.
+     * Scores and page milestone ends are always included since they update the current score of the document.
+     */
+    ///@{
+    bool HasVisitedClassIds() const { return m_visitedClassIds.any(); }
+    const ClassIdMask &GetVisitedClassIds() const { return m_visitedClassIds; }
+    void SetVisitedClassIds(std::initializer_list<ClassId> classIds)
+    {
+        m_visitedClassIds.reset();
+        for (ClassId classId : classIds) m_visitedClassIds.set(classId);
+        m_visitedClassIds.set(SCORE);
+        m_visitedClassIds.set(PAGE_MILESTONE_END);
+    }
+    ///@}
+
     /**
      * Return true if the functor implements the end interface
      */
@@ -83,6 +107,8 @@ public:
 private:
     // The functor code
     FunctorCode m_code = FUNCTOR_CONTINUE;
+    // The classes visited by the functor (none for all)
+    ClassIdMask m_visitedClassIds;
     // The filters
     Filters *m_filters = NULL;
     // Visible only flag
@@ -248,6 +274,60 @@ private:
     bool m_processingData = false;
 };
 
+//----------------------------------------------------------------------------
+// CompositeFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class groups several mutable functors for processing them in a single traversal.
+ * For each visited object, the functors are called in the order they were given and each of them keeps its own code,
+ * i.e., a functor returning FUNCTOR_SIBLINGS or FUNCTOR_STOP does not affect the others.
+ * The functors must be independent from each other and must process the tree forward without filters.
+ * See Object::Process(CompositeFunctor &, int)
+ */
+class CompositeFunctor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    CompositeFunctor(std::initializer_list<Functor *> functors) : m_functors(functors)
+    {
+        assert(m_functors.size() <= MAX_COMPOSITE_FUNCTORS);
+    }
+    virtual ~CompositeFunctor() = default;
+    ///@}
+
+    /**
+     * Getters for the grouped functors
+     */
+    ///@{
+    int GetFunctorCount() const { return (int)m_functors.size(); }
+    Functor *GetFunctor(int idx) const { return m_functors.at(idx); }
+    ///@}
+
+    /**
+     * Return a mask with a bit set for each grouped functor
+     */
+    uint32_t GetFullMask() const
+    {
+        return (m_functors.size() == MAX_COMPOSITE_FUNCTORS) ? UINT32_MAX : ((1u << m_functors.size()) - 1);
+    }
+
+    /**
+     * The maximum number of functors, since they are tracked with a 32-bit mask
+     */
+    static constexpr size_t MAX_COMPOSITE_FUNCTORS = 32;
+
+private:
+    //
+public:
+    //
+private:
+    // The grouped functors
+    std::vector<Functor *> m_functors;
+};
+
 } // namespace vrv
 
 #endif // __VRV_FUNCTOR_H__
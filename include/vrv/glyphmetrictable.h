@@ -0,0 +1,103 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        glyphmetrictable.h
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_GLYPHMETRICTABLE_H__
+#define __VRV_GLYPHMETRICTABLE_H__
+
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "resources.h"
+#include "vrvdef.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// GlyphMetrics
+//----------------------------------------------------------------------------
+
+/**
+ * The metrics of a SMuFL glyph scaled to the music font size (and to the grace size) for a staff size of 100.
+ */
+struct GlyphMetrics {
+    int m_x = 0;
+    int m_y = 0;
+    int m_width = 0;
+    int m_height = 0;
+    int m_advX = 0;
+    bool m_isSet = false;
+};
+
+//----------------------------------------------------------------------------
+// GlyphMetricTable
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds the scaled metrics of the glyphs of the private use area of the current SMuFL font.
+ * The metrics are stored contiguously for the normal and the grace sizes so that they can be looked up by code.
+ * The table is built for a font generation of the Resources, a music font size and a grace factor, and has to be
+ * rebuilt when one of them changes.
+ */
+class GlyphMetricTable {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    GlyphMetricTable();
+    virtual ~GlyphMetricTable() = default;
+    ///@}
+
+    /**
+     * Return true if the table was built for the resources font, the font size and the grace factor
+     */
+    bool IsUpToDate(const Resources &resources, int fontSize, double graceFactor) const
+    {
+        return ((m_fontGeneration == resources.GetFontGeneration()) && (m_fontSize == fontSize)
+            && (m_graceFactor == graceFactor));
+    }
+
+    /**
+     * Build the table for the resources font, the font size and the grace factor
+     */
+    void Build(const Resources &resources, int fontSize, double graceFactor);
+
+    /**
+     * Return the metrics of a glyph, or NULL if the code is not in the table
+     */
+    const GlyphMetrics *GetMetrics(char32_t code, bool graceSize) const
+    {
+        const uint32_t idx = (uint32_t)code - (uint32_t)k_firstCode;
+        if (idx >= m_codeCount) return NULL;
+        const GlyphMetrics &metrics = m_metrics[2 * idx + (graceSize ? 1 : 0)];
+        return (metrics.m_isSet) ? &metrics : NULL;
+    }
+
+private:
+    //
+public:
+    //
+private:
+    /** The first code of the table (the beginning of the private use area) */
+    static const char32_t k_firstCode = 0xE000;
+    /** The last code of the table (the end of the private use area) */
+    static const char32_t k_lastCode = 0xF8FF;
+
+    /** The metrics for each code, normal and grace size interleaved */
+    std::vector<GlyphMetrics> m_metrics;
+    /** The number of codes in the table */
+    uint32_t m_codeCount;
+    /** The values for which the table was built */
+    int m_fontGeneration;
+    int m_fontSize;
+    double m_graceFactor;
+};
+
+} // namespace vrv
+
+#endif // __VRV_GLYPHMETRICTABLE_H__
@@ -72,6 +72,12 @@ public:
     // read
     virtual bool Import(std::string const &data) { return true; }
 
+    /**
+     * Import from a buffer that can be modified during the import (e.g., for parsing it in place).
+     * The buffer is not used anymore once the import returns. By default the data is copied and passed to Import.
+     */
+    virtual bool ImportBuffer(char *data, size_t length) { return this->Import(std::string(data, length)); }
+
     /**
      * Getter for layoutInformation flag that is set to true during import
      * if layout information is found (and not to be ignored).
@@ -177,6 +177,23 @@ enum class MatchLocation { Before, Here, After };
 enum class RangeMatchLocation { BeforeStart, AtStart, BetweenStartEnd, AtEnd, AfterEnd };
 ///@}
 
+//----------------------------------------------------------------------------
+// MEIStringWriter
+//----------------------------------------------------------------------------
+
+/**
+ * This class appends the serialized MEI to a string without an intermediate stream.
+ */
+class MEIStringWriter : public pugi::xml_writer {
+public:
+    MEIStringWriter(std::string &output) : m_output(output) {}
+
+    void write(const void *data, size_t size) override { m_output.append(static_cast<const char *>(data), size); }
+
+private:
+    std::string &m_output;
+};
+
 //----------------------------------------------------------------------------
 // MEIOutput
 //----------------------------------------------------------------------------
@@ -196,8 +213,16 @@ public:
 
     /**
      * The main method for exporting the file to MEI.
+     * The MEI is serialized directly to the writer, e.g., a MEIStringWriter, a pugi::xml_writer_file or a custom
+     * writer passing the data to a callback. The elements are written and removed from the tree as soon as they are
+     * complete, so the tree of the whole document is never built.
+     */
+    bool Export(pugi::xml_writer &writer);
+
+    /**
+     * Build the MEI tree into the pugi document without serializing it.
      */
-    bool Export();
+    bool ExportDocument(pugi::xml_document &meiDoc);
 
     /**
      * The main method for writing objects.
@@ -208,7 +233,7 @@ public:
     ///@}
 
     /**
-     * Return the output as a string by writing it to the stringstream member.
+     * Return the output as a string.
      */
     std::string GetOutput();
 
@@ -302,6 +327,18 @@ private:
     void WriteStackedObjectsEnd();
     ///@}
 
+    /**
+     * @name Methods for streaming the tree while it is built.
+     * The nodes with a start tag written are kept in m_streamedNodes, from the document node. The output is the same
+     * as when saving the whole tree, since the nodes streamed never have text content.
+     */
+    ///@{
+    bool IsStreamableNode(pugi::xml_node node) const;
+    void StreamNode(pugi::xml_node node);
+    void StreamChildren(int level, pugi::xml_node until);
+    void StreamIndent(int depth);
+    ///@}
+
     /**
      * Scoredef manipulation
      */
@@ -556,7 +593,6 @@ private:
 public:
     //
 private:
-    std::ostringstream m_streamStringOutput;
     int m_indent;
     bool m_scoreBasedMEI;
     /** A flag indicating that we want to produce MEI basic */
@@ -590,6 +626,14 @@ private:
     bool m_ignoreHeader;
     bool m_removeIds;
     ListOfObjects m_referredObjects;
+
+    /** The writer when the tree is streamed, with the serialization parameters */
+    ///@{
+    pugi::xml_writer *m_streamWriter;
+    std::string m_streamIndent;
+    unsigned int m_streamFlags;
+    std::vector<pugi::xml_node> m_streamedNodes;
+    ///@}
 };
 
 //----------------------------------------------------------------------------
@@ -609,6 +653,26 @@ public:
 
     bool Import(const std::string &mei) override;
 
+    /**
+     * Import by parsing the buffer in place without copying it.
+     * The elements of the parsed tree are released as soon as they have been read.
+     */
+    bool ImportBuffer(char *data, size_t length) override;
+
+    /**
+     * Import from a seekable stream of MEI data.
+     * The stream is read by blocks and split into the position of each measure and the rest of the document.
+     * Each measure is read back from the stream and parsed only when it is built, so neither the tree nor the text of
+     * the whole document is kept. This is used by Toolkit::LoadFile only with the --mei-stream option.
+     */
+    bool ImportStream(std::istream &stream);
+
+    /**
+     * Import from an already parsed MEI tree.
+     * The first child of the document is expected to be the root element.
+     */
+    bool ImportDocument(const pugi::xml_document &document);
+
 private:
     bool ReadDoc(pugi::xml_node root);
     bool ReadIncipits(pugi::xml_node root);
@@ -856,6 +920,12 @@ private:
      */
     void ReadUnsupportedAttr(pugi::xml_node element, Object *object);
 
+    /**
+     * Read the attributes of several att classes in a single pass over the attributes of the element.
+     * Each attribute is offered to the att classes in the given order and removed once read.
+     */
+    template <class... ATTS, class ELEMENT> void ReadAttClasses(pugi::xml_node element, ELEMENT *object);
+
     /**
      * Returns true if the element is name is an editorial element (e.g., "app", "supplied", etc.)
      */
@@ -948,6 +1018,42 @@ private:
      */
     bool IsAllowed(std::string element, Object *filterParent);
 
+    /**
+     * Remove a node that has been read from the parsed tree if the tree is owned by the input
+     */
+    void ReleaseNode(pugi::xml_node node);
+
+    /**
+     * @name Methods for splitting a stream into measures
+     * The position of the markup ends is the one after the end, or std::string::npos when more data is needed.
+     */
+    ///@{
+    bool SplitStream(std::istream &stream, std::string &skeleton);
+    size_t FindMarkupEnd(const std::string &data, size_t pos) const;
+    size_t FindMeasureEnd(const std::string &data, size_t pos) const;
+    bool IsMeasureStart(const std::string &data, size_t pos) const;
+    bool IsMeasureEnd(const std::string &data, size_t pos) const;
+    ///@}
+
+    /**
+     * Read a measure split from the stream by reading and parsing its content
+     */
+    bool ReadMeasureChunk(Object *parent, pugi::xml_node measure);
+
+    /**
+     * A flag indicating that the nodes can be removed from the tree once read
+     */
+    bool m_releaseNodes;
+
+    /**
+     * @name The stream being imported, with its XML declaration and the offset and length of the measures split from it
+     */
+    ///@{
+    std::istream *m_stream;
+    std::string m_streamDeclaration;
+    std::vector<std::pair<std::streamoff, size_t>> m_measureChunks;
+    ///@}
+
     /**
      * The selected <mdiv>.
      * If not specified by --mdiv-x-path query, then it is the first <mdiv> in the body
@@ -8,10 +8,12 @@
 #ifndef __VRV_IOMUSXML_H__
 #define __VRV_IOMUSXML_H__
 
+#include <functional>
 #include <map>
 #include <optional>
 #include <queue>
 #include <string>
+#include <string_view>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -183,6 +185,15 @@ namespace musicxml {
         int m_layerNum = 0;
     };
 
+    struct MultipleRest {
+        // The first multiple-rest element
+        pugi::xml_node m_node;
+        // True if any of the multiple-rest elements has @use-symbols="yes"
+        bool m_useSymbols = false;
+    };
+
+    using NodePredicate = std::function<bool(pugi::xml_node)>;
+
 } // namespace musicxml
 
 #endif // NO_MUSICXML_SUPPORT
@@ -213,6 +224,21 @@ private:
      */
     bool ReadMusicXml(pugi::xml_node root);
 
+    /*
+     * Index the parts and their measures in one pass for avoiding XPath queries over the whole document
+     */
+    void IndexParts(pugi::xml_node root);
+
+    /*
+     * Return true if the node is within the first part
+     */
+    bool IsInFirstPart(pugi::xml_node node) const;
+
+    /*
+     * Index the measures of the section by @n for adding the clef changes and control elements
+     */
+    void IndexMeasures(Section *section);
+
     /*
      * Method to fill MEI header with title
      */
@@ -352,6 +378,20 @@ private:
     std::string GetContentOfChild(const pugi::xml_node node, const std::string &child) const;
     ///@}
 
+    /*
+     * @name Helper methods for finding elements along a path of child element names (e.g., "notations/tuplet"), with
+     * "*" for any element. They return the same nodes as the XPath query of the path, in document order, without
+     * evaluating it. The predicate filters the elements of the last step.
+     */
+    ///@{
+    pugi::xml_node FindChild(
+        const pugi::xml_node node, std::string_view path, const musicxml::NodePredicate &predicate = NULL) const;
+    std::vector<pugi::xml_node> FindChildren(
+        const pugi::xml_node node, std::string_view path, const musicxml::NodePredicate &predicate = NULL) const;
+    bool CollectChildren(const pugi::xml_node node, std::string_view path, const musicxml::NodePredicate &predicate,
+        std::vector<pugi::xml_node> &children, bool firstOnly) const;
+    ///@}
+
     /*
      * @name Methods for opening and closing ties and slurs.
      * Opened ties and slurs are stacked together with musicxml::OpenTie
@@ -373,7 +413,7 @@ private:
     ///@{
     ///@}
     std::string GetWordsOrDynamicsText(const pugi::xml_node node) const;
-    void TextRendition(const pugi::xpath_node_set words, ControlElement *element) const;
+    void TextRendition(const std::vector<pugi::xml_node> &words, ControlElement *element) const;
     std::string StyleLabel(pugi::xml_node display);
     void PrintMetronome(pugi::xml_node metronome, Tempo *tempo);
 
@@ -564,6 +604,16 @@ private:
     std::map<Measure *, int> m_measureCounts;
     /* measure rests */
     std::map<int, int> m_multiRests;
+    /* The part elements by @id and the first part element */
+    std::map<std::string, pugi::xml_node> m_partsById;
+    pugi::xml_node m_firstPart;
+    /* Flags set when indexing the parts */
+    bool m_hasNonControllingMeasure = false;
+    bool m_hasEncodedBreaks = false;
+    /* The multiple-rest elements by measure child containing them */
+    std::map<pugi::xml_node, musicxml::MultipleRest> m_multipleRests;
+    /* The measures of the section by @n (the first one for each value) */
+    std::map<std::string, Measure *> m_measuresByN;
 
 #endif // NO_MUSICXML_SUPPORT
 };
@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        jsonwriter.h
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_JSONWRITER_H__
+#define __VRV_JSONWRITER_H__
+
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// JsonWriter
+//----------------------------------------------------------------------------
+
+/**
+ * This class writes JSON directly to an output string without building a jsonxx tree.
+ * The output is formatted as jsonxx::Object::json() and jsonxx::Array::json() do it (tab indentation, same escaping
+ * and number precision). Since jsonxx objects are sorted by key, the keys have to be written in alphabetical order
+ * for the output to be identical.
+ * The output string is cleared when the writer is created.
+ */
+class JsonWriter {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    JsonWriter(std::string &output);
+    virtual ~JsonWriter() = default;
+    ///@}
+
+    /**
+     * @name Start and end an object or an array, as a value of an array or with a key in an object
+     */
+    ///@{
+    void StartObject();
+    void StartObject(const std::string &key);
+    void EndObject();
+    void StartArray();
+    void StartArray(const std::string &key);
+    void EndArray();
+    ///@}
+
+    /**
+     * @name Add a value to an array or with a key to an object
+     */
+    ///@{
+    void AddString(const std::string &value);
+    void AddString(const std::string &key, const std::string &value);
+    void AddNumber(double value);
+    void AddNumber(const std::string &key, double value);
+    void AddBool(bool value);
+    void AddBool(const std::string &key, bool value);
+    ///@}
+
+    /**
+     * Add an array of strings with a key to an object
+     */
+    void AddStringArray(const std::string &key, const std::vector<std::string> &values);
+
+private:
+    /**
+     * Append the indentation and the key (if any) of a value
+     */
+    void AppendKey(const std::string *key);
+
+    /**
+     * Append a string between quotes with the jsonxx escaping
+     */
+    void AppendQuoted(const std::string &value);
+
+    /**
+     * Append a number with the jsonxx precision
+     */
+    void AppendNumber(double value);
+
+    /**
+     * Close the current object or array
+     */
+    void End(char closing);
+
+public:
+    //
+private:
+    /** The output string */
+    std::string &m_output;
+    /** The current depth */
+    int m_depth;
+};
+
+} // namespace vrv
+
+#endif // __VRV_JSONWRITER_H__
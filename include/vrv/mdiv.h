@@ -48,6 +48,11 @@ public:
      */
     void MakeVisible();
 
+    /**
+     * Set the visibility and mark the element as modified, since the content visited by the functors changes.
+     */
+    void SetVisibility(VisibilityType visibility);
+
     //----------//
     // Functors //
     //----------//
@@ -69,6 +74,7 @@ public:
      * Holds the visibility (hidden or visible) for an mdiv element.
      * By default, a mdiv elements is hidden, and one <mdiv> branchn has to be made visible.
      * See Mdiv::MakeVisible();
+     * Use SetVisibility for changing it once the element is in the tree.
      */
     VisibilityType m_visibility;
 
@@ -25,6 +25,7 @@ namespace vrv {
 
 class AltSymInterface;
 class AreaPosInterface;
+class CompositeFunctor;
 class Doc;
 class DurationInterface;
 class EditorialElement;
@@ -291,7 +292,11 @@ public:
      * Return a reference to the children that allows modification.
      * This method should be all only in AddChild overrides methods
      */
-    ArrayOfObjects &GetChildrenForModification() { return m_children; }
+    ArrayOfObjects &GetChildrenForModification()
+    {
+        this->InvalidateDescendantClassIds();
+        return m_children;
+    }
 
     /**
      * Fill an array of pairs with all attributes and their values.
@@ -592,6 +597,25 @@ public:
      */
     void Modify(bool modified = true) const;
 
+    /**
+     * Return the classes of the descendants of the object.
+     * The value is cached and invalidated when the children of the object or of a descendant change.
+     * Caching it is not thread-safe, so it has to be called before traversing a subtree from several threads.
+     */
+    const ClassIdMask &GetDescendantClassIds() const;
+
+    /**
+     * Return true if the object or one of its descendants is of one of the classes.
+     */
+    bool ContainsClassIds(const ClassIdMask &classIds) const;
+
+    /**
+     * Called when the descendants of the object change after their classes have been cached.
+     * To be overridden for invalidating other data cached from the descendants (see Page::GetTraversalIndex).
+     * The cached classes have to be up-to-date when the data is cached, otherwise the change is not notified.
+     */
+    virtual void DescendantsModified() const {}
+
     /**
      * @name Setter and getter of the attribute flag
      */
@@ -650,6 +674,13 @@ public:
     void Process(ConstFunctor &functor, int deepness = UNLIMITED_DEPTH, bool skipFirst = false) const;
     ///@}
 
+    /**
+     * Process several independent functors in a single traversal.
+     * Each functor is called on each object as it would be with a separate Process call.
+     * The functors must process the tree forward and without filters.
+     */
+    void Process(CompositeFunctor &functor, int deepness = UNLIMITED_DEPTH);
+
     /**
      * Interface for class functor visitation
      */
@@ -695,6 +726,9 @@ private:
     void UpdateDocumentScore(bool direction);
     bool SkipChildren(bool visibleOnly) const;
     bool FiltersApply(const Filters *filters, Object *object) const;
+    bool VisitedClassIdsApply(const ClassIdMask *classIds) const;
+    void ProcessComposite(CompositeFunctor &functor, uint32_t activeMask, int deepness);
+    void InvalidateDescendantClassIds() const;
     ///@}
 
 public:
@@ -745,6 +779,16 @@ private:
      */
     mutable bool m_isModified;
 
+    /**
+     * The cached classes of the descendants and a flag indicating if they are up-to-date.
+     * The flag of an object is never set when the one of a descendant is not, so the invalidation can stop
+     * at the first ancestor already invalidated.
+     */
+    ///@{
+    mutable ClassIdMask m_descendantClassIds;
+    mutable bool m_descendantClassIdsValid;
+    ///@}
+
     /**
      * Members used for caching iterator values.
      * See Object::IterGetFirst, Object::IterGetNext and Object::IterIsNotEnd
@@ -789,11 +833,6 @@ private:
     // Static members //
     //----------------//
 
-    /**
-     * A static counter for id generation.
-     */
-    static thread_local unsigned long s_objectCounter;
-
     /**
      * XML id counter
      */
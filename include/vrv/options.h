@@ -593,6 +593,8 @@ public:
     // These options are only given for documentation - except for m_scale
     // They are ordered by short option alphabetical order
     OptionBool m_standardOutput;
+    OptionBool m_server;
+    OptionInt m_threads;
     OptionBool m_help;
     OptionBool m_allPages;
     OptionString m_inputFrom;
@@ -627,6 +629,7 @@ public:
     OptionBool m_justifyVertically;
     OptionBool m_landscape;
     OptionBool m_ligatureAsBracket;
+    OptionBool m_meiStream;
     OptionBool m_mensuralToMeasure;
     OptionDbl m_minLastJustification;
     OptionBool m_mmOutput;
@@ -653,6 +656,7 @@ public:
     OptionIntMap m_smuflTextFont;
     OptionBool m_staccatoCenter;
     OptionBool m_svgBoundingBoxes;
+    OptionInt m_svgCacheSize;
     OptionString m_svgCss;
     OptionBool m_svgViewBox;
     OptionBool m_svgHtml5;
@@ -10,6 +10,7 @@
 
 #include "object.h"
 #include "scoredef.h"
+#include "traversalindex.h"
 
 namespace vrv {
 
@@ -92,6 +93,11 @@ public:
      */
     void LayOut(bool force = false);
 
+    /**
+     * Mark the layout of the page as not done, for example when its content was moved out and back in.
+     */
+    void ResetLayoutDone() { m_layoutDone = false; }
+
     /**
      * Do the layout for a transcription page (with layout information).
      * This only calculates positioning or layer element parts using provided layout of parents.
@@ -150,6 +156,18 @@ public:
      */
     int GetContentWidth() const;
 
+    /**
+     * Return the traversal index of the page.
+     * The index is cached and built again when the content of the page has changed.
+     * This includes changes of the visibility of the elements, see EditorialElement::SetVisibility.
+     */
+    TraversalIndex &GetTraversalIndex();
+
+    /**
+     * Reset the cached traversal index when the content of the page changes.
+     */
+    void DescendantsModified() const override;
+
     //----------//
     // Functors //
     //----------//
@@ -236,6 +254,15 @@ private:
      * the force parameter is set.
      */
     bool m_layoutDone;
+
+    /**
+     * The cached traversal index of the page and a flag indicating if it is up-to-date.
+     * See Page::GetTraversalIndex.
+     */
+    ///@{
+    mutable TraversalIndex m_traversalIndex;
+    mutable bool m_traversalIndexValid;
+    ///@}
 };
 
 } // namespace vrv
@@ -532,6 +532,7 @@ public:
     ///@{
     const ListOfSpanningInterClassIdPairs &GetInterfaceIDPairs() const { return m_timeSpanningInterfaces; }
     void InsertInterfaceIDPair(ClassId classID, TimeSpanningInterface *interface);
+    const ListOfObjectBeatPairs &GetObjectBeatPairs() const { return m_tstamps; }
     void InsertObjectBeatPair(Object *object, const data_MEASUREBEAT &beat);
     ///@}
 
@@ -667,6 +668,17 @@ public:
      */
     bool ImplementsEndInterface() const override { return true; }
 
+    /*
+     * Getter for the syl with a connector not ended yet
+     */
+    const Syl *GetCurrentSyl() const { return m_currentSyl; }
+
+    /*
+     * Continue with the state of another functor and stop once its open syl has been ended by the next one.
+     * This is used for connectors going from one score to the next when the scores are processed separately.
+     */
+    void ContinueFrom(const PrepareLyricsFunctor &functor);
+
     /*
      * Functor interface
      */
@@ -690,6 +702,8 @@ private:
     LayerElement *m_lastNoteOrChord;
     // The penultimate Note or Chord
     LayerElement *m_penultimateNoteOrChord;
+    // Stop when reaching the next syl
+    bool m_stopAtNextSyl;
 };
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,128 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        profiler.h
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_PROFILER_H__
+#define __VRV_PROFILER_H__
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// Profiler
+//----------------------------------------------------------------------------
+
+/**
+ * This class accumulates the time spent in the processing stages of a document.
+ * Stages are nested: a stage started while another one is running is recorded as one of its sub-stages. Stages with
+ * the same name and the same parent are merged, with their count and their total time.
+ * Within a stage, consecutive steps (e.g., the functors of a layout pass) can be recorded with Lap(), each step being
+ * the time elapsed since the previous step (or since the start of the stage), excluding the time of sub-stages.
+ * A profiler is not thread-safe and is meant to be used by the thread processing the document.
+ */
+class Profiler {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    Profiler();
+    virtual ~Profiler() = default;
+    ///@}
+
+    /**
+     * Clear all recorded stages.
+     */
+    void Reset();
+
+    /**
+     * @name Start and end a stage - see ProfileScope for doing it for a scope
+     */
+    ///@{
+    void Start(const char *name);
+    void End();
+    ///@}
+
+    /**
+     * Record a step of the current stage. Does nothing when no stage is running.
+     */
+    void Lap(const char *name);
+
+    /**
+     * Return the recorded stages as a JSON string.
+     * Each stage has a name, a count, a total time in milliseconds and its sub-stages.
+     */
+    std::string GetJson() const;
+
+private:
+    /**
+     * Return the index of the child of a node with the given name, creating it if necessary
+     */
+    int GetChild(int parent, const char *name);
+
+public:
+    //
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct ProfileNode {
+        std::string m_name;
+        int m_count = 0;
+        double m_time = 0.0;
+        std::vector<int> m_children;
+    };
+
+    struct ProfileFrame {
+        int m_node;
+        Clock::time_point m_start;
+        Clock::time_point m_lap;
+    };
+
+    /** The nodes of the stage tree, the first one being the root */
+    std::vector<ProfileNode> m_nodes;
+    /** The stages currently running */
+    std::vector<ProfileFrame> m_frames;
+};
+
+//----------------------------------------------------------------------------
+// ProfileScope
+//----------------------------------------------------------------------------
+
+/**
+ * This class records a stage in a profiler for the time of its own scope.
+ */
+class ProfileScope {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    ProfileScope(Profiler &profiler, const char *name);
+    virtual ~ProfileScope();
+    ///@}
+
+    /**
+     * Record a step of the stage
+     */
+    void Lap(const char *name) { m_profiler.Lap(name); }
+
+private:
+    //
+public:
+    //
+private:
+    /** The profiler in which the stage is recorded */
+    Profiler &m_profiler;
+};
+
+} // namespace vrv
+
+#endif // __VRV_PROFILER_H__
@@ -8,6 +8,7 @@
 #ifndef __VRV_RESOURCES_H__
 #define __VRV_RESOURCES_H__
 
+#include <array>
 #include <unordered_map>
 
 //----------------------------------------------------------------------------
@@ -31,6 +32,7 @@ public:
     using GlyphTable = std::unordered_map<char32_t, Glyph>;
     using GlyphNameTable = std::unordered_map<std::string, char32_t>;
     using GlyphTextMap = std::map<StyleAttributes, GlyphTable>;
+    using TextGlyphArray = std::array<const Glyph *, 256>;
 
     /**
      * @name Constructors, destructors, and other standard methods
@@ -38,6 +40,9 @@ public:
     ///@{
     Resources();
     virtual ~Resources() = default;
+    // The text glyph arrays and the current text table point to glyphs of the member tables
+    Resources(const Resources &) = delete;
+    Resources &operator=(const Resources &) = delete;
     ///@}
 
     /**
@@ -62,6 +67,8 @@ public:
     /** Select a particular font */
     bool SetFont(const std::string &fontName);
     std::string GetCurrentFontName() const { return m_fontName; }
+    /** The font generation, incremented every time a font is loaded */
+    int GetFontGeneration() const { return m_fontGeneration; }
     ///@}
 
     /**
@@ -91,6 +98,16 @@ public:
     const Glyph *GetTextGlyph(char32_t code) const;
     ///@}
 
+    /**
+     * Text extent cache for the current text style.
+     * The extents are cached by string, point size and type size flag, and the cache is cleared when a font is
+     * loaded. The ascent and the descent are the maximum values of the glyphs.
+     */
+    ///@{
+    bool GetCachedTextExtent(const std::u32string &text, int pointSize, bool typeSize, TextExtend &extend) const;
+    void SetCachedTextExtent(const std::u32string &text, int pointSize, bool typeSize, const TextExtend &extend) const;
+    ///@}
+
     /**
      * Static method that converts unicode music code points to SMuFL equivalent.
      * Return the parameter char if nothing can be converted.
@@ -100,6 +117,37 @@ public:
 private:
     bool LoadFont(const std::string &fontName, bool withFallback = true);
 
+    /**
+     * Update the current text table and text glyph array for the current style
+     */
+    void UpdateCurrentTextTable() const;
+
+    /**
+     * The key of the text extent cache
+     */
+    struct TextExtentKey {
+        std::u32string m_text;
+        StyleAttributes m_style;
+        int m_pointSize;
+        bool m_typeSize;
+
+        bool operator==(const TextExtentKey &other) const
+        {
+            return ((m_text == other.m_text) && (m_style == other.m_style) && (m_pointSize == other.m_pointSize)
+                && (m_typeSize == other.m_typeSize));
+        }
+    };
+
+    struct TextExtentKeyHash {
+        size_t operator()(const TextExtentKey &key) const
+        {
+            size_t hash = std::hash<std::u32string>()(key.m_text);
+            hash ^= (size_t)key.m_pointSize * 31 + (size_t)key.m_style.first * 7 + (size_t)key.m_style.second
+                + (key.m_typeSize ? 0x9e3779b9 : 0);
+            return hash;
+        }
+    };
+
 private:
     /** The font name of the font that is currently loaded */
     std::string m_fontName;
@@ -107,9 +155,18 @@ private:
     std::string m_path;
     /** The loaded SMuFL font */
     GlyphTable m_fontGlyphTable;
+    /** The font generation */
+    int m_fontGeneration;
     /** A text font used for bounding box calculations */
     GlyphTextMap m_textFont;
+    /** The Latin-1 glyphs of each text font style, for a direct lookup of the most frequent characters */
+    std::map<StyleAttributes, TextGlyphArray> m_textGlyphArrays;
     mutable StyleAttributes m_currentStyle;
+    /** The table and the glyph array of the current text style (NULL if not loaded) */
+    mutable const GlyphTable *m_currentTextTable;
+    mutable const TextGlyphArray *m_currentTextGlyphArray;
+    /** The text extent cache */
+    mutable std::unordered_map<TextExtentKey, TextExtend, TextExtentKeyHash> m_textExtentCache;
     /**
      * A map of glyph name / code
      */
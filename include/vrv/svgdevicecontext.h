@@ -246,6 +246,22 @@ public:
      */
     void SetSmuflTextFont(option_SMUFLTEXTFONT smuflTextFont) { m_smuflTextFont = smuflTextFont; }
 
+    /**
+     * @name Setters and getters for rendering tiles sharing their glyph <defs>
+     * The region is in MEI units from the top-left corner of the page and sets the viewBox and the size of the SVG.
+     */
+    ///@{
+    void SetGlyphPostfixId(const std::string &glyphPostfixId) { m_glyphPostfixId = glyphPostfixId; }
+    void SetIncludeDefs(bool includeDefs) { m_includeDefs = includeDefs; }
+    void SetRegion(int x, int y, int width, int height);
+    const std::set<const Glyph *> &GetSmuflGlyphs() const { return m_smuflGlyphs; }
+    ///@}
+
+    /**
+     * Return an SVG with only the <defs> of the glyphs
+     */
+    std::string GetStringDefs(const std::set<const Glyph *> &glyphs) const;
+
 private:
     /**
      * Copy the content of a file to the output stream.
@@ -278,6 +294,11 @@ private:
      */
     void IncludeTextFont(const std::string &fontname, const Resources *resources);
 
+    /**
+     * Copy the glyphs from their XML file into the <defs> node
+     */
+    void AppendGlyphDefs(pugi::xml_node defs, const std::set<const Glyph *> &glyphs) const;
+
     /**
      * Flush the data to the internal buffer.
      * Adds the xml tag if necessary and the <defs> from m_smuflGlyphs
@@ -357,6 +378,11 @@ private:
     std::string m_glyphPostfixId;
     // embedding of the smufl text font
     option_SMUFLTEXTFONT m_smuflTextFont;
+    // add the <defs> of the glyphs in the output
+    bool m_includeDefs;
+    // region of the page for the output (MEI units)
+    bool m_hasRegion;
+    int m_regionX, m_regionY, m_regionWidth, m_regionHeight;
 };
 
 } // namespace vrv
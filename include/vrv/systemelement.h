@@ -36,6 +36,11 @@ public:
     void Reset() override;
     ///@}
 
+    /**
+     * Set the visibility and mark the element as modified, since the content visited by the functors changes.
+     */
+    void SetVisibility(VisibilityType visibility);
+
     //----------//
     // Functors //
     //----------//
@@ -56,6 +61,7 @@ public:
     /**
      * Holds the visibility (hidden or visible) for an system element.
      * By default, a system element is visible. It can be hidden when expansion are processed.
+     * Use SetVisibility for changing it once the element is in the tree.
      */
     VisibilityType m_visibility;
 
@@ -0,0 +1,97 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        threadpool.h
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_THREADPOOL_H__
+#define __VRV_THREADPOOL_H__
+
+#include <functional>
+#include <queue>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "vrvdef.h"
+
+#ifndef NO_THREAD_SUPPORT
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+
+/**
+ * This class runs tasks on a fixed number of worker threads.
+ * Tasks are run in the calling thread when multithreading is not supported (NO_THREAD_SUPPORT) or when only one
+ * thread is requested.
+ * The tasks must not share any non-const data unless they synchronize it themselves.
+ */
+class ThreadPool {
+public:
+    /**
+     * @name Constructors, destructors
+     * A thread count of 0 uses the number of hardware threads.
+     */
+    ///@{
+    ThreadPool(int threadCount = 0);
+    virtual ~ThreadPool();
+    ///@}
+
+    /**
+     * Return the number of worker threads (0 when tasks run in the calling thread)
+     */
+    int GetThreadCount() const { return (int)m_workers.size(); }
+
+    /**
+     * Add a task to the queue.
+     */
+    void Enqueue(std::function<void()> task);
+
+    /**
+     * Wait until all the tasks of the queue have been run.
+     */
+    void Wait();
+
+    /**
+     * Return the number of hardware threads (at least 1)
+     */
+    static int GetHardwareThreadCount();
+
+private:
+    /**
+     * The loop of each worker thread
+     */
+    void Run();
+
+public:
+    //
+private:
+#ifndef NO_THREAD_SUPPORT
+    /** The worker threads */
+    std::vector<std::thread> m_workers;
+    /** The task queue and its synchronization */
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_taskCondition;
+    std::condition_variable m_doneCondition;
+    /** The number of tasks queued or running */
+    int m_pending;
+    /** Flag for stopping the workers */
+    bool m_stop;
+#else
+    /** No worker threads without thread support */
+    std::vector<int> m_workers;
+#endif
+};
+
+} // namespace vrv
+
+#endif // __VRV_THREADPOOL_H__
@@ -66,6 +66,20 @@ public:
      */
     void ToJson(std::string &output, bool includetRests, bool includetMeasures);
 
+    /**
+     * Write the current timemap to a columnar binary buffer.
+     * All the values are little-endian and each column is aligned to its value size. The layout is:
+     * - header: "VTM1" followed by 9 uint32 (version, entry count, id count, on count, off count,
+     *   rests on count, rests off count, id data size, reserved)
+     * - float64 columns of the entries: tstamp, qstamp, tempo (the tempo in effect, 0.0 if none)
+     * - uint32 columns for on, off, restsOn and restsOff: offsets (entry count + 1) followed by the ID indices
+     * - uint32 column of the measureOn ID index of the entries (0xFFFFFFFF if none)
+     * - uint32 offsets of the IDs (id count + 1) followed by the UTF-8 ID data (without terminating characters)
+     * The IDs are deduplicated in the ID table in order of first appearance.
+     * The rest and measure columns are empty or filled with 0xFFFFFFFF when not included.
+     */
+    void ToBuffer(std::vector<unsigned char> &output, bool includeRests, bool includeMeasures);
+
 private:
     //
 public:
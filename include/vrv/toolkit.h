@@ -8,6 +8,8 @@
 #ifndef __VRV_TOOLKIT_H__
 #define __VRV_TOOLKIT_H__
 
+#include <list>
+#include <map>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -19,10 +21,16 @@
 
 //----------------------------------------------------------------------------
 
+namespace pugi {
+class xml_writer;
+}
+
 namespace vrv {
 
 class EditorToolkit;
+class Input;
 class RuntimeClock;
+class SvgDeviceContext;
 
 /**
  * @defgroup nodoc Public methods that are not listed in the documentation
@@ -96,6 +104,16 @@ public:
      */
     std::string GetLog();
 
+    /**
+     * Get the time spent in the processing stages since the data was loaded.
+     *
+     * The stages include the import, the data preparation, the cast-off, the layout (with each of their functors)
+     * and the rendering. The profile is reset when new data is loaded.
+     *
+     * @return A stringified JSON object with the nested stages, their count and their time in milliseconds
+     */
+    std::string GetProfile() const;
+
     /**
      * Return the version number.
      *
@@ -144,6 +162,21 @@ public:
      */
     bool LoadData(const std::string &data);
 
+    /**
+     * Load data from a buffer that the toolkit is allowed to modify.
+     *
+     * MEI data is parsed in place without being copied, which reduces the memory needed for large files.
+     * The content of the buffer is modified but the buffer is not used anymore once the method returns.
+     * Other formats are loaded as with LoadData.
+     *
+     * @remark nojs
+     *
+     * @param data A buffer with the data to be loaded
+     * @param length The size of the data buffer
+     * @return True if the data was successfully loaded
+     */
+    bool LoadDataBuffer(char *data, size_t length);
+
     /**
      * Load a MusicXML compressed file passed as base64 encoded string.
      *
@@ -348,6 +381,22 @@ public:
      */
     std::string RenderData(const std::string &data, const std::string &jsonOptions);
 
+    /**
+     * Convert a collection of tunes or segments in parallel.
+     *
+     * ABC data is split into its tunes (starting with an X: field) and Humdrum data into its segments (starting with
+     * a !!!!SEGMENT record). Other data is converted as a single unit.
+     * Each unit is loaded by its own toolkit with the options of this one, and the units are converted on several
+     * threads. The data loaded in this toolkit is not modified.
+     * The JSON options are "output" ("mei" (default), "svg" for all the pages, or "midi") and "threads" (the number
+     * of threads, 0 (default) for the number of hardware threads).
+     *
+     * @param data A string with the collection
+     * @param jsonOptions A stringified JSON object with the collection options
+     * @return A stringified JSON array with an object ("n", "loaded", "data") for each unit
+     */
+    std::string ConvertCollection(const std::string &data, const std::string &jsonOptions = "");
+
     /**
      * Render a page to SVG.
      *
@@ -357,6 +406,62 @@ public:
      */
     std::string RenderToSVG(int pageNo = 1, bool xmlDeclaration = false);
 
+    /**
+     * Render the part of a page intersecting a rectangle to SVG.
+     *
+     * Only the systems and staves intersecting the rectangle are drawn. The SVG keeps the size of the page.
+     * The rectangle is in MEI units from the top-left corner of the page, as in the viewBox of the SVG page.
+     *
+     * @param pageNo The page to render (1-based)
+     * @param x The left of the rectangle
+     * @param y The top of the rectangle
+     * @param width The width of the rectangle
+     * @param height The height of the rectangle
+     * @param xmlDeclaration True for including the xml declaration in the SVG output
+     * @return The SVG page as a string
+     */
+    std::string RenderToSVGRegion(int pageNo, int x, int y, int width, int height, bool xmlDeclaration = false);
+
+    /**
+     * Render a page to SVG tiles that can be displayed independently.
+     *
+     * There is one tile for each system, or for every N measures of each system with the "measures" JSON option
+     * (e.g., for a horizontal scrolling with breaks set to none).
+     * Each tile is an SVG of its region of the page with only the systems and staves intersecting it.
+     * The tiles refer to the glyphs of a single <defs> SVG to be included once in the document displaying them.
+     *
+     * @param pageNo The page to render (1-based)
+     * @param jsonOptions A stringified JSON object with the tile options
+     * @return A stringified JSON object with "defs" and "tiles" (an array of objects with "x", "y", "width",
+     * "height" and "svg")
+     */
+    std::string RenderToSVGTiles(int pageNo, const std::string &jsonOptions = "");
+
+    /**
+     * Render an excerpt of the document to SVG.
+     *
+     * The measures of the excerpt are moved out of the document and cast off alone according to the breaks option,
+     * reusing their cached horizontal layout. They are moved back once rendered, and the pages of the document are laid
+     * out again the next time they are rendered. The excerpt has to be within a score.
+     * Excerpts cannot be rendered for mensural music since it has no measures.
+     *
+     * @param jsonSelection A stringified JSON object with the "measureRange", or the "start" and "end" measure IDs,
+     * as with Toolkit::Select
+     * @param pageNo The page of the excerpt to render (1-based)
+     * @return The SVG page as a string
+     */
+    std::string RenderExcerptToSVG(const std::string &jsonSelection, int pageNo = 1);
+
+    /**
+     * Render several excerpts of the document to SVG.
+     *
+     * Each excerpt is cast off and rendered in turn as with RenderExcerptToSVG.
+     *
+     * @param jsonOptions A stringified JSON object with the "excerpts" array of selections
+     * @return A stringified JSON array with an object ("n", "loaded", "data" with the SVG pages) for each excerpt
+     */
+    std::string RenderExcerptsToSVG(const std::string &jsonOptions);
+
     /**
      * Render a page to SVG and save it to the file.
      *
@@ -368,6 +473,28 @@ public:
      */
     bool RenderToSVGFile(const std::string &filename, int pageNo = 1);
 
+    /**
+     * Render a range of pages to SVG and save them to files using several threads.
+     *
+     * The pages are rendered from the page-based MEI of the loaded document by one toolkit per thread. Each toolkit
+     * imports the MEI and prepares the data again, but the document is not cast off again. The files are named with
+     * the base filename followed by the page number (e.g., "score_001.svg").
+     * With an xmlIdSeed option, the output of this method does not depend on the number of threads. However, the IDs
+     * generated when preparing the data (e.g., for stems) and the postfix of the glyph IDs differ from the ones of
+     * RenderToSVGFile, which the command-line tool uses with a single thread.
+     * The pages are rendered with RenderToSVGFile when the document has a selection, endings or expansions, since
+     * these cannot be reloaded from page-based MEI.
+     *
+     * @remark nojs
+     *
+     * @param filename The base output filename (without extension)
+     * @param fromPage The first page to render (1-based)
+     * @param toPage The last page to render (1-based)
+     * @param threadCount The number of threads (0 for the number of hardware threads)
+     * @return True if all the files were successfully written
+     */
+    bool RenderToSVGFiles(const std::string &filename, int fromPage, int toPage, int threadCount = 0);
+
     /**
      * Render the document to MIDI.
      *
@@ -414,6 +541,19 @@ public:
      */
     std::string RenderToTimemap(const std::string &jsonOptions = "");
 
+    /**
+     * Render a document to a columnar binary timemap.
+     *
+     * The entries are stored as typed arrays and the note IDs as indices in a deduplicated ID table.
+     * See Timemap::ToBuffer for the layout.
+     *
+     * @remark nojs
+     *
+     * @param jsonOptions A stringified JSON objects with the timemap options
+     * @return The timemap as a byte buffer
+     */
+    std::vector<unsigned char> RenderToTimemapBuffer(const std::string &jsonOptions = "");
+
     /**
      * Render a document's expansionMap, if existing
      *
@@ -509,6 +649,7 @@ public:
 
     /**
      * Get the MEI and save it to the file.
+     * The MEI is written to a temporary file first, so an existing file is replaced only when the output succeeds.
      *
      * @remark nojs
      *
@@ -683,6 +824,20 @@ public:
      */
     const char *GetCString();
 
+    /**
+     * Move the data to the binary internal buffer.
+     *
+     * @ingroup nodoc
+     */
+    void SetCBuffer(std::vector<unsigned char> data);
+
+    /**
+     * Return the content of the binary internal buffer and set its length.
+     *
+     * @ingroup nodoc
+     */
+    const unsigned char *GetCBuffer(int *length);
+
     /**
      * Write the Humdrum buffer to the outputstream.
      *
@@ -757,7 +912,7 @@ protected:
     void PrintOptionUsageOutput(const vrv::Option *option, std::ostream &output) const;
 
     /**
-     * Resets the vrv::logBuffer.
+     * Resets the vrv::logBuffer. Worker toolkits (see CreateWorkerToolkit) leave it untouched.
      */
     void ResetLogBuffer();
 
@@ -768,6 +923,36 @@ private:
     bool IsZip(const std::string &filename);
     bool LoadZipFile(const std::string &filename);
     bool LoadZipData(const std::vector<unsigned char> &bytes);
+
+    /**
+     * Load MEI data from a stream without reading it entirely first
+     */
+    bool LoadMEIStream(std::istream &stream);
+
+    /**
+     * Return the input format of the data, looking only at its beginning when it needs to be identified
+     */
+    FileFormat GetInputFormat(const char *data, size_t length);
+
+    /**
+     * Reset the expansion map, the Humdrum buffer and the ID seed before loading data
+     */
+    void ResetForLoading(const char *data, size_t length);
+
+    /**
+     * Lay out the document once the input has been imported
+     */
+    void FinalizeLoadedDoc(Input *input);
+
+    /**
+     * Serialize the MEI to the writer with the GetMEI options
+     */
+    bool WriteMEI(pugi::xml_writer &writer, const std::string &jsonOptions);
+
+    /**
+     * Read the includeRests and includeMeasures timemap options
+     */
+    void ParseTimemapOptions(const std::string &jsonOptions, bool &includeRests, bool &includeMeasures);
     void GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds);
 
     /**
@@ -778,6 +963,44 @@ private:
      */
     std::string GetOptions(bool defaultValues) const;
 
+    /**
+     * Split a collection into the data of its tunes (ABC) or segments (Humdrum)
+     */
+    std::vector<std::string> SplitCollection(const std::string &data, FileFormat format) const;
+
+    /**
+     * Create a toolkit with the same resource path, options and font for converting or rendering in a worker thread.
+     * It has to be created in the calling thread since the resource path is thread local.
+     */
+    Toolkit *CreateWorkerToolkit(FileFormat inputFormat) const;
+
+    /**
+     * Cast off the document according to the breaks option
+     */
+    void CastOffDocWithBreaks();
+
+    /**
+     * Render the pages of an excerpt (or only pageNo when not 0) of the measures of the document
+     */
+    bool RenderExcerpt(
+        const std::string &jsonSelection, const ListOfObjects &measures, int pageNo, std::vector<std::string> &svgs);
+
+    /**
+     * Set the SVG options to the device context
+     */
+    void InitSvgDeviceContext(SvgDeviceContext &svg);
+
+    /**
+     * @name Methods for the cache of rendered SVG pages
+     * The key is made of the page, the xml declaration flag and a fingerprint of the options.
+     * The cache is reset when the data, the options or the layout change.
+     */
+    ///@{
+    std::string GetSvgCacheKey(int pageNo, bool xmlDeclaration) const;
+    void AddToSvgCache(const std::string &key, const std::string &svg);
+    void ResetSvgCache();
+    ///@}
+
 public:
     //
 private:
@@ -793,9 +1016,24 @@ private:
      * The C buffer string.
      */
     char *m_cString;
+    std::vector<unsigned char> m_cBuffer;
 
     EditorToolkit *m_editorToolkit;
 
+    /**
+     * A flag indicating that the toolkit was created by CreateWorkerToolkit for running on a worker thread.
+     * The log buffer is shared by all threads, so it is not reset by worker toolkits.
+     */
+    bool m_isWorker;
+
+    /**
+     * The cache of rendered SVG pages, the most recently used first, and its index by key
+     */
+    ///@{
+    std::list<std::pair<std::string, std::string>> m_svgCache;
+    std::map<std::string, std::list<std::pair<std::string, std::string>>::iterator> m_svgCacheIndex;
+    ///@}
+
 #ifndef NO_RUNTIME
     /** Measuring runtime */
     RuntimeClock *m_runtimeClock;
@@ -805,7 +1043,8 @@ private:
     // Static members //
     //----------------//
 
-    static char *m_humdrumBuffer;
+    /** Thread local for converting collections on several threads */
+    static thread_local char *m_humdrumBuffer;
 };
 
 } // namespace vrv
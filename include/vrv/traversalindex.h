@@ -0,0 +1,145 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        traversalindex.h
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_TRAVERSALINDEX_H__
+#define __VRV_TRAVERSALINDEX_H__
+
+#include <map>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "functor.h"
+#include "vrvdef.h"
+
+namespace vrv {
+
+class Object;
+
+//----------------------------------------------------------------------------
+// TraversalIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds a flat pre-order traversal of a subtree.
+ * Each entry stores the index following its own subtree, and the entry indices are grouped by ClassId.
+ * Functors visiting only a few classes can be processed on it without visiting the other objects.
+ * The index is built with the same visibility as Object::Process, i.e., the content of hidden elements is skipped.
+ * It points to the objects of the tree, so it must be built again (or reset) when the tree is modified.
+ */
+class TraversalIndex {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    TraversalIndex();
+    virtual ~TraversalIndex() = default;
+    ///@}
+
+    /**
+     * Build the index for the object and its descendants.
+     */
+    void Build(Object *root);
+
+    /**
+     * Reset the index.
+     */
+    void Reset();
+
+    /**
+     * Return true if the index has not been built.
+     */
+    bool IsEmpty() const { return m_entries.empty(); }
+
+    /**
+     * Process a functor on the objects of the classes it visits in pre-order.
+     * The result is the same as with Object::Process, see FunctorBase::SetVisitedClassIds.
+     * The functor must process the tree forward, without filters, with visible elements only and without modifying
+     * the tree.
+     */
+    void Process(Functor &functor);
+
+    /**
+     * Append an object and return its index. Used by BuildTraversalIndexFunctor.
+     */
+    int AddEntry(Object *object);
+
+    /**
+     * Set the end of the subtree of an entry to the current size of the index. Used by BuildTraversalIndexFunctor.
+     */
+    void SetSubtreeEnd(int idx);
+
+private:
+    /**
+     * Return the sorted indices of the entries of the given classes
+     */
+    std::vector<int> GetIndices(const ClassIdMask &classIds) const;
+
+public:
+    //
+private:
+    /**
+     * An entry of the index with the index following its subtree
+     */
+    struct Entry {
+        Object *m_object;
+        int m_subtreeEnd;
+    };
+
+    /** The entries in pre-order */
+    std::vector<Entry> m_entries;
+    /** The indices of the entries for each ClassId */
+    std::map<ClassId, std::vector<int>> m_indicesByClassId;
+};
+
+//----------------------------------------------------------------------------
+// BuildTraversalIndexFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class fills a TraversalIndex.
+ */
+class BuildTraversalIndexFunctor : public Functor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    BuildTraversalIndexFunctor(TraversalIndex *traversalIndex);
+    virtual ~BuildTraversalIndexFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return true; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitObject(Object *object) override;
+    FunctorCode VisitObjectEnd(Object *object) override;
+    ///@}
+
+protected:
+    //
+private:
+    //
+public:
+    //
+private:
+    // The index being filled
+    TraversalIndex *m_traversalIndex;
+    // The indices of the entries with an open subtree
+    std::vector<int> m_openEntries;
+};
+
+} // namespace vrv
+
+#endif // __VRV_TRAVERSALINDEX_H__
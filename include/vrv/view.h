@@ -95,6 +95,16 @@ class Verse;
 // Helper enums
 enum class SlurHandling { Ignore, Initialize, Drawing };
 
+/**
+ * A rectangle in page coordinates (MEI units from the top-left corner of the page)
+ */
+struct PageRect {
+    int m_x = 0;
+    int m_y = 0;
+    int m_width = 0;
+    int m_height = 0;
+};
+
 //----------------------------------------------------------------------------
 // View
 //----------------------------------------------------------------------------
@@ -178,6 +188,26 @@ public:
      */
     void DrawCurrentPage(DeviceContext *dc, bool background = true);
 
+    /**
+     * @name Restrict the drawing to the systems and staves intersecting a rectangle
+     * The rectangle is in MEI units from the top-left corner of the page, i.e., including the margins.
+     * Systems and staves are skipped according to their position and overflow computed by the layout.
+     */
+    ///@{
+    void SetClipRect(int x, int y, int width, int height);
+    void ResetClipRect() { m_hasClipRect = false; }
+    bool HasClipRect() const { return m_hasClipRect; }
+    ///@}
+
+    /**
+     * Return the rectangles of the tiles of the current page for rendering it in parts.
+     * There is one tile for each system, or for every measureCount measures of each system when measureCount > 0.
+     * The tiles cover the whole page horizontally (for systems) or vertically (for measures), and the first and last
+     * tiles of the page extend to its edges.
+     * Defined in view_page.cpp
+     */
+    std::vector<PageRect> GetTileRects(int measureCount) const;
+
     /**
      * Return the pixel per unit factor of the current page (if any, 1.0 otherwise)
      */
@@ -647,6 +677,19 @@ private:
      */
     bool HasValidTimeSpanningOrder(DeviceContext *dc, Object *element, LayerElement *start, LayerElement *end) const;
 
+    /**
+     * Return true if the area is outside the clip rectangle (if any).
+     * The area is given in logical coordinates, i.e., with top above bottom.
+     * Defined in view_page.cpp
+     */
+    bool IsOutsideClipRect(int left, int top, int right, int bottom) const;
+
+    /**
+     * Return the vertical extent (top and bottom) of a system in logical coordinates, including its overflow
+     * Defined in view_page.cpp
+     */
+    std::pair<int, int> GetSystemExtent(const System *system) const;
+
     /**
      * Internal method to find stem direction for notes of mensural notation
      */
@@ -693,6 +736,17 @@ protected:
      */
     ScoreDef m_drawingScoreDef;
 
+    /**
+     * The clip rectangle in page coordinates (MEI units from the top-left corner of the page)
+     */
+    ///@{
+    bool m_hasClipRect;
+    int m_clipLeft;
+    int m_clipTop;
+    int m_clipRight;
+    int m_clipBottom;
+    ///@}
+
 private:
     //----------------//
     // Static members //
@@ -44,6 +44,7 @@ void LogWarning(const char *fmt, ...);
  */
 extern std::vector<std::string> logBuffer;
 bool LogBufferContains(const std::string &s);
+void LogBufferClear();
 void LogString(std::string message, LogLevel level);
 
 /**
@@ -105,6 +106,12 @@ std::string GetFileVersion(int vmaj, int vmin, int vrev);
  */
 std::string GetFilename(std::string fullpath);
 
+/**
+ * Rename a file, replacing the target if it exists.
+ * The target is left untouched if the renaming fails.
+ */
+bool RenameReplacing(const std::string &from, const std::string &to);
+
 /**
  * Return the version number (X.X.X)
  */
@@ -9,6 +9,7 @@
 #define __VRV_DEF_H__
 
 #include <algorithm>
+#include <bitset>
 #include <functional>
 #include <list>
 #include <map>
@@ -53,6 +54,14 @@ namespace vrv {
 #define VRV_RESOURCE_DIR "/usr/local/share/verovio"
 #endif
 
+//----------------------------------------------------------------------------
+// Multithreading
+//----------------------------------------------------------------------------
+// WASM builds without pthreads cannot start threads
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__) && !defined(NO_THREAD_SUPPORT)
+#define NO_THREAD_SUPPORT
+#endif
+
 //----------------------------------------------------------------------------
 // Cast redefinition
 //----------------------------------------------------------------------------
@@ -333,6 +342,8 @@ class TextElement;
 class TimePointInterface;
 class TimeSpanningInterface;
 
+typedef std::bitset<UNSPECIFIED + 1> ClassIdMask;
+
 typedef std::vector<Object *> ArrayOfObjects;
 
 typedef std::vector<const Object *> ArrayOfConstObjects;
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttHarmAnl::ResetHarmAnl()
 bool AttHarmAnl::ReadHarmAnl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHarmAnlForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttHarmAnl::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToHarmAnlForm(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttHarmAnl::WriteHarmAnl(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -79,14 +94,28 @@ void AttHarmonicFunction::ResetHarmonicFunction()
 bool AttHarmonicFunction::ReadHarmonicFunction(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("deg")) {
-        this->SetDeg(StrToStr(element.attribute("deg").value()));
-        if (removeAttr) element.remove_attribute("deg");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttHarmonicFunction::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("deg"):
+            if (std::strcmp(name, "deg") != 0) break;
+            this->SetDeg(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttHarmonicFunction::WriteHarmonicFunction(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -119,14 +148,28 @@ void AttIntervalHarmonic::ResetIntervalHarmonic()
 bool AttIntervalHarmonic::ReadIntervalHarmonic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("inth")) {
-        this->SetInth(StrToStr(element.attribute("inth").value()));
-        if (removeAttr) element.remove_attribute("inth");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttIntervalHarmonic::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("inth"):
+            if (std::strcmp(name, "inth") != 0) break;
+            this->SetInth(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttIntervalHarmonic::WriteIntervalHarmonic(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -159,14 +202,28 @@ void AttIntervalMelodic::ResetIntervalMelodic()
 bool AttIntervalMelodic::ReadIntervalMelodic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("intm")) {
-        this->SetIntm(StrToStr(element.attribute("intm").value()));
-        if (removeAttr) element.remove_attribute("intm");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttIntervalMelodic::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("intm"):
+            if (std::strcmp(name, "intm") != 0) break;
+            this->SetIntm(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttIntervalMelodic::WriteIntervalMelodic(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -201,24 +258,36 @@ void AttKeySigDefaultAnl::ResetKeySigDefaultAnl()
 bool AttKeySigDefaultAnl::ReadKeySigDefaultAnl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("key.accid")) {
-        this->SetKeyAccid(StrToAccidentalGestural(element.attribute("key.accid").value()));
-        if (removeAttr) element.remove_attribute("key.accid");
-        hasAttribute = true;
-    }
-    if (element.attribute("key.mode")) {
-        this->SetKeyMode(StrToMode(element.attribute("key.mode").value()));
-        if (removeAttr) element.remove_attribute("key.mode");
-        hasAttribute = true;
-    }
-    if (element.attribute("key.pname")) {
-        this->SetKeyPname(StrToPitchname(element.attribute("key.pname").value()));
-        if (removeAttr) element.remove_attribute("key.pname");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttKeySigDefaultAnl::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("key.accid"):
+            if (std::strcmp(name, "key.accid") != 0) break;
+            this->SetKeyAccid(StrToAccidentalGestural(attr.value()));
+            return true;
+        case StrHash("key.mode"):
+            if (std::strcmp(name, "key.mode") != 0) break;
+            this->SetKeyMode(StrToMode(attr.value()));
+            return true;
+        case StrHash("key.pname"):
+            if (std::strcmp(name, "key.pname") != 0) break;
+            this->SetKeyPname(StrToPitchname(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttKeySigDefaultAnl::WriteKeySigDefaultAnl(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -269,14 +338,28 @@ void AttMelodicFunction::ResetMelodicFunction()
 bool AttMelodicFunction::ReadMelodicFunction(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mfunc")) {
-        this->SetMfunc(StrToMelodicfunction(element.attribute("mfunc").value()));
-        if (removeAttr) element.remove_attribute("mfunc");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMelodicFunction::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("mfunc"):
+            if (std::strcmp(name, "mfunc") != 0) break;
+            this->SetMfunc(StrToMelodicfunction(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMelodicFunction::WriteMelodicFunction(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -309,14 +392,28 @@ void AttPitchClass::ResetPitchClass()
 bool AttPitchClass::ReadPitchClass(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pclass")) {
-        this->SetPclass(StrToInt(element.attribute("pclass").value()));
-        if (removeAttr) element.remove_attribute("pclass");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPitchClass::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("pclass"):
+            if (std::strcmp(name, "pclass") != 0) break;
+            this->SetPclass(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPitchClass::WritePitchClass(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -349,14 +446,28 @@ void AttSolfa::ResetSolfa()
 bool AttSolfa::ReadSolfa(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("psolfa")) {
-        this->SetPsolfa(StrToStr(element.attribute("psolfa").value()));
-        if (removeAttr) element.remove_attribute("psolfa");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSolfa::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("psolfa"):
+            if (std::strcmp(name, "psolfa") != 0) break;
+            this->SetPsolfa(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSolfa::WriteSolfa(pugi::xml_node element)
 {
     bool wroteAttribute = false;
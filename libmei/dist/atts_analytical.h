@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadHarmAnl(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteHarmAnl(pugi::xml_node element);
 
@@ -90,6 +93,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadHarmonicFunction(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteHarmonicFunction(pugi::xml_node element);
 
@@ -145,6 +151,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadIntervalHarmonic(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteIntervalHarmonic(pugi::xml_node element);
 
@@ -194,6 +203,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadIntervalMelodic(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteIntervalMelodic(pugi::xml_node element);
 
@@ -248,6 +260,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadKeySigDefaultAnl(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteKeySigDefaultAnl(pugi::xml_node element);
 
@@ -312,6 +327,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMelodicFunction(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMelodicFunction(pugi::xml_node element);
 
@@ -361,6 +379,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPitchClass(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePitchClass(pugi::xml_node element);
 
@@ -410,6 +431,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSolfa(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSolfa(pugi::xml_node element);
 
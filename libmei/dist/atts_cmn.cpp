@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttArpegLog::ResetArpegLog()
 bool AttArpegLog::ReadArpegLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("order")) {
-        this->SetOrder(StrToArpegLogOrder(element.attribute("order").value()));
-        if (removeAttr) element.remove_attribute("order");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttArpegLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("order"):
+            if (std::strcmp(name, "order") != 0) break;
+            this->SetOrder(StrToArpegLogOrder(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttArpegLog::WriteArpegLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -79,14 +94,28 @@ void AttBeamPresent::ResetBeamPresent()
 bool AttBeamPresent::ReadBeamPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam")) {
-        this->SetBeam(StrToStr(element.attribute("beam").value()));
-        if (removeAttr) element.remove_attribute("beam");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBeamPresent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("beam"):
+            if (std::strcmp(name, "beam") != 0) break;
+            this->SetBeam(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBeamPresent::WriteBeamPresent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -122,29 +151,40 @@ void AttBeamRend::ResetBeamRend()
 bool AttBeamRend::ReadBeamRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBeamRendForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToBeamplace(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
-        hasAttribute = true;
-    }
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToBoolean(element.attribute("slash").value()));
-        if (removeAttr) element.remove_attribute("slash");
-        hasAttribute = true;
-    }
-    if (element.attribute("slope")) {
-        this->SetSlope(StrToDbl(element.attribute("slope").value()));
-        if (removeAttr) element.remove_attribute("slope");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBeamRend::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToBeamRendForm(attr.value()));
+            return true;
+        case StrHash("place"):
+            if (std::strcmp(name, "place") != 0) break;
+            this->SetPlace(StrToBeamplace(attr.value()));
+            return true;
+        case StrHash("slash"):
+            if (std::strcmp(name, "slash") != 0) break;
+            this->SetSlash(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("slope"):
+            if (std::strcmp(name, "slope") != 0) break;
+            this->SetSlope(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBeamRend::WriteBeamRend(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -204,14 +244,28 @@ void AttBeamSecondary::ResetBeamSecondary()
 bool AttBeamSecondary::ReadBeamSecondary(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("breaksec")) {
-        this->SetBreaksec(StrToInt(element.attribute("breaksec").value()));
-        if (removeAttr) element.remove_attribute("breaksec");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBeamSecondary::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("breaksec"):
+            if (std::strcmp(name, "breaksec") != 0) break;
+            this->SetBreaksec(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBeamSecondary::WriteBeamSecondary(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -244,14 +298,28 @@ void AttBeamedWith::ResetBeamedWith()
 bool AttBeamedWith::ReadBeamedWith(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.with")) {
-        this->SetBeamWith(StrToNeighboringlayer(element.attribute("beam.with").value()));
-        if (removeAttr) element.remove_attribute("beam.with");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBeamedWith::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("beam.with"):
+            if (std::strcmp(name, "beam.with") != 0) break;
+            this->SetBeamWith(StrToNeighboringlayer(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBeamedWith::WriteBeamedWith(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -285,19 +353,32 @@ void AttBeamingLog::ResetBeamingLog()
 bool AttBeamingLog::ReadBeamingLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.group")) {
-        this->SetBeamGroup(StrToStr(element.attribute("beam.group").value()));
-        if (removeAttr) element.remove_attribute("beam.group");
-        hasAttribute = true;
-    }
-    if (element.attribute("beam.rests")) {
-        this->SetBeamRests(StrToBoolean(element.attribute("beam.rests").value()));
-        if (removeAttr) element.remove_attribute("beam.rests");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBeamingLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("beam.group"):
+            if (std::strcmp(name, "beam.group") != 0) break;
+            this->SetBeamGroup(StrToStr(attr.value()));
+            return true;
+        case StrHash("beam.rests"):
+            if (std::strcmp(name, "beam.rests") != 0) break;
+            this->SetBeamRests(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBeamingLog::WriteBeamingLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -339,14 +420,28 @@ void AttBeatRptLog::ResetBeatRptLog()
 bool AttBeatRptLog::ReadBeatRptLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beatdef")) {
-        this->SetBeatdef(StrToDbl(element.attribute("beatdef").value()));
-        if (removeAttr) element.remove_attribute("beatdef");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBeatRptLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("beatdef"):
+            if (std::strcmp(name, "beatdef") != 0) break;
+            this->SetBeatdef(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBeatRptLog::WriteBeatRptLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -379,14 +474,28 @@ void AttBracketSpanLog::ResetBracketSpanLog()
 bool AttBracketSpanLog::ReadBracketSpanLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBracketSpanLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("func"):
+            if (std::strcmp(name, "func") != 0) break;
+            this->SetFunc(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBracketSpanLog::WriteBracketSpanLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -419,14 +528,28 @@ void AttCutout::ResetCutout()
 bool AttCutout::ReadCutout(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cutout")) {
-        this->SetCutout(StrToCutoutCutout(element.attribute("cutout").value()));
-        if (removeAttr) element.remove_attribute("cutout");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCutout::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("cutout"):
+            if (std::strcmp(name, "cutout") != 0) break;
+            this->SetCutout(StrToCutoutCutout(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCutout::WriteCutout(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -459,14 +582,28 @@ void AttExpandable::ResetExpandable()
 bool AttExpandable::ReadExpandable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("expand")) {
-        this->SetExpand(StrToBoolean(element.attribute("expand").value()));
-        if (removeAttr) element.remove_attribute("expand");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttExpandable::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("expand"):
+            if (std::strcmp(name, "expand") != 0) break;
+            this->SetExpand(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttExpandable::WriteExpandable(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -499,14 +636,28 @@ void AttGlissPresent::ResetGlissPresent()
 bool AttGlissPresent::ReadGlissPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("gliss")) {
-        this->SetGliss(StrToGlissando(element.attribute("gliss").value()));
-        if (removeAttr) element.remove_attribute("gliss");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttGlissPresent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("gliss"):
+            if (std::strcmp(name, "gliss") != 0) break;
+            this->SetGliss(StrToGlissando(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttGlissPresent::WriteGlissPresent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -539,14 +690,28 @@ void AttGraceGrpLog::ResetGraceGrpLog()
 bool AttGraceGrpLog::ReadGraceGrpLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("attach")) {
-        this->SetAttach(StrToGraceGrpLogAttach(element.attribute("attach").value()));
-        if (removeAttr) element.remove_attribute("attach");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttGraceGrpLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("attach"):
+            if (std::strcmp(name, "attach") != 0) break;
+            this->SetAttach(StrToGraceGrpLogAttach(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttGraceGrpLog::WriteGraceGrpLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -580,19 +745,32 @@ void AttGraced::ResetGraced()
 bool AttGraced::ReadGraced(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("grace")) {
-        this->SetGrace(StrToGrace(element.attribute("grace").value()));
-        if (removeAttr) element.remove_attribute("grace");
-        hasAttribute = true;
-    }
-    if (element.attribute("grace.time")) {
-        this->SetGraceTime(StrToPercent(element.attribute("grace.time").value()));
-        if (removeAttr) element.remove_attribute("grace.time");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttGraced::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("grace"):
+            if (std::strcmp(name, "grace") != 0) break;
+            this->SetGrace(StrToGrace(attr.value()));
+            return true;
+        case StrHash("grace.time"):
+            if (std::strcmp(name, "grace.time") != 0) break;
+            this->SetGraceTime(StrToPercent(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttGraced::WriteGraced(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -635,19 +813,32 @@ void AttHairpinLog::ResetHairpinLog()
 bool AttHairpinLog::ReadHairpinLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHairpinLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("niente")) {
-        this->SetNiente(StrToBoolean(element.attribute("niente").value()));
-        if (removeAttr) element.remove_attribute("niente");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttHairpinLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToHairpinLogForm(attr.value()));
+            return true;
+        case StrHash("niente"):
+            if (std::strcmp(name, "niente") != 0) break;
+            this->SetNiente(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttHairpinLog::WriteHairpinLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -695,44 +886,52 @@ void AttHarpPedalLog::ResetHarpPedalLog()
 bool AttHarpPedalLog::ReadHarpPedalLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("c")) {
-        this->SetC(StrToHarpPedalLogC(element.attribute("c").value()));
-        if (removeAttr) element.remove_attribute("c");
-        hasAttribute = true;
-    }
-    if (element.attribute("d")) {
-        this->SetD(StrToHarpPedalLogD(element.attribute("d").value()));
-        if (removeAttr) element.remove_attribute("d");
-        hasAttribute = true;
-    }
-    if (element.attribute("e")) {
-        this->SetE(StrToHarpPedalLogE(element.attribute("e").value()));
-        if (removeAttr) element.remove_attribute("e");
-        hasAttribute = true;
-    }
-    if (element.attribute("f")) {
-        this->SetF(StrToHarpPedalLogF(element.attribute("f").value()));
-        if (removeAttr) element.remove_attribute("f");
-        hasAttribute = true;
-    }
-    if (element.attribute("g")) {
-        this->SetG(StrToHarpPedalLogG(element.attribute("g").value()));
-        if (removeAttr) element.remove_attribute("g");
-        hasAttribute = true;
-    }
-    if (element.attribute("a")) {
-        this->SetA(StrToHarpPedalLogA(element.attribute("a").value()));
-        if (removeAttr) element.remove_attribute("a");
-        hasAttribute = true;
-    }
-    if (element.attribute("b")) {
-        this->SetB(StrToHarpPedalLogB(element.attribute("b").value()));
-        if (removeAttr) element.remove_attribute("b");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttHarpPedalLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("c"):
+            if (std::strcmp(name, "c") != 0) break;
+            this->SetC(StrToHarpPedalLogC(attr.value()));
+            return true;
+        case StrHash("d"):
+            if (std::strcmp(name, "d") != 0) break;
+            this->SetD(StrToHarpPedalLogD(attr.value()));
+            return true;
+        case StrHash("e"):
+            if (std::strcmp(name, "e") != 0) break;
+            this->SetE(StrToHarpPedalLogE(attr.value()));
+            return true;
+        case StrHash("f"):
+            if (std::strcmp(name, "f") != 0) break;
+            this->SetF(StrToHarpPedalLogF(attr.value()));
+            return true;
+        case StrHash("g"):
+            if (std::strcmp(name, "g") != 0) break;
+            this->SetG(StrToHarpPedalLogG(attr.value()));
+            return true;
+        case StrHash("a"):
+            if (std::strcmp(name, "a") != 0) break;
+            this->SetA(StrToHarpPedalLogA(attr.value()));
+            return true;
+        case StrHash("b"):
+            if (std::strcmp(name, "b") != 0) break;
+            this->SetB(StrToHarpPedalLogB(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttHarpPedalLog::WriteHarpPedalLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -819,14 +1018,28 @@ void AttLvPresent::ResetLvPresent()
 bool AttLvPresent::ReadLvPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lv")) {
-        this->SetLv(StrToBoolean(element.attribute("lv").value()));
-        if (removeAttr) element.remove_attribute("lv");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLvPresent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("lv"):
+            if (std::strcmp(name, "lv") != 0) break;
+            this->SetLv(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLvPresent::WriteLvPresent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -860,19 +1073,32 @@ void AttMeasureLog::ResetMeasureLog()
 bool AttMeasureLog::ReadMeasureLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("left")) {
-        this->SetLeft(StrToBarrendition(element.attribute("left").value()));
-        if (removeAttr) element.remove_attribute("left");
-        hasAttribute = true;
-    }
-    if (element.attribute("right")) {
-        this->SetRight(StrToBarrendition(element.attribute("right").value()));
-        if (removeAttr) element.remove_attribute("right");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMeasureLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("left"):
+            if (std::strcmp(name, "left") != 0) break;
+            this->SetLeft(StrToBarrendition(attr.value()));
+            return true;
+        case StrHash("right"):
+            if (std::strcmp(name, "right") != 0) break;
+            this->SetRight(StrToBarrendition(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMeasureLog::WriteMeasureLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -914,14 +1140,28 @@ void AttMeterSigGrpLog::ResetMeterSigGrpLog()
 bool AttMeterSigGrpLog::ReadMeterSigGrpLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToMeterSigGrpLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMeterSigGrpLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("func"):
+            if (std::strcmp(name, "func") != 0) break;
+            this->SetFunc(StrToMeterSigGrpLogFunc(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMeterSigGrpLog::WriteMeterSigGrpLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -955,19 +1195,32 @@ void AttNumberPlacement::ResetNumberPlacement()
 bool AttNumberPlacement::ReadNumberPlacement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num.place")) {
-        this->SetNumPlace(StrToStaffrelBasic(element.attribute("num.place").value()));
-        if (removeAttr) element.remove_attribute("num.place");
-        hasAttribute = true;
-    }
-    if (element.attribute("num.visible")) {
-        this->SetNumVisible(StrToBoolean(element.attribute("num.visible").value()));
-        if (removeAttr) element.remove_attribute("num.visible");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNumberPlacement::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("num.place"):
+            if (std::strcmp(name, "num.place") != 0) break;
+            this->SetNumPlace(StrToStaffrelBasic(attr.value()));
+            return true;
+        case StrHash("num.visible"):
+            if (std::strcmp(name, "num.visible") != 0) break;
+            this->SetNumVisible(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNumberPlacement::WriteNumberPlacement(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1009,14 +1262,28 @@ void AttNumbered::ResetNumbered()
 bool AttNumbered::ReadNumbered(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        if (removeAttr) element.remove_attribute("num");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNumbered::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("num"):
+            if (std::strcmp(name, "num") != 0) break;
+            this->SetNum(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNumbered::WriteNumbered(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1049,14 +1316,28 @@ void AttOctaveLog::ResetOctaveLog()
 bool AttOctaveLog::ReadOctaveLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coll")) {
-        this->SetColl(StrToOctaveLogColl(element.attribute("coll").value()));
-        if (removeAttr) element.remove_attribute("coll");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOctaveLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("coll"):
+            if (std::strcmp(name, "coll") != 0) break;
+            this->SetColl(StrToOctaveLogColl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOctaveLog::WriteOctaveLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1090,19 +1371,32 @@ void AttPedalLog::ResetPedalLog()
 bool AttPedalLog::ReadPedalLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir")) {
-        this->SetDir(StrToPedalLogDir(element.attribute("dir").value()));
-        if (removeAttr) element.remove_attribute("dir");
-        hasAttribute = true;
-    }
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPedalLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dir"):
+            if (std::strcmp(name, "dir") != 0) break;
+            this->SetDir(StrToPedalLogDir(attr.value()));
+            return true;
+        case StrHash("func"):
+            if (std::strcmp(name, "func") != 0) break;
+            this->SetFunc(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPedalLog::WritePedalLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1144,14 +1438,28 @@ void AttPianoPedals::ResetPianoPedals()
 bool AttPianoPedals::ReadPianoPedals(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pedal.style")) {
-        this->SetPedalStyle(StrToPedalstyle(element.attribute("pedal.style").value()));
-        if (removeAttr) element.remove_attribute("pedal.style");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPianoPedals::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("pedal.style"):
+            if (std::strcmp(name, "pedal.style") != 0) break;
+            this->SetPedalStyle(StrToPedalstyle(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPianoPedals::WritePianoPedals(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1184,14 +1492,28 @@ void AttRehearsal::ResetRehearsal()
 bool AttRehearsal::ReadRehearsal(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("reh.enclose")) {
-        this->SetRehEnclose(StrToRehearsalRehenclose(element.attribute("reh.enclose").value()));
-        if (removeAttr) element.remove_attribute("reh.enclose");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttRehearsal::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("reh.enclose"):
+            if (std::strcmp(name, "reh.enclose") != 0) break;
+            this->SetRehEnclose(StrToRehearsalRehenclose(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttRehearsal::WriteRehearsal(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1225,19 +1547,32 @@ void AttSlurRend::ResetSlurRend()
 bool AttSlurRend::ReadSlurRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur.lform")) {
-        this->SetSlurLform(StrToLineform(element.attribute("slur.lform").value()));
-        if (removeAttr) element.remove_attribute("slur.lform");
-        hasAttribute = true;
-    }
-    if (element.attribute("slur.lwidth")) {
-        this->SetSlurLwidth(StrToLinewidth(element.attribute("slur.lwidth").value()));
-        if (removeAttr) element.remove_attribute("slur.lwidth");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSlurRend::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("slur.lform"):
+            if (std::strcmp(name, "slur.lform") != 0) break;
+            this->SetSlurLform(StrToLineform(attr.value()));
+            return true;
+        case StrHash("slur.lwidth"):
+            if (std::strcmp(name, "slur.lwidth") != 0) break;
+            this->SetSlurLwidth(StrToLinewidth(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSlurRend::WriteSlurRend(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1279,14 +1614,28 @@ void AttStemsCmn::ResetStemsCmn()
 bool AttStemsCmn::ReadStemsCmn(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.with")) {
-        this->SetStemWith(StrToNeighboringlayer(element.attribute("stem.with").value()));
-        if (removeAttr) element.remove_attribute("stem.with");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStemsCmn::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("stem.with"):
+            if (std::strcmp(name, "stem.with") != 0) break;
+            this->SetStemWith(StrToNeighboringlayer(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStemsCmn::WriteStemsCmn(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1320,19 +1669,32 @@ void AttTieRend::ResetTieRend()
 bool AttTieRend::ReadTieRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie.lform")) {
-        this->SetTieLform(StrToLineform(element.attribute("tie.lform").value()));
-        if (removeAttr) element.remove_attribute("tie.lform");
-        hasAttribute = true;
-    }
-    if (element.attribute("tie.lwidth")) {
-        this->SetTieLwidth(StrToLinewidth(element.attribute("tie.lwidth").value()));
-        if (removeAttr) element.remove_attribute("tie.lwidth");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTieRend::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("tie.lform"):
+            if (std::strcmp(name, "tie.lform") != 0) break;
+            this->SetTieLform(StrToLineform(attr.value()));
+            return true;
+        case StrHash("tie.lwidth"):
+            if (std::strcmp(name, "tie.lwidth") != 0) break;
+            this->SetTieLwidth(StrToLinewidth(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTieRend::WriteTieRend(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1374,14 +1736,28 @@ void AttTremForm::ResetTremForm()
 bool AttTremForm::ReadTremForm(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToTremFormForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTremForm::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToTremFormForm(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTremForm::WriteTremForm(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1414,14 +1790,28 @@ void AttTremMeasured::ResetTremMeasured()
 bool AttTremMeasured::ReadTremMeasured(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("unitdur")) {
-        this->SetUnitdur(StrToDuration(element.attribute("unitdur").value()));
-        if (removeAttr) element.remove_attribute("unitdur");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTremMeasured::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("unitdur"):
+            if (std::strcmp(name, "unitdur") != 0) break;
+            this->SetUnitdur(StrToDuration(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTremMeasured::WriteTremMeasured(pugi::xml_node element)
 {
     bool wroteAttribute = false;
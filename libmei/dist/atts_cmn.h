@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadArpegLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteArpegLog(pugi::xml_node element);
 
@@ -90,6 +93,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBeamPresent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBeamPresent(pugi::xml_node element);
 
@@ -139,6 +145,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBeamRend(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBeamRend(pugi::xml_node element);
 
@@ -206,6 +215,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBeamSecondary(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBeamSecondary(pugi::xml_node element);
 
@@ -260,6 +272,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBeamedWith(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBeamedWith(pugi::xml_node element);
 
@@ -313,6 +328,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBeamingLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBeamingLog(pugi::xml_node element);
 
@@ -374,6 +392,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBeatRptLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBeatRptLog(pugi::xml_node element);
 
@@ -426,6 +447,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBracketSpanLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBracketSpanLog(pugi::xml_node element);
 
@@ -475,6 +499,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCutout(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCutout(pugi::xml_node element);
 
@@ -524,6 +551,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadExpandable(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteExpandable(pugi::xml_node element);
 
@@ -578,6 +608,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadGlissPresent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteGlissPresent(pugi::xml_node element);
 
@@ -631,6 +664,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadGraceGrpLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteGraceGrpLog(pugi::xml_node element);
 
@@ -684,6 +720,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadGraced(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteGraced(pugi::xml_node element);
 
@@ -742,6 +781,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadHairpinLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteHairpinLog(pugi::xml_node element);
 
@@ -801,6 +843,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadHarpPedalLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteHarpPedalLog(pugi::xml_node element);
 
@@ -886,6 +931,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLvPresent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLvPresent(pugi::xml_node element);
 
@@ -938,6 +986,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMeasureLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMeasureLog(pugi::xml_node element);
 
@@ -997,6 +1048,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMeterSigGrpLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMeterSigGrpLog(pugi::xml_node element);
 
@@ -1046,6 +1100,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadNumberPlacement(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteNumberPlacement(pugi::xml_node element);
 
@@ -1101,6 +1158,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadNumbered(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteNumbered(pugi::xml_node element);
 
@@ -1150,6 +1210,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOctaveLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOctaveLog(pugi::xml_node element);
 
@@ -1205,6 +1268,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPedalLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePedalLog(pugi::xml_node element);
 
@@ -1260,6 +1326,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPianoPedals(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePianoPedals(pugi::xml_node element);
 
@@ -1309,6 +1378,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadRehearsal(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteRehearsal(pugi::xml_node element);
 
@@ -1358,6 +1430,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSlurRend(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSlurRend(pugi::xml_node element);
 
@@ -1415,6 +1490,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStemsCmn(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStemsCmn(pugi::xml_node element);
 
@@ -1468,6 +1546,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTieRend(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTieRend(pugi::xml_node element);
 
@@ -1525,6 +1606,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTremForm(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTremForm(pugi::xml_node element);
 
@@ -1574,6 +1658,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTremMeasured(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTremMeasured(pugi::xml_node element);
 
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -40,19 +41,32 @@ void AttMordentLog::ResetMordentLog()
 bool AttMordentLog::ReadMordentLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMordentLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("long")) {
-        this->SetLong(StrToBoolean(element.attribute("long").value()));
-        if (removeAttr) element.remove_attribute("long");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMordentLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToMordentLogForm(attr.value()));
+            return true;
+        case StrHash("long"):
+            if (std::strcmp(name, "long") != 0) break;
+            this->SetLong(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMordentLog::WriteMordentLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -94,14 +108,28 @@ void AttOrnamPresent::ResetOrnamPresent()
 bool AttOrnamPresent::ReadOrnamPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ornam")) {
-        this->SetOrnam(StrToStr(element.attribute("ornam").value()));
-        if (removeAttr) element.remove_attribute("ornam");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOrnamPresent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("ornam"):
+            if (std::strcmp(name, "ornam") != 0) break;
+            this->SetOrnam(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOrnamPresent::WriteOrnamPresent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -135,19 +163,32 @@ void AttOrnamentAccid::ResetOrnamentAccid()
 bool AttOrnamentAccid::ReadOrnamentAccid(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accidupper")) {
-        this->SetAccidupper(StrToAccidentalWritten(element.attribute("accidupper").value()));
-        if (removeAttr) element.remove_attribute("accidupper");
-        hasAttribute = true;
-    }
-    if (element.attribute("accidlower")) {
-        this->SetAccidlower(StrToAccidentalWritten(element.attribute("accidlower").value()));
-        if (removeAttr) element.remove_attribute("accidlower");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOrnamentAccid::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("accidupper"):
+            if (std::strcmp(name, "accidupper") != 0) break;
+            this->SetAccidupper(StrToAccidentalWritten(attr.value()));
+            return true;
+        case StrHash("accidlower"):
+            if (std::strcmp(name, "accidlower") != 0) break;
+            this->SetAccidlower(StrToAccidentalWritten(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOrnamentAccid::WriteOrnamentAccid(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -190,19 +231,32 @@ void AttTurnLog::ResetTurnLog()
 bool AttTurnLog::ReadTurnLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("delayed")) {
-        this->SetDelayed(StrToBoolean(element.attribute("delayed").value()));
-        if (removeAttr) element.remove_attribute("delayed");
-        hasAttribute = true;
-    }
-    if (element.attribute("form")) {
-        this->SetForm(StrToTurnLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTurnLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("delayed"):
+            if (std::strcmp(name, "delayed") != 0) break;
+            this->SetDelayed(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToTurnLogForm(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTurnLog::WriteTurnLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
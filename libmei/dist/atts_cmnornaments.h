@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMordentLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMordentLog(pugi::xml_node element);
 
@@ -99,6 +102,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOrnamPresent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOrnamPresent(pugi::xml_node element);
 
@@ -152,6 +158,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOrnamentAccid(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOrnamentAccid(pugi::xml_node element);
 
@@ -207,6 +216,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTurnLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTurnLog(pugi::xml_node element);
 
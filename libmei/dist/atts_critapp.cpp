@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttCrit::ResetCrit()
 bool AttCrit::ReadCrit(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cause")) {
-        this->SetCause(StrToStr(element.attribute("cause").value()));
-        if (removeAttr) element.remove_attribute("cause");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCrit::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("cause"):
+            if (std::strcmp(name, "cause") != 0) break;
+            this->SetCause(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCrit::WriteCrit(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttAgentIdent::ResetAgentIdent()
 bool AttAgentIdent::ReadAgentIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("agent")) {
-        this->SetAgent(StrToStr(element.attribute("agent").value()));
-        if (removeAttr) element.remove_attribute("agent");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAgentIdent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("agent"):
+            if (std::strcmp(name, "agent") != 0) break;
+            this->SetAgent(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAgentIdent::WriteAgentIdent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -79,14 +94,28 @@ void AttReasonIdent::ResetReasonIdent()
 bool AttReasonIdent::ReadReasonIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("reason")) {
-        this->SetReason(StrToStr(element.attribute("reason").value()));
-        if (removeAttr) element.remove_attribute("reason");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttReasonIdent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("reason"):
+            if (std::strcmp(name, "reason") != 0) break;
+            this->SetReason(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttReasonIdent::WriteReasonIdent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAgentIdent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAgentIdent(pugi::xml_node element);
 
@@ -93,6 +96,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadReasonIdent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteReasonIdent(pugi::xml_node element);
 
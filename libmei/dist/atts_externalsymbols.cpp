@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -40,19 +41,32 @@ void AttExtSymAuth::ResetExtSymAuth()
 bool AttExtSymAuth::ReadExtSymAuth(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("glyph.auth")) {
-        this->SetGlyphAuth(StrToStr(element.attribute("glyph.auth").value()));
-        if (removeAttr) element.remove_attribute("glyph.auth");
-        hasAttribute = true;
-    }
-    if (element.attribute("glyph.uri")) {
-        this->SetGlyphUri(StrToStr(element.attribute("glyph.uri").value()));
-        if (removeAttr) element.remove_attribute("glyph.uri");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttExtSymAuth::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("glyph.auth"):
+            if (std::strcmp(name, "glyph.auth") != 0) break;
+            this->SetGlyphAuth(StrToStr(attr.value()));
+            return true;
+        case StrHash("glyph.uri"):
+            if (std::strcmp(name, "glyph.uri") != 0) break;
+            this->SetGlyphUri(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttExtSymAuth::WriteExtSymAuth(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -95,19 +109,32 @@ void AttExtSymNames::ResetExtSymNames()
 bool AttExtSymNames::ReadExtSymNames(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("glyph.name")) {
-        this->SetGlyphName(StrToStr(element.attribute("glyph.name").value()));
-        if (removeAttr) element.remove_attribute("glyph.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("glyph.num")) {
-        this->SetGlyphNum(StrToHexnum(element.attribute("glyph.num").value()));
-        if (removeAttr) element.remove_attribute("glyph.num");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttExtSymNames::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("glyph.name"):
+            if (std::strcmp(name, "glyph.name") != 0) break;
+            this->SetGlyphName(StrToStr(attr.value()));
+            return true;
+        case StrHash("glyph.num"):
+            if (std::strcmp(name, "glyph.num") != 0) break;
+            this->SetGlyphNum(StrToHexnum(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttExtSymNames::WriteExtSymNames(pugi::xml_node element)
 {
     bool wroteAttribute = false;
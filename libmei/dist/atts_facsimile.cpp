@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttFacsimile::ResetFacsimile()
 bool AttFacsimile::ReadFacsimile(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("facs")) {
-        this->SetFacs(StrToStr(element.attribute("facs").value()));
-        if (removeAttr) element.remove_attribute("facs");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttFacsimile::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("facs"):
+            if (std::strcmp(name, "facs") != 0) break;
+            this->SetFacs(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttFacsimile::WriteFacsimile(pugi::xml_node element)
 {
     bool wroteAttribute = false;
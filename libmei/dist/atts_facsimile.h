@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadFacsimile(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteFacsimile(pugi::xml_node element);
 
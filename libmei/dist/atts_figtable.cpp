@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -40,19 +41,32 @@ void AttTabular::ResetTabular()
 bool AttTabular::ReadTabular(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("colspan")) {
-        this->SetColspan(StrToInt(element.attribute("colspan").value()));
-        if (removeAttr) element.remove_attribute("colspan");
-        hasAttribute = true;
-    }
-    if (element.attribute("rowspan")) {
-        this->SetRowspan(StrToInt(element.attribute("rowspan").value()));
-        if (removeAttr) element.remove_attribute("rowspan");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTabular::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("colspan"):
+            if (std::strcmp(name, "colspan") != 0) break;
+            this->SetColspan(StrToInt(attr.value()));
+            return true;
+        case StrHash("rowspan"):
+            if (std::strcmp(name, "rowspan") != 0) break;
+            this->SetRowspan(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTabular::WriteTabular(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttFingGrpLog::ResetFingGrpLog()
 bool AttFingGrpLog::ReadFingGrpLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFingGrpLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttFingGrpLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToFingGrpLogForm(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttFingGrpLog::WriteFingGrpLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
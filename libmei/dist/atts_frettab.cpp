@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttCourseLog::ResetCourseLog()
 bool AttCourseLog::ReadCourseLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tuning.standard")) {
-        this->SetTuningStandard(StrToCoursetuning(element.attribute("tuning.standard").value()));
-        if (removeAttr) element.remove_attribute("tuning.standard");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCourseLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("tuning.standard"):
+            if (std::strcmp(name, "tuning.standard") != 0) break;
+            this->SetTuningStandard(StrToCoursetuning(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCourseLog::WriteCourseLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -80,19 +95,32 @@ void AttNoteGesTab::ResetNoteGesTab()
 bool AttNoteGesTab::ReadNoteGesTab(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tab.course")) {
-        this->SetTabCourse(StrToInt(element.attribute("tab.course").value()));
-        if (removeAttr) element.remove_attribute("tab.course");
-        hasAttribute = true;
-    }
-    if (element.attribute("tab.fret")) {
-        this->SetTabFret(StrToInt(element.attribute("tab.fret").value()));
-        if (removeAttr) element.remove_attribute("tab.fret");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNoteGesTab::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("tab.course"):
+            if (std::strcmp(name, "tab.course") != 0) break;
+            this->SetTabCourse(StrToInt(attr.value()));
+            return true;
+        case StrHash("tab.fret"):
+            if (std::strcmp(name, "tab.fret") != 0) break;
+            this->SetTabFret(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNoteGesTab::WriteNoteGesTab(pugi::xml_node element)
 {
     bool wroteAttribute = false;
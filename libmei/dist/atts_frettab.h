@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCourseLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCourseLog(pugi::xml_node element);
 
@@ -90,6 +93,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadNoteGesTab(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteNoteGesTab(pugi::xml_node element);
 
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttAccidentalGes::ResetAccidentalGes()
 bool AttAccidentalGes::ReadAccidentalGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid.ges")) {
-        this->SetAccidGes(StrToAccidentalGestural(element.attribute("accid.ges").value()));
-        if (removeAttr) element.remove_attribute("accid.ges");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAccidentalGes::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("accid.ges"):
+            if (std::strcmp(name, "accid.ges") != 0) break;
+            this->SetAccidGes(StrToAccidentalGestural(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAccidentalGes::WriteAccidentalGes(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -79,14 +94,28 @@ void AttArticulationGes::ResetArticulationGes()
 bool AttArticulationGes::ReadArticulationGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic.ges")) {
-        this->SetArticGes(StrToArticulationList(element.attribute("artic.ges").value()));
-        if (removeAttr) element.remove_attribute("artic.ges");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttArticulationGes::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("artic.ges"):
+            if (std::strcmp(name, "artic.ges") != 0) break;
+            this->SetArticGes(StrToArticulationList(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttArticulationGes::WriteArticulationGes(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -119,14 +148,28 @@ void AttAttacking::ResetAttacking()
 bool AttAttacking::ReadAttacking(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("attacca")) {
-        this->SetAttacca(StrToBoolean(element.attribute("attacca").value()));
-        if (removeAttr) element.remove_attribute("attacca");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAttacking::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("attacca"):
+            if (std::strcmp(name, "attacca") != 0) break;
+            this->SetAttacca(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAttacking::WriteAttacking(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -159,14 +202,28 @@ void AttBendGes::ResetBendGes()
 bool AttBendGes::ReadBendGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("amount")) {
-        this->SetAmount(StrToDbl(element.attribute("amount").value()));
-        if (removeAttr) element.remove_attribute("amount");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBendGes::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("amount"):
+            if (std::strcmp(name, "amount") != 0) break;
+            this->SetAmount(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBendGes::WriteBendGes(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -204,39 +261,48 @@ void AttDurationGes::ResetDurationGes()
 bool AttDurationGes::ReadDurationGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.ges")) {
-        this->SetDurGes(StrToDuration(element.attribute("dur.ges").value()));
-        if (removeAttr) element.remove_attribute("dur.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("dots.ges")) {
-        this->SetDotsGes(StrToInt(element.attribute("dots.ges").value()));
-        if (removeAttr) element.remove_attribute("dots.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.metrical")) {
-        this->SetDurMetrical(StrToDbl(element.attribute("dur.metrical").value()));
-        if (removeAttr) element.remove_attribute("dur.metrical");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.ppq")) {
-        this->SetDurPpq(StrToInt(element.attribute("dur.ppq").value()));
-        if (removeAttr) element.remove_attribute("dur.ppq");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.real")) {
-        this->SetDurReal(StrToDbl(element.attribute("dur.real").value()));
-        if (removeAttr) element.remove_attribute("dur.real");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.recip")) {
-        this->SetDurRecip(StrToStr(element.attribute("dur.recip").value()));
-        if (removeAttr) element.remove_attribute("dur.recip");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttDurationGes::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dur.ges"):
+            if (std::strcmp(name, "dur.ges") != 0) break;
+            this->SetDurGes(StrToDuration(attr.value()));
+            return true;
+        case StrHash("dots.ges"):
+            if (std::strcmp(name, "dots.ges") != 0) break;
+            this->SetDotsGes(StrToInt(attr.value()));
+            return true;
+        case StrHash("dur.metrical"):
+            if (std::strcmp(name, "dur.metrical") != 0) break;
+            this->SetDurMetrical(StrToDbl(attr.value()));
+            return true;
+        case StrHash("dur.ppq"):
+            if (std::strcmp(name, "dur.ppq") != 0) break;
+            this->SetDurPpq(StrToInt(attr.value()));
+            return true;
+        case StrHash("dur.real"):
+            if (std::strcmp(name, "dur.real") != 0) break;
+            this->SetDurReal(StrToDbl(attr.value()));
+            return true;
+        case StrHash("dur.recip"):
+            if (std::strcmp(name, "dur.recip") != 0) break;
+            this->SetDurRecip(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttDurationGes::WriteDurationGes(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -314,14 +380,28 @@ void AttNoteGes::ResetNoteGes()
 bool AttNoteGes::ReadNoteGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extremis")) {
-        this->SetExtremis(StrToNoteGesExtremis(element.attribute("extremis").value()));
-        if (removeAttr) element.remove_attribute("extremis");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNoteGes::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("extremis"):
+            if (std::strcmp(name, "extremis") != 0) break;
+            this->SetExtremis(StrToNoteGesExtremis(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNoteGes::WriteNoteGes(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -355,19 +435,32 @@ void AttOrnamentAccidGes::ResetOrnamentAccidGes()
 bool AttOrnamentAccidGes::ReadOrnamentAccidGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accidupper.ges")) {
-        this->SetAccidupperGes(StrToAccidentalGestural(element.attribute("accidupper.ges").value()));
-        if (removeAttr) element.remove_attribute("accidupper.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("accidlower.ges")) {
-        this->SetAccidlowerGes(StrToAccidentalGestural(element.attribute("accidlower.ges").value()));
-        if (removeAttr) element.remove_attribute("accidlower.ges");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOrnamentAccidGes::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("accidupper.ges"):
+            if (std::strcmp(name, "accidupper.ges") != 0) break;
+            this->SetAccidupperGes(StrToAccidentalGestural(attr.value()));
+            return true;
+        case StrHash("accidlower.ges"):
+            if (std::strcmp(name, "accidlower.ges") != 0) break;
+            this->SetAccidlowerGes(StrToAccidentalGestural(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOrnamentAccidGes::WriteOrnamentAccidGes(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -411,24 +504,36 @@ void AttPitchGes::ResetPitchGes()
 bool AttPitchGes::ReadPitchGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct.ges")) {
-        this->SetOctGes(StrToOctave(element.attribute("oct.ges").value()));
-        if (removeAttr) element.remove_attribute("oct.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("pname.ges")) {
-        this->SetPnameGes(StrToPitchname(element.attribute("pname.ges").value()));
-        if (removeAttr) element.remove_attribute("pname.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("pnum")) {
-        this->SetPnum(StrToInt(element.attribute("pnum").value()));
-        if (removeAttr) element.remove_attribute("pnum");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPitchGes::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("oct.ges"):
+            if (std::strcmp(name, "oct.ges") != 0) break;
+            this->SetOctGes(StrToOctave(attr.value()));
+            return true;
+        case StrHash("pname.ges"):
+            if (std::strcmp(name, "pname.ges") != 0) break;
+            this->SetPnameGes(StrToPitchname(attr.value()));
+            return true;
+        case StrHash("pnum"):
+            if (std::strcmp(name, "pnum") != 0) break;
+            this->SetPnum(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPitchGes::WritePitchGes(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -480,19 +585,32 @@ void AttSoundLocation::ResetSoundLocation()
 bool AttSoundLocation::ReadSoundLocation(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("azimuth")) {
-        this->SetAzimuth(StrToDbl(element.attribute("azimuth").value()));
-        if (removeAttr) element.remove_attribute("azimuth");
-        hasAttribute = true;
-    }
-    if (element.attribute("elevation")) {
-        this->SetElevation(StrToDbl(element.attribute("elevation").value()));
-        if (removeAttr) element.remove_attribute("elevation");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSoundLocation::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("azimuth"):
+            if (std::strcmp(name, "azimuth") != 0) break;
+            this->SetAzimuth(StrToDbl(attr.value()));
+            return true;
+        case StrHash("elevation"):
+            if (std::strcmp(name, "elevation") != 0) break;
+            this->SetElevation(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSoundLocation::WriteSoundLocation(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -535,19 +653,32 @@ void AttTimestampGes::ResetTimestampGes()
 bool AttTimestampGes::ReadTimestampGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp.ges")) {
-        this->SetTstampGes(StrToDbl(element.attribute("tstamp.ges").value()));
-        if (removeAttr) element.remove_attribute("tstamp.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("tstamp.real")) {
-        this->SetTstampReal(StrToStr(element.attribute("tstamp.real").value()));
-        if (removeAttr) element.remove_attribute("tstamp.real");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTimestampGes::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("tstamp.ges"):
+            if (std::strcmp(name, "tstamp.ges") != 0) break;
+            this->SetTstampGes(StrToDbl(attr.value()));
+            return true;
+        case StrHash("tstamp.real"):
+            if (std::strcmp(name, "tstamp.real") != 0) break;
+            this->SetTstampReal(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTimestampGes::WriteTimestampGes(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -590,19 +721,32 @@ void AttTimestamp2Ges::ResetTimestamp2Ges()
 bool AttTimestamp2Ges::ReadTimestamp2Ges(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp2.ges")) {
-        this->SetTstamp2Ges(StrToMeasurebeat(element.attribute("tstamp2.ges").value()));
-        if (removeAttr) element.remove_attribute("tstamp2.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("tstamp2.real")) {
-        this->SetTstamp2Real(StrToStr(element.attribute("tstamp2.real").value()));
-        if (removeAttr) element.remove_attribute("tstamp2.real");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTimestamp2Ges::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("tstamp2.ges"):
+            if (std::strcmp(name, "tstamp2.ges") != 0) break;
+            this->SetTstamp2Ges(StrToMeasurebeat(attr.value()));
+            return true;
+        case StrHash("tstamp2.real"):
+            if (std::strcmp(name, "tstamp2.real") != 0) break;
+            this->SetTstamp2Real(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTimestamp2Ges::WriteTimestamp2Ges(pugi::xml_node element)
 {
     bool wroteAttribute = false;
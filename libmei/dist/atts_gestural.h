@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAccidentalGes(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAccidentalGes(pugi::xml_node element);
 
@@ -90,6 +93,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadArticulationGes(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteArticulationGes(pugi::xml_node element);
 
@@ -139,6 +145,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAttacking(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAttacking(pugi::xml_node element);
 
@@ -191,6 +200,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBendGes(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBendGes(pugi::xml_node element);
 
@@ -244,6 +256,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadDurationGes(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteDurationGes(pugi::xml_node element);
 
@@ -329,6 +344,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadNoteGes(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteNoteGes(pugi::xml_node element);
 
@@ -378,6 +396,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOrnamentAccidGes(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOrnamentAccidGes(pugi::xml_node element);
 
@@ -433,6 +454,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPitchGes(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePitchGes(pugi::xml_node element);
 
@@ -494,6 +518,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSoundLocation(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSoundLocation(pugi::xml_node element);
 
@@ -549,6 +576,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTimestampGes(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTimestampGes(pugi::xml_node element);
 
@@ -607,6 +637,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTimestamp2Ges(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTimestamp2Ges(pugi::xml_node element);
 
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttHarmLog::ResetHarmLog()
 bool AttHarmLog::ReadHarmLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("chordref")) {
-        this->SetChordref(StrToStr(element.attribute("chordref").value()));
-        if (removeAttr) element.remove_attribute("chordref");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttHarmLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("chordref"):
+            if (std::strcmp(name, "chordref") != 0) break;
+            this->SetChordref(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttHarmLog::WriteHarmLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
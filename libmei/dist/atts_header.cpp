@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttAdlibitum::ResetAdlibitum()
 bool AttAdlibitum::ReadAdlibitum(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("adlib")) {
-        this->SetAdlib(StrToBoolean(element.attribute("adlib").value()));
-        if (removeAttr) element.remove_attribute("adlib");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAdlibitum::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("adlib"):
+            if (std::strcmp(name, "adlib") != 0) break;
+            this->SetAdlib(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAdlibitum::WriteAdlibitum(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -82,29 +97,40 @@ void AttBifoliumSurfaces::ResetBifoliumSurfaces()
 bool AttBifoliumSurfaces::ReadBifoliumSurfaces(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("outer.recto")) {
-        this->SetOuterRecto(StrToStr(element.attribute("outer.recto").value()));
-        if (removeAttr) element.remove_attribute("outer.recto");
-        hasAttribute = true;
-    }
-    if (element.attribute("inner.verso")) {
-        this->SetInnerVerso(StrToStr(element.attribute("inner.verso").value()));
-        if (removeAttr) element.remove_attribute("inner.verso");
-        hasAttribute = true;
-    }
-    if (element.attribute("inner.recto")) {
-        this->SetInnerRecto(StrToStr(element.attribute("inner.recto").value()));
-        if (removeAttr) element.remove_attribute("inner.recto");
-        hasAttribute = true;
-    }
-    if (element.attribute("outer.verso")) {
-        this->SetOuterVerso(StrToStr(element.attribute("outer.verso").value()));
-        if (removeAttr) element.remove_attribute("outer.verso");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBifoliumSurfaces::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("outer.recto"):
+            if (std::strcmp(name, "outer.recto") != 0) break;
+            this->SetOuterRecto(StrToStr(attr.value()));
+            return true;
+        case StrHash("inner.verso"):
+            if (std::strcmp(name, "inner.verso") != 0) break;
+            this->SetInnerVerso(StrToStr(attr.value()));
+            return true;
+        case StrHash("inner.recto"):
+            if (std::strcmp(name, "inner.recto") != 0) break;
+            this->SetInnerRecto(StrToStr(attr.value()));
+            return true;
+        case StrHash("outer.verso"):
+            if (std::strcmp(name, "outer.verso") != 0) break;
+            this->SetOuterVerso(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBifoliumSurfaces::WriteBifoliumSurfaces(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -165,19 +191,32 @@ void AttFoliumSurfaces::ResetFoliumSurfaces()
 bool AttFoliumSurfaces::ReadFoliumSurfaces(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("recto")) {
-        this->SetRecto(StrToStr(element.attribute("recto").value()));
-        if (removeAttr) element.remove_attribute("recto");
-        hasAttribute = true;
-    }
-    if (element.attribute("verso")) {
-        this->SetVerso(StrToStr(element.attribute("verso").value()));
-        if (removeAttr) element.remove_attribute("verso");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttFoliumSurfaces::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("recto"):
+            if (std::strcmp(name, "recto") != 0) break;
+            this->SetRecto(StrToStr(attr.value()));
+            return true;
+        case StrHash("verso"):
+            if (std::strcmp(name, "verso") != 0) break;
+            this->SetVerso(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttFoliumSurfaces::WriteFoliumSurfaces(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -219,14 +258,28 @@ void AttPerfRes::ResetPerfRes()
 bool AttPerfRes::ReadPerfRes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("solo")) {
-        this->SetSolo(StrToBoolean(element.attribute("solo").value()));
-        if (removeAttr) element.remove_attribute("solo");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPerfRes::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("solo"):
+            if (std::strcmp(name, "solo") != 0) break;
+            this->SetSolo(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPerfRes::WritePerfRes(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -259,14 +312,28 @@ void AttPerfResBasic::ResetPerfResBasic()
 bool AttPerfResBasic::ReadPerfResBasic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("count")) {
-        this->SetCount(StrToInt(element.attribute("count").value()));
-        if (removeAttr) element.remove_attribute("count");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPerfResBasic::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("count"):
+            if (std::strcmp(name, "count") != 0) break;
+            this->SetCount(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPerfResBasic::WritePerfResBasic(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -299,14 +366,28 @@ void AttRecordType::ResetRecordType()
 bool AttRecordType::ReadRecordType(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("recordtype")) {
-        this->SetRecordtype(StrToRecordTypeRecordtype(element.attribute("recordtype").value()));
-        if (removeAttr) element.remove_attribute("recordtype");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttRecordType::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("recordtype"):
+            if (std::strcmp(name, "recordtype") != 0) break;
+            this->SetRecordtype(StrToRecordTypeRecordtype(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttRecordType::WriteRecordType(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -339,14 +420,28 @@ void AttRegularMethod::ResetRegularMethod()
 bool AttRegularMethod::ReadRegularMethod(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("method")) {
-        this->SetMethod(StrToRegularMethodMethod(element.attribute("method").value()));
-        if (removeAttr) element.remove_attribute("method");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttRegularMethod::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("method"):
+            if (std::strcmp(name, "method") != 0) break;
+            this->SetMethod(StrToRegularMethodMethod(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttRegularMethod::WriteRegularMethod(pugi::xml_node element)
 {
     bool wroteAttribute = false;
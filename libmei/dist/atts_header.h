@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAdlibitum(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAdlibitum(pugi::xml_node element);
 
@@ -90,6 +93,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBifoliumSurfaces(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBifoliumSurfaces(pugi::xml_node element);
 
@@ -169,6 +175,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadFoliumSurfaces(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteFoliumSurfaces(pugi::xml_node element);
 
@@ -224,6 +233,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPerfRes(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePerfRes(pugi::xml_node element);
 
@@ -276,6 +288,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPerfResBasic(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePerfResBasic(pugi::xml_node element);
 
@@ -325,6 +340,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadRecordType(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteRecordType(pugi::xml_node element);
 
@@ -374,6 +392,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadRegularMethod(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteRegularMethod(pugi::xml_node element);
 
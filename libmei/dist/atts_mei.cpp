@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -40,19 +41,32 @@ void AttNotationType::ResetNotationType()
 bool AttNotationType::ReadNotationType(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("notationtype")) {
-        this->SetNotationtype(StrToNotationtype(element.attribute("notationtype").value()));
-        if (removeAttr) element.remove_attribute("notationtype");
-        hasAttribute = true;
-    }
-    if (element.attribute("notationsubtype")) {
-        this->SetNotationsubtype(StrToStr(element.attribute("notationsubtype").value()));
-        if (removeAttr) element.remove_attribute("notationsubtype");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNotationType::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("notationtype"):
+            if (std::strcmp(name, "notationtype") != 0) break;
+            this->SetNotationtype(StrToNotationtype(attr.value()));
+            return true;
+        case StrHash("notationsubtype"):
+            if (std::strcmp(name, "notationsubtype") != 0) break;
+            this->SetNotationsubtype(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNotationType::WriteNotationType(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttDurationQuality::ResetDurationQuality()
 bool AttDurationQuality::ReadDurationQuality(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.quality")) {
-        this->SetDurQuality(StrToDurqualityMensural(element.attribute("dur.quality").value()));
-        if (removeAttr) element.remove_attribute("dur.quality");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttDurationQuality::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dur.quality"):
+            if (std::strcmp(name, "dur.quality") != 0) break;
+            this->SetDurQuality(StrToDurqualityMensural(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttDurationQuality::WriteDurationQuality(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -80,19 +95,32 @@ void AttMensuralLog::ResetMensuralLog()
 bool AttMensuralLog::ReadMensuralLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("proport.num")) {
-        this->SetProportNum(StrToInt(element.attribute("proport.num").value()));
-        if (removeAttr) element.remove_attribute("proport.num");
-        hasAttribute = true;
-    }
-    if (element.attribute("proport.numbase")) {
-        this->SetProportNumbase(StrToInt(element.attribute("proport.numbase").value()));
-        if (removeAttr) element.remove_attribute("proport.numbase");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMensuralLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("proport.num"):
+            if (std::strcmp(name, "proport.num") != 0) break;
+            this->SetProportNum(StrToInt(attr.value()));
+            return true;
+        case StrHash("proport.numbase"):
+            if (std::strcmp(name, "proport.numbase") != 0) break;
+            this->SetProportNumbase(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMensuralLog::WriteMensuralLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -138,34 +166,44 @@ void AttMensuralShared::ResetMensuralShared()
 bool AttMensuralShared::ReadMensuralShared(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("modusmaior")) {
-        this->SetModusmaior(StrToModusmaior(element.attribute("modusmaior").value()));
-        if (removeAttr) element.remove_attribute("modusmaior");
-        hasAttribute = true;
-    }
-    if (element.attribute("modusminor")) {
-        this->SetModusminor(StrToModusminor(element.attribute("modusminor").value()));
-        if (removeAttr) element.remove_attribute("modusminor");
-        hasAttribute = true;
-    }
-    if (element.attribute("prolatio")) {
-        this->SetProlatio(StrToProlatio(element.attribute("prolatio").value()));
-        if (removeAttr) element.remove_attribute("prolatio");
-        hasAttribute = true;
-    }
-    if (element.attribute("tempus")) {
-        this->SetTempus(StrToTempus(element.attribute("tempus").value()));
-        if (removeAttr) element.remove_attribute("tempus");
-        hasAttribute = true;
-    }
-    if (element.attribute("divisio")) {
-        this->SetDivisio(StrToDivisio(element.attribute("divisio").value()));
-        if (removeAttr) element.remove_attribute("divisio");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMensuralShared::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("modusmaior"):
+            if (std::strcmp(name, "modusmaior") != 0) break;
+            this->SetModusmaior(StrToModusmaior(attr.value()));
+            return true;
+        case StrHash("modusminor"):
+            if (std::strcmp(name, "modusminor") != 0) break;
+            this->SetModusminor(StrToModusminor(attr.value()));
+            return true;
+        case StrHash("prolatio"):
+            if (std::strcmp(name, "prolatio") != 0) break;
+            this->SetProlatio(StrToProlatio(attr.value()));
+            return true;
+        case StrHash("tempus"):
+            if (std::strcmp(name, "tempus") != 0) break;
+            this->SetTempus(StrToTempus(attr.value()));
+            return true;
+        case StrHash("divisio"):
+            if (std::strcmp(name, "divisio") != 0) break;
+            this->SetDivisio(StrToDivisio(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMensuralShared::WriteMensuralShared(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -234,14 +272,28 @@ void AttNoteVisMensural::ResetNoteVisMensural()
 bool AttNoteVisMensural::ReadNoteVisMensural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lig")) {
-        this->SetLig(StrToLigatureform(element.attribute("lig").value()));
-        if (removeAttr) element.remove_attribute("lig");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNoteVisMensural::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("lig"):
+            if (std::strcmp(name, "lig") != 0) break;
+            this->SetLig(StrToLigatureform(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNoteVisMensural::WriteNoteVisMensural(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -274,14 +326,28 @@ void AttRestVisMensural::ResetRestVisMensural()
 bool AttRestVisMensural::ReadRestVisMensural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("spaces")) {
-        this->SetSpaces(StrToInt(element.attribute("spaces").value()));
-        if (removeAttr) element.remove_attribute("spaces");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttRestVisMensural::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("spaces"):
+            if (std::strcmp(name, "spaces") != 0) break;
+            this->SetSpaces(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttRestVisMensural::WriteRestVisMensural(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -314,14 +380,28 @@ void AttStemsMensural::ResetStemsMensural()
 bool AttStemsMensural::ReadStemsMensural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.form")) {
-        this->SetStemForm(StrToStemformMensural(element.attribute("stem.form").value()));
-        if (removeAttr) element.remove_attribute("stem.form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStemsMensural::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("stem.form"):
+            if (std::strcmp(name, "stem.form") != 0) break;
+            this->SetStemForm(StrToStemformMensural(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStemsMensural::WriteStemsMensural(pugi::xml_node element)
 {
     bool wroteAttribute = false;
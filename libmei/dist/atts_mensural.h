@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadDurationQuality(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteDurationQuality(pugi::xml_node element);
 
@@ -94,6 +97,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMensuralLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMensuralLog(pugi::xml_node element);
 
@@ -157,6 +163,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMensuralShared(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMensuralShared(pugi::xml_node element);
 
@@ -230,6 +239,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadNoteVisMensural(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteNoteVisMensural(pugi::xml_node element);
 
@@ -279,6 +291,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadRestVisMensural(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteRestVisMensural(pugi::xml_node element);
 
@@ -328,6 +343,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStemsMensural(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStemsMensural(pugi::xml_node element);
 
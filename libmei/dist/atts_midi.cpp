@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -42,29 +43,40 @@ void AttChannelized::ResetChannelized()
 bool AttChannelized::ReadChannelized(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.channel")) {
-        this->SetMidiChannel(StrToMidichannel(element.attribute("midi.channel").value()));
-        if (removeAttr) element.remove_attribute("midi.channel");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.duty")) {
-        this->SetMidiDuty(StrToPercentLimited(element.attribute("midi.duty").value()));
-        if (removeAttr) element.remove_attribute("midi.duty");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.port")) {
-        this->SetMidiPort(StrToMidivalueName(element.attribute("midi.port").value()));
-        if (removeAttr) element.remove_attribute("midi.port");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.track")) {
-        this->SetMidiTrack(StrToInt(element.attribute("midi.track").value()));
-        if (removeAttr) element.remove_attribute("midi.track");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttChannelized::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("midi.channel"):
+            if (std::strcmp(name, "midi.channel") != 0) break;
+            this->SetMidiChannel(StrToMidichannel(attr.value()));
+            return true;
+        case StrHash("midi.duty"):
+            if (std::strcmp(name, "midi.duty") != 0) break;
+            this->SetMidiDuty(StrToPercentLimited(attr.value()));
+            return true;
+        case StrHash("midi.port"):
+            if (std::strcmp(name, "midi.port") != 0) break;
+            this->SetMidiPort(StrToMidivalueName(attr.value()));
+            return true;
+        case StrHash("midi.track"):
+            if (std::strcmp(name, "midi.track") != 0) break;
+            this->SetMidiTrack(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttChannelized::WriteChannelized(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -124,14 +136,28 @@ void AttInstrumentIdent::ResetInstrumentIdent()
 bool AttInstrumentIdent::ReadInstrumentIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("instr")) {
-        this->SetInstr(StrToStr(element.attribute("instr").value()));
-        if (removeAttr) element.remove_attribute("instr");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttInstrumentIdent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("instr"):
+            if (std::strcmp(name, "instr") != 0) break;
+            this->SetInstr(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttInstrumentIdent::WriteInstrumentIdent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -169,39 +195,48 @@ void AttMidiInstrument::ResetMidiInstrument()
 bool AttMidiInstrument::ReadMidiInstrument(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.instrnum")) {
-        this->SetMidiInstrnum(StrToMidivalue(element.attribute("midi.instrnum").value()));
-        if (removeAttr) element.remove_attribute("midi.instrnum");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.instrname")) {
-        this->SetMidiInstrname(StrToMidinames(element.attribute("midi.instrname").value()));
-        if (removeAttr) element.remove_attribute("midi.instrname");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.pan")) {
-        this->SetMidiPan(StrToMidivaluePan(element.attribute("midi.pan").value()));
-        if (removeAttr) element.remove_attribute("midi.pan");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.patchname")) {
-        this->SetMidiPatchname(StrToStr(element.attribute("midi.patchname").value()));
-        if (removeAttr) element.remove_attribute("midi.patchname");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.patchnum")) {
-        this->SetMidiPatchnum(StrToMidivalue(element.attribute("midi.patchnum").value()));
-        if (removeAttr) element.remove_attribute("midi.patchnum");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.volume")) {
-        this->SetMidiVolume(StrToPercent(element.attribute("midi.volume").value()));
-        if (removeAttr) element.remove_attribute("midi.volume");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMidiInstrument::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("midi.instrnum"):
+            if (std::strcmp(name, "midi.instrnum") != 0) break;
+            this->SetMidiInstrnum(StrToMidivalue(attr.value()));
+            return true;
+        case StrHash("midi.instrname"):
+            if (std::strcmp(name, "midi.instrname") != 0) break;
+            this->SetMidiInstrname(StrToMidinames(attr.value()));
+            return true;
+        case StrHash("midi.pan"):
+            if (std::strcmp(name, "midi.pan") != 0) break;
+            this->SetMidiPan(StrToMidivaluePan(attr.value()));
+            return true;
+        case StrHash("midi.patchname"):
+            if (std::strcmp(name, "midi.patchname") != 0) break;
+            this->SetMidiPatchname(StrToStr(attr.value()));
+            return true;
+        case StrHash("midi.patchnum"):
+            if (std::strcmp(name, "midi.patchnum") != 0) break;
+            this->SetMidiPatchnum(StrToMidivalue(attr.value()));
+            return true;
+        case StrHash("midi.volume"):
+            if (std::strcmp(name, "midi.volume") != 0) break;
+            this->SetMidiVolume(StrToPercent(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMidiInstrument::WriteMidiInstrument(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -279,14 +314,28 @@ void AttMidiNumber::ResetMidiNumber()
 bool AttMidiNumber::ReadMidiNumber(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToMidivalue(element.attribute("num").value()));
-        if (removeAttr) element.remove_attribute("num");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMidiNumber::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("num"):
+            if (std::strcmp(name, "num") != 0) break;
+            this->SetNum(StrToMidivalue(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMidiNumber::WriteMidiNumber(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -320,19 +369,32 @@ void AttMidiTempo::ResetMidiTempo()
 bool AttMidiTempo::ReadMidiTempo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.bpm")) {
-        this->SetMidiBpm(StrToDbl(element.attribute("midi.bpm").value()));
-        if (removeAttr) element.remove_attribute("midi.bpm");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.mspb")) {
-        this->SetMidiMspb(StrToMidimspb(element.attribute("midi.mspb").value()));
-        if (removeAttr) element.remove_attribute("midi.mspb");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMidiTempo::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("midi.bpm"):
+            if (std::strcmp(name, "midi.bpm") != 0) break;
+            this->SetMidiBpm(StrToDbl(attr.value()));
+            return true;
+        case StrHash("midi.mspb"):
+            if (std::strcmp(name, "midi.mspb") != 0) break;
+            this->SetMidiMspb(StrToMidimspb(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMidiTempo::WriteMidiTempo(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -374,14 +436,28 @@ void AttMidiValue::ResetMidiValue()
 bool AttMidiValue::ReadMidiValue(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("val")) {
-        this->SetVal(StrToMidivalue(element.attribute("val").value()));
-        if (removeAttr) element.remove_attribute("val");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMidiValue::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("val"):
+            if (std::strcmp(name, "val") != 0) break;
+            this->SetVal(StrToMidivalue(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMidiValue::WriteMidiValue(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -414,14 +490,28 @@ void AttMidiValue2::ResetMidiValue2()
 bool AttMidiValue2::ReadMidiValue2(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("val2")) {
-        this->SetVal2(StrToMidivalue(element.attribute("val2").value()));
-        if (removeAttr) element.remove_attribute("val2");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMidiValue2::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("val2"):
+            if (std::strcmp(name, "val2") != 0) break;
+            this->SetVal2(StrToMidivalue(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMidiValue2::WriteMidiValue2(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -454,14 +544,28 @@ void AttMidiVelocity::ResetMidiVelocity()
 bool AttMidiVelocity::ReadMidiVelocity(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vel")) {
-        this->SetVel(StrToMidivalue(element.attribute("vel").value()));
-        if (removeAttr) element.remove_attribute("vel");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMidiVelocity::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("vel"):
+            if (std::strcmp(name, "vel") != 0) break;
+            this->SetVel(StrToMidivalue(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMidiVelocity::WriteMidiVelocity(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -494,14 +598,28 @@ void AttTimeBase::ResetTimeBase()
 bool AttTimeBase::ReadTimeBase(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ppq")) {
-        this->SetPpq(StrToInt(element.attribute("ppq").value()));
-        if (removeAttr) element.remove_attribute("ppq");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTimeBase::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("ppq"):
+            if (std::strcmp(name, "ppq") != 0) break;
+            this->SetPpq(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTimeBase::WriteTimeBase(pugi::xml_node element)
 {
     bool wroteAttribute = false;
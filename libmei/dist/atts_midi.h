@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadChannelized(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteChannelized(pugi::xml_node element);
 
@@ -108,6 +111,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadInstrumentIdent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteInstrumentIdent(pugi::xml_node element);
 
@@ -160,6 +166,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMidiInstrument(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMidiInstrument(pugi::xml_node element);
 
@@ -248,6 +257,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMidiNumber(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMidiNumber(pugi::xml_node element);
 
@@ -297,6 +309,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMidiTempo(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMidiTempo(pugi::xml_node element);
 
@@ -361,6 +376,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMidiValue(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMidiValue(pugi::xml_node element);
 
@@ -410,6 +428,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMidiValue2(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMidiValue2(pugi::xml_node element);
 
@@ -459,6 +480,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMidiVelocity(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMidiVelocity(pugi::xml_node element);
 
@@ -508,6 +532,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTimeBase(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTimeBase(pugi::xml_node element);
 
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttDivLineLog::ResetDivLineLog()
 bool AttDivLineLog::ReadDivLineLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToDivLineLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttDivLineLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToDivLineLogForm(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttDivLineLog::WriteDivLineLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -80,19 +95,32 @@ void AttNcLog::ResetNcLog()
 bool AttNcLog::ReadNcLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToStr(element.attribute("oct").value()));
-        if (removeAttr) element.remove_attribute("oct");
-        hasAttribute = true;
-    }
-    if (element.attribute("pname")) {
-        this->SetPname(StrToStr(element.attribute("pname").value()));
-        if (removeAttr) element.remove_attribute("pname");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNcLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("oct"):
+            if (std::strcmp(name, "oct") != 0) break;
+            this->SetOct(StrToStr(attr.value()));
+            return true;
+        case StrHash("pname"):
+            if (std::strcmp(name, "pname") != 0) break;
+            this->SetPname(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNcLog::WriteNcLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -140,44 +168,52 @@ void AttNcForm::ResetNcForm()
 bool AttNcForm::ReadNcForm(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("angled")) {
-        this->SetAngled(StrToBoolean(element.attribute("angled").value()));
-        if (removeAttr) element.remove_attribute("angled");
-        hasAttribute = true;
-    }
-    if (element.attribute("con")) {
-        this->SetCon(StrToNcFormCon(element.attribute("con").value()));
-        if (removeAttr) element.remove_attribute("con");
-        hasAttribute = true;
-    }
-    if (element.attribute("hooked")) {
-        this->SetHooked(StrToBoolean(element.attribute("hooked").value()));
-        if (removeAttr) element.remove_attribute("hooked");
-        hasAttribute = true;
-    }
-    if (element.attribute("ligated")) {
-        this->SetLigated(StrToBoolean(element.attribute("ligated").value()));
-        if (removeAttr) element.remove_attribute("ligated");
-        hasAttribute = true;
-    }
-    if (element.attribute("rellen")) {
-        this->SetRellen(StrToNcFormRellen(element.attribute("rellen").value()));
-        if (removeAttr) element.remove_attribute("rellen");
-        hasAttribute = true;
-    }
-    if (element.attribute("sShape")) {
-        this->SetSShape(StrToStr(element.attribute("sShape").value()));
-        if (removeAttr) element.remove_attribute("sShape");
-        hasAttribute = true;
-    }
-    if (element.attribute("tilt")) {
-        this->SetTilt(StrToCompassdirection(element.attribute("tilt").value()));
-        if (removeAttr) element.remove_attribute("tilt");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNcForm::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("angled"):
+            if (std::strcmp(name, "angled") != 0) break;
+            this->SetAngled(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("con"):
+            if (std::strcmp(name, "con") != 0) break;
+            this->SetCon(StrToNcFormCon(attr.value()));
+            return true;
+        case StrHash("hooked"):
+            if (std::strcmp(name, "hooked") != 0) break;
+            this->SetHooked(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("ligated"):
+            if (std::strcmp(name, "ligated") != 0) break;
+            this->SetLigated(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("rellen"):
+            if (std::strcmp(name, "rellen") != 0) break;
+            this->SetRellen(StrToNcFormRellen(attr.value()));
+            return true;
+        case StrHash("sShape"):
+            if (std::strcmp(name, "sShape") != 0) break;
+            this->SetSShape(StrToStr(attr.value()));
+            return true;
+        case StrHash("tilt"):
+            if (std::strcmp(name, "tilt") != 0) break;
+            this->SetTilt(StrToCompassdirection(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNcForm::WriteNcForm(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -264,14 +300,28 @@ void AttNeumeType::ResetNeumeType()
 bool AttNeumeType::ReadNeumeType(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("type")) {
-        this->SetType(StrToStr(element.attribute("type").value()));
-        if (removeAttr) element.remove_attribute("type");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNeumeType::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("type"):
+            if (std::strcmp(name, "type") != 0) break;
+            this->SetType(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNeumeType::WriteNeumeType(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -42,29 +43,40 @@ void AttMargins::ResetMargins()
 bool AttMargins::ReadMargins(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("topmar")) {
-        this->SetTopmar(StrToMeasurementunsigned(element.attribute("topmar").value()));
-        if (removeAttr) element.remove_attribute("topmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("botmar")) {
-        this->SetBotmar(StrToMeasurementunsigned(element.attribute("botmar").value()));
-        if (removeAttr) element.remove_attribute("botmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("leftmar")) {
-        this->SetLeftmar(StrToMeasurementunsigned(element.attribute("leftmar").value()));
-        if (removeAttr) element.remove_attribute("leftmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("rightmar")) {
-        this->SetRightmar(StrToMeasurementunsigned(element.attribute("rightmar").value()));
-        if (removeAttr) element.remove_attribute("rightmar");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMargins::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("topmar"):
+            if (std::strcmp(name, "topmar") != 0) break;
+            this->SetTopmar(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("botmar"):
+            if (std::strcmp(name, "botmar") != 0) break;
+            this->SetBotmar(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("leftmar"):
+            if (std::strcmp(name, "leftmar") != 0) break;
+            this->SetLeftmar(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("rightmar"):
+            if (std::strcmp(name, "rightmar") != 0) break;
+            this->SetRightmar(StrToMeasurementunsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMargins::WriteMargins(pugi::xml_node element)
 {
     bool wroteAttribute = false;
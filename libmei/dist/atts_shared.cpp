@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttAccidLog::ResetAccidLog()
 bool AttAccidLog::ReadAccidLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToAccidLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAccidLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("func"):
+            if (std::strcmp(name, "func") != 0) break;
+            this->SetFunc(StrToAccidLogFunc(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAccidLog::WriteAccidLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -79,14 +94,28 @@ void AttAccidental::ResetAccidental()
 bool AttAccidental::ReadAccidental(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid")) {
-        this->SetAccid(StrToAccidentalWritten(element.attribute("accid").value()));
-        if (removeAttr) element.remove_attribute("accid");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAccidental::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("accid"):
+            if (std::strcmp(name, "accid") != 0) break;
+            this->SetAccid(StrToAccidentalWritten(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAccidental::WriteAccidental(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -119,14 +148,28 @@ void AttArticulation::ResetArticulation()
 bool AttArticulation::ReadArticulation(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic")) {
-        this->SetArtic(StrToArticulationList(element.attribute("artic").value()));
-        if (removeAttr) element.remove_attribute("artic");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttArticulation::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("artic"):
+            if (std::strcmp(name, "artic") != 0) break;
+            this->SetArtic(StrToArticulationList(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttArticulation::WriteArticulation(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -159,14 +202,28 @@ void AttAttaccaLog::ResetAttaccaLog()
 bool AttAttaccaLog::ReadAttaccaLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        if (removeAttr) element.remove_attribute("target");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAttaccaLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("target"):
+            if (std::strcmp(name, "target") != 0) break;
+            this->SetTarget(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAttaccaLog::WriteAttaccaLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -199,14 +256,28 @@ void AttAudience::ResetAudience()
 bool AttAudience::ReadAudience(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("audience")) {
-        this->SetAudience(StrToAudienceAudience(element.attribute("audience").value()));
-        if (removeAttr) element.remove_attribute("audience");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAudience::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("audience"):
+            if (std::strcmp(name, "audience") != 0) break;
+            this->SetAudience(StrToAudienceAudience(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAudience::WriteAudience(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -239,14 +310,28 @@ void AttAugmentDots::ResetAugmentDots()
 bool AttAugmentDots::ReadAugmentDots(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dots")) {
-        this->SetDots(StrToInt(element.attribute("dots").value()));
-        if (removeAttr) element.remove_attribute("dots");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAugmentDots::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dots"):
+            if (std::strcmp(name, "dots") != 0) break;
+            this->SetDots(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAugmentDots::WriteAugmentDots(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -280,19 +365,32 @@ void AttAuthorized::ResetAuthorized()
 bool AttAuthorized::ReadAuthorized(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("auth")) {
-        this->SetAuth(StrToStr(element.attribute("auth").value()));
-        if (removeAttr) element.remove_attribute("auth");
-        hasAttribute = true;
-    }
-    if (element.attribute("auth.uri")) {
-        this->SetAuthUri(StrToStr(element.attribute("auth.uri").value()));
-        if (removeAttr) element.remove_attribute("auth.uri");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAuthorized::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("auth"):
+            if (std::strcmp(name, "auth") != 0) break;
+            this->SetAuth(StrToStr(attr.value()));
+            return true;
+        case StrHash("auth.uri"):
+            if (std::strcmp(name, "auth.uri") != 0) break;
+            this->SetAuthUri(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAuthorized::WriteAuthorized(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -334,14 +432,28 @@ void AttBarLineLog::ResetBarLineLog()
 bool AttBarLineLog::ReadBarLineLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBarrendition(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBarLineLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToBarrendition(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBarLineLog::WriteBarLineLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -376,24 +488,36 @@ void AttBarring::ResetBarring()
 bool AttBarring::ReadBarring(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bar.len")) {
-        this->SetBarLen(StrToDbl(element.attribute("bar.len").value()));
-        if (removeAttr) element.remove_attribute("bar.len");
-        hasAttribute = true;
-    }
-    if (element.attribute("bar.method")) {
-        this->SetBarMethod(StrToBarmethod(element.attribute("bar.method").value()));
-        if (removeAttr) element.remove_attribute("bar.method");
-        hasAttribute = true;
-    }
-    if (element.attribute("bar.place")) {
-        this->SetBarPlace(StrToInt(element.attribute("bar.place").value()));
-        if (removeAttr) element.remove_attribute("bar.place");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBarring::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("bar.len"):
+            if (std::strcmp(name, "bar.len") != 0) break;
+            this->SetBarLen(StrToDbl(attr.value()));
+            return true;
+        case StrHash("bar.method"):
+            if (std::strcmp(name, "bar.method") != 0) break;
+            this->SetBarMethod(StrToBarmethod(attr.value()));
+            return true;
+        case StrHash("bar.place"):
+            if (std::strcmp(name, "bar.place") != 0) break;
+            this->SetBarPlace(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBarring::WriteBarring(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -444,14 +568,28 @@ void AttBasic::ResetBasic()
 bool AttBasic::ReadBasic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:base")) {
-        this->SetBase(StrToStr(element.attribute("xml:base").value()));
-        if (removeAttr) element.remove_attribute("xml:base");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBasic::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("xml:base"):
+            if (std::strcmp(name, "xml:base") != 0) break;
+            this->SetBase(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBasic::WriteBasic(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -484,14 +622,28 @@ void AttBibl::ResetBibl()
 bool AttBibl::ReadBibl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("analog")) {
-        this->SetAnalog(StrToStr(element.attribute("analog").value()));
-        if (removeAttr) element.remove_attribute("analog");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBibl::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("analog"):
+            if (std::strcmp(name, "analog") != 0) break;
+            this->SetAnalog(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBibl::WriteBibl(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -524,14 +676,28 @@ void AttCalendared::ResetCalendared()
 bool AttCalendared::ReadCalendared(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("calendar")) {
-        this->SetCalendar(StrToStr(element.attribute("calendar").value()));
-        if (removeAttr) element.remove_attribute("calendar");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCalendared::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("calendar"):
+            if (std::strcmp(name, "calendar") != 0) break;
+            this->SetCalendar(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCalendared::WriteCalendared(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -564,14 +730,28 @@ void AttCanonical::ResetCanonical()
 bool AttCanonical::ReadCanonical(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("codedval")) {
-        this->SetCodedval(StrToStr(element.attribute("codedval").value()));
-        if (removeAttr) element.remove_attribute("codedval");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCanonical::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("codedval"):
+            if (std::strcmp(name, "codedval") != 0) break;
+            this->SetCodedval(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCanonical::WriteCanonical(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -604,14 +784,28 @@ void AttClassed::ResetClassed()
 bool AttClassed::ReadClassed(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("class")) {
-        this->SetClass(StrToStr(element.attribute("class").value()));
-        if (removeAttr) element.remove_attribute("class");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttClassed::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("class"):
+            if (std::strcmp(name, "class") != 0) break;
+            this->SetClass(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttClassed::WriteClassed(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -644,14 +838,28 @@ void AttClefLog::ResetClefLog()
 bool AttClefLog::ReadClefLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cautionary")) {
-        this->SetCautionary(StrToBoolean(element.attribute("cautionary").value()));
-        if (removeAttr) element.remove_attribute("cautionary");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttClefLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("cautionary"):
+            if (std::strcmp(name, "cautionary") != 0) break;
+            this->SetCautionary(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttClefLog::WriteClefLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -684,14 +892,28 @@ void AttClefShape::ResetClefShape()
 bool AttClefShape::ReadClefShape(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("shape")) {
-        this->SetShape(StrToClefshape(element.attribute("shape").value()));
-        if (removeAttr) element.remove_attribute("shape");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttClefShape::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("shape"):
+            if (std::strcmp(name, "shape") != 0) break;
+            this->SetShape(StrToClefshape(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttClefShape::WriteClefShape(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -727,29 +949,40 @@ void AttCleffingLog::ResetCleffingLog()
 bool AttCleffingLog::ReadCleffingLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.shape")) {
-        this->SetClefShape(StrToClefshape(element.attribute("clef.shape").value()));
-        if (removeAttr) element.remove_attribute("clef.shape");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.line")) {
-        this->SetClefLine(StrToInt(element.attribute("clef.line").value()));
-        if (removeAttr) element.remove_attribute("clef.line");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.dis")) {
-        this->SetClefDis(StrToOctaveDis(element.attribute("clef.dis").value()));
-        if (removeAttr) element.remove_attribute("clef.dis");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.dis.place")) {
-        this->SetClefDisPlace(StrToStaffrelBasic(element.attribute("clef.dis.place").value()));
-        if (removeAttr) element.remove_attribute("clef.dis.place");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCleffingLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("clef.shape"):
+            if (std::strcmp(name, "clef.shape") != 0) break;
+            this->SetClefShape(StrToClefshape(attr.value()));
+            return true;
+        case StrHash("clef.line"):
+            if (std::strcmp(name, "clef.line") != 0) break;
+            this->SetClefLine(StrToInt(attr.value()));
+            return true;
+        case StrHash("clef.dis"):
+            if (std::strcmp(name, "clef.dis") != 0) break;
+            this->SetClefDis(StrToOctaveDis(attr.value()));
+            return true;
+        case StrHash("clef.dis.place"):
+            if (std::strcmp(name, "clef.dis.place") != 0) break;
+            this->SetClefDisPlace(StrToStaffrelBasic(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCleffingLog::WriteCleffingLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -809,14 +1042,28 @@ void AttColor::ResetColor()
 bool AttColor::ReadColor(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("color")) {
-        this->SetColor(StrToStr(element.attribute("color").value()));
-        if (removeAttr) element.remove_attribute("color");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttColor::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("color"):
+            if (std::strcmp(name, "color") != 0) break;
+            this->SetColor(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttColor::WriteColor(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -849,14 +1096,28 @@ void AttColoration::ResetColoration()
 bool AttColoration::ReadColoration(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("colored")) {
-        this->SetColored(StrToBoolean(element.attribute("colored").value()));
-        if (removeAttr) element.remove_attribute("colored");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttColoration::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("colored"):
+            if (std::strcmp(name, "colored") != 0) break;
+            this->SetColored(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttColoration::WriteColoration(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -889,14 +1150,28 @@ void AttCoordX1::ResetCoordX1()
 bool AttCoordX1::ReadCoordX1(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coord.x1")) {
-        this->SetCoordX1(StrToDbl(element.attribute("coord.x1").value()));
-        if (removeAttr) element.remove_attribute("coord.x1");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCoordX1::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("coord.x1"):
+            if (std::strcmp(name, "coord.x1") != 0) break;
+            this->SetCoordX1(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCoordX1::WriteCoordX1(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -929,14 +1204,28 @@ void AttCoordX2::ResetCoordX2()
 bool AttCoordX2::ReadCoordX2(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coord.x2")) {
-        this->SetCoordX2(StrToDbl(element.attribute("coord.x2").value()));
-        if (removeAttr) element.remove_attribute("coord.x2");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCoordX2::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("coord.x2"):
+            if (std::strcmp(name, "coord.x2") != 0) break;
+            this->SetCoordX2(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCoordX2::WriteCoordX2(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -969,14 +1258,28 @@ void AttCoordY1::ResetCoordY1()
 bool AttCoordY1::ReadCoordY1(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coord.y1")) {
-        this->SetCoordY1(StrToDbl(element.attribute("coord.y1").value()));
-        if (removeAttr) element.remove_attribute("coord.y1");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCoordY1::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("coord.y1"):
+            if (std::strcmp(name, "coord.y1") != 0) break;
+            this->SetCoordY1(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCoordY1::WriteCoordY1(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1011,24 +1314,36 @@ void AttCoordinated::ResetCoordinated()
 bool AttCoordinated::ReadCoordinated(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lrx")) {
-        this->SetLrx(StrToInt(element.attribute("lrx").value()));
-        if (removeAttr) element.remove_attribute("lrx");
-        hasAttribute = true;
-    }
-    if (element.attribute("lry")) {
-        this->SetLry(StrToInt(element.attribute("lry").value()));
-        if (removeAttr) element.remove_attribute("lry");
-        hasAttribute = true;
-    }
-    if (element.attribute("rotate")) {
-        this->SetRotate(StrToDbl(element.attribute("rotate").value()));
-        if (removeAttr) element.remove_attribute("rotate");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCoordinated::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("lrx"):
+            if (std::strcmp(name, "lrx") != 0) break;
+            this->SetLrx(StrToInt(attr.value()));
+            return true;
+        case StrHash("lry"):
+            if (std::strcmp(name, "lry") != 0) break;
+            this->SetLry(StrToInt(attr.value()));
+            return true;
+        case StrHash("rotate"):
+            if (std::strcmp(name, "rotate") != 0) break;
+            this->SetRotate(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCoordinated::WriteCoordinated(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1080,19 +1395,32 @@ void AttCoordinatedUl::ResetCoordinatedUl()
 bool AttCoordinatedUl::ReadCoordinatedUl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ulx")) {
-        this->SetUlx(StrToInt(element.attribute("ulx").value()));
-        if (removeAttr) element.remove_attribute("ulx");
-        hasAttribute = true;
-    }
-    if (element.attribute("uly")) {
-        this->SetUly(StrToInt(element.attribute("uly").value()));
-        if (removeAttr) element.remove_attribute("uly");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCoordinatedUl::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("ulx"):
+            if (std::strcmp(name, "ulx") != 0) break;
+            this->SetUlx(StrToInt(attr.value()));
+            return true;
+        case StrHash("uly"):
+            if (std::strcmp(name, "uly") != 0) break;
+            this->SetUly(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCoordinatedUl::WriteCoordinatedUl(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1134,14 +1462,28 @@ void AttCue::ResetCue()
 bool AttCue::ReadCue(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cue")) {
-        this->SetCue(StrToBoolean(element.attribute("cue").value()));
-        if (removeAttr) element.remove_attribute("cue");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCue::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("cue"):
+            if (std::strcmp(name, "cue") != 0) break;
+            this->SetCue(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCue::WriteCue(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1176,24 +1518,36 @@ void AttCurvature::ResetCurvature()
 bool AttCurvature::ReadCurvature(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bezier")) {
-        this->SetBezier(StrToStr(element.attribute("bezier").value()));
-        if (removeAttr) element.remove_attribute("bezier");
-        hasAttribute = true;
-    }
-    if (element.attribute("bulge")) {
-        this->SetBulge(StrToBulge(element.attribute("bulge").value()));
-        if (removeAttr) element.remove_attribute("bulge");
-        hasAttribute = true;
-    }
-    if (element.attribute("curvedir")) {
-        this->SetCurvedir(StrToCurvatureCurvedir(element.attribute("curvedir").value()));
-        if (removeAttr) element.remove_attribute("curvedir");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCurvature::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("bezier"):
+            if (std::strcmp(name, "bezier") != 0) break;
+            this->SetBezier(StrToStr(attr.value()));
+            return true;
+        case StrHash("bulge"):
+            if (std::strcmp(name, "bulge") != 0) break;
+            this->SetBulge(StrToBulge(attr.value()));
+            return true;
+        case StrHash("curvedir"):
+            if (std::strcmp(name, "curvedir") != 0) break;
+            this->SetCurvedir(StrToCurvatureCurvedir(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCurvature::WriteCurvature(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1244,14 +1598,28 @@ void AttCustosLog::ResetCustosLog()
 bool AttCustosLog::ReadCustosLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        if (removeAttr) element.remove_attribute("target");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCustosLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("target"):
+            if (std::strcmp(name, "target") != 0) break;
+            this->SetTarget(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCustosLog::WriteCustosLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1284,14 +1652,28 @@ void AttDataPointing::ResetDataPointing()
 bool AttDataPointing::ReadDataPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("data")) {
-        this->SetData(StrToStr(element.attribute("data").value()));
-        if (removeAttr) element.remove_attribute("data");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttDataPointing::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("data"):
+            if (std::strcmp(name, "data") != 0) break;
+            this->SetData(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttDataPointing::WriteDataPointing(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1328,34 +1710,44 @@ void AttDatable::ResetDatable()
 bool AttDatable::ReadDatable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("enddate")) {
-        this->SetEnddate(StrToStr(element.attribute("enddate").value()));
-        if (removeAttr) element.remove_attribute("enddate");
-        hasAttribute = true;
-    }
-    if (element.attribute("isodate")) {
-        this->SetIsodate(StrToStr(element.attribute("isodate").value()));
-        if (removeAttr) element.remove_attribute("isodate");
-        hasAttribute = true;
-    }
-    if (element.attribute("notafter")) {
-        this->SetNotafter(StrToStr(element.attribute("notafter").value()));
-        if (removeAttr) element.remove_attribute("notafter");
-        hasAttribute = true;
-    }
-    if (element.attribute("notbefore")) {
-        this->SetNotbefore(StrToStr(element.attribute("notbefore").value()));
-        if (removeAttr) element.remove_attribute("notbefore");
-        hasAttribute = true;
-    }
-    if (element.attribute("startdate")) {
-        this->SetStartdate(StrToStr(element.attribute("startdate").value()));
-        if (removeAttr) element.remove_attribute("startdate");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttDatable::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("enddate"):
+            if (std::strcmp(name, "enddate") != 0) break;
+            this->SetEnddate(StrToStr(attr.value()));
+            return true;
+        case StrHash("isodate"):
+            if (std::strcmp(name, "isodate") != 0) break;
+            this->SetIsodate(StrToStr(attr.value()));
+            return true;
+        case StrHash("notafter"):
+            if (std::strcmp(name, "notafter") != 0) break;
+            this->SetNotafter(StrToStr(attr.value()));
+            return true;
+        case StrHash("notbefore"):
+            if (std::strcmp(name, "notbefore") != 0) break;
+            this->SetNotbefore(StrToStr(attr.value()));
+            return true;
+        case StrHash("startdate"):
+            if (std::strcmp(name, "startdate") != 0) break;
+            this->SetStartdate(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttDatable::WriteDatable(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1428,34 +1820,44 @@ void AttDistances::ResetDistances()
 bool AttDistances::ReadDistances(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir.dist")) {
-        this->SetDirDist(StrToMeasurementsigned(element.attribute("dir.dist").value()));
-        if (removeAttr) element.remove_attribute("dir.dist");
-        hasAttribute = true;
-    }
-    if (element.attribute("dynam.dist")) {
-        this->SetDynamDist(StrToMeasurementsigned(element.attribute("dynam.dist").value()));
-        if (removeAttr) element.remove_attribute("dynam.dist");
-        hasAttribute = true;
-    }
-    if (element.attribute("harm.dist")) {
-        this->SetHarmDist(StrToMeasurementsigned(element.attribute("harm.dist").value()));
-        if (removeAttr) element.remove_attribute("harm.dist");
-        hasAttribute = true;
-    }
-    if (element.attribute("reh.dist")) {
-        this->SetRehDist(StrToMeasurementsigned(element.attribute("reh.dist").value()));
-        if (removeAttr) element.remove_attribute("reh.dist");
-        hasAttribute = true;
-    }
-    if (element.attribute("tempo.dist")) {
-        this->SetTempoDist(StrToMeasurementsigned(element.attribute("tempo.dist").value()));
-        if (removeAttr) element.remove_attribute("tempo.dist");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttDistances::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dir.dist"):
+            if (std::strcmp(name, "dir.dist") != 0) break;
+            this->SetDirDist(StrToMeasurementsigned(attr.value()));
+            return true;
+        case StrHash("dynam.dist"):
+            if (std::strcmp(name, "dynam.dist") != 0) break;
+            this->SetDynamDist(StrToMeasurementsigned(attr.value()));
+            return true;
+        case StrHash("harm.dist"):
+            if (std::strcmp(name, "harm.dist") != 0) break;
+            this->SetHarmDist(StrToMeasurementsigned(attr.value()));
+            return true;
+        case StrHash("reh.dist"):
+            if (std::strcmp(name, "reh.dist") != 0) break;
+            this->SetRehDist(StrToMeasurementsigned(attr.value()));
+            return true;
+        case StrHash("tempo.dist"):
+            if (std::strcmp(name, "tempo.dist") != 0) break;
+            this->SetTempoDist(StrToMeasurementsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttDistances::WriteDistances(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1524,14 +1926,28 @@ void AttDotLog::ResetDotLog()
 bool AttDotLog::ReadDotLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToDotLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttDotLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToDotLogForm(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttDotLog::WriteDotLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1564,14 +1980,28 @@ void AttDurationAdditive::ResetDurationAdditive()
 bool AttDurationAdditive::ReadDurationAdditive(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        if (removeAttr) element.remove_attribute("dur");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttDurationAdditive::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dur"):
+            if (std::strcmp(name, "dur") != 0) break;
+            this->SetDur(StrToDuration(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttDurationAdditive::WriteDurationAdditive(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1606,24 +2036,36 @@ void AttDurationDefault::ResetDurationDefault()
 bool AttDurationDefault::ReadDurationDefault(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.default")) {
-        this->SetDurDefault(StrToDuration(element.attribute("dur.default").value()));
-        if (removeAttr) element.remove_attribute("dur.default");
-        hasAttribute = true;
-    }
-    if (element.attribute("num.default")) {
-        this->SetNumDefault(StrToInt(element.attribute("num.default").value()));
-        if (removeAttr) element.remove_attribute("num.default");
-        hasAttribute = true;
-    }
-    if (element.attribute("numbase.default")) {
-        this->SetNumbaseDefault(StrToInt(element.attribute("numbase.default").value()));
-        if (removeAttr) element.remove_attribute("numbase.default");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttDurationDefault::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dur.default"):
+            if (std::strcmp(name, "dur.default") != 0) break;
+            this->SetDurDefault(StrToDuration(attr.value()));
+            return true;
+        case StrHash("num.default"):
+            if (std::strcmp(name, "num.default") != 0) break;
+            this->SetNumDefault(StrToInt(attr.value()));
+            return true;
+        case StrHash("numbase.default"):
+            if (std::strcmp(name, "numbase.default") != 0) break;
+            this->SetNumbaseDefault(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttDurationDefault::WriteDurationDefault(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1674,14 +2116,28 @@ void AttDurationLog::ResetDurationLog()
 bool AttDurationLog::ReadDurationLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        if (removeAttr) element.remove_attribute("dur");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttDurationLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dur"):
+            if (std::strcmp(name, "dur") != 0) break;
+            this->SetDur(StrToDuration(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttDurationLog::WriteDurationLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1715,19 +2171,32 @@ void AttDurationRatio::ResetDurationRatio()
 bool AttDurationRatio::ReadDurationRatio(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        if (removeAttr) element.remove_attribute("num");
-        hasAttribute = true;
-    }
-    if (element.attribute("numbase")) {
-        this->SetNumbase(StrToInt(element.attribute("numbase").value()));
-        if (removeAttr) element.remove_attribute("numbase");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttDurationRatio::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("num"):
+            if (std::strcmp(name, "num") != 0) break;
+            this->SetNum(StrToInt(attr.value()));
+            return true;
+        case StrHash("numbase"):
+            if (std::strcmp(name, "numbase") != 0) break;
+            this->SetNumbase(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttDurationRatio::WriteDurationRatio(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1769,14 +2238,28 @@ void AttEnclosingChars::ResetEnclosingChars()
 bool AttEnclosingChars::ReadEnclosingChars(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("enclose")) {
-        this->SetEnclose(StrToEnclosure(element.attribute("enclose").value()));
-        if (removeAttr) element.remove_attribute("enclose");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttEnclosingChars::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("enclose"):
+            if (std::strcmp(name, "enclose") != 0) break;
+            this->SetEnclose(StrToEnclosure(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttEnclosingChars::WriteEnclosingChars(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1809,14 +2292,28 @@ void AttEndings::ResetEndings()
 bool AttEndings::ReadEndings(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ending.rend")) {
-        this->SetEndingRend(StrToEndingsEndingrend(element.attribute("ending.rend").value()));
-        if (removeAttr) element.remove_attribute("ending.rend");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttEndings::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("ending.rend"):
+            if (std::strcmp(name, "ending.rend") != 0) break;
+            this->SetEndingRend(StrToEndingsEndingrend(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttEndings::WriteEndings(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1850,19 +2347,32 @@ void AttEvidence::ResetEvidence()
 bool AttEvidence::ReadEvidence(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cert")) {
-        this->SetCert(StrToCertainty(element.attribute("cert").value()));
-        if (removeAttr) element.remove_attribute("cert");
-        hasAttribute = true;
-    }
-    if (element.attribute("evidence")) {
-        this->SetEvidence(StrToStr(element.attribute("evidence").value()));
-        if (removeAttr) element.remove_attribute("evidence");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttEvidence::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("cert"):
+            if (std::strcmp(name, "cert") != 0) break;
+            this->SetCert(StrToCertainty(attr.value()));
+            return true;
+        case StrHash("evidence"):
+            if (std::strcmp(name, "evidence") != 0) break;
+            this->SetEvidence(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttEvidence::WriteEvidence(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1904,14 +2414,28 @@ void AttExtender::ResetExtender()
 bool AttExtender::ReadExtender(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extender")) {
-        this->SetExtender(StrToBoolean(element.attribute("extender").value()));
-        if (removeAttr) element.remove_attribute("extender");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttExtender::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("extender"):
+            if (std::strcmp(name, "extender") != 0) break;
+            this->SetExtender(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttExtender::WriteExtender(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1944,14 +2468,28 @@ void AttExtent::ResetExtent()
 bool AttExtent::ReadExtent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extent")) {
-        this->SetExtent(StrToStr(element.attribute("extent").value()));
-        if (removeAttr) element.remove_attribute("extent");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttExtent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("extent"):
+            if (std::strcmp(name, "extent") != 0) break;
+            this->SetExtent(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttExtent::WriteExtent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1984,14 +2522,28 @@ void AttFermataPresent::ResetFermataPresent()
 bool AttFermataPresent::ReadFermataPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("fermata")) {
-        this->SetFermata(StrToStaffrelBasic(element.attribute("fermata").value()));
-        if (removeAttr) element.remove_attribute("fermata");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttFermataPresent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("fermata"):
+            if (std::strcmp(name, "fermata") != 0) break;
+            this->SetFermata(StrToStaffrelBasic(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttFermataPresent::WriteFermataPresent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2024,14 +2576,28 @@ void AttFiling::ResetFiling()
 bool AttFiling::ReadFiling(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("nonfiling")) {
-        this->SetNonfiling(StrToInt(element.attribute("nonfiling").value()));
-        if (removeAttr) element.remove_attribute("nonfiling");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttFiling::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("nonfiling"):
+            if (std::strcmp(name, "nonfiling") != 0) break;
+            this->SetNonfiling(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttFiling::WriteFiling(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2064,14 +2630,28 @@ void AttFormework::ResetFormework()
 bool AttFormework::ReadFormework(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToPgfunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttFormework::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("func"):
+            if (std::strcmp(name, "func") != 0) break;
+            this->SetFunc(StrToPgfunc(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttFormework::WriteFormework(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2104,14 +2684,28 @@ void AttGrpSymLog::ResetGrpSymLog()
 bool AttGrpSymLog::ReadGrpSymLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("level")) {
-        this->SetLevel(StrToInt(element.attribute("level").value()));
-        if (removeAttr) element.remove_attribute("level");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttGrpSymLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("level"):
+            if (std::strcmp(name, "level") != 0) break;
+            this->SetLevel(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttGrpSymLog::WriteGrpSymLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2144,14 +2738,28 @@ void AttHandIdent::ResetHandIdent()
 bool AttHandIdent::ReadHandIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("hand")) {
-        this->SetHand(StrToStr(element.attribute("hand").value()));
-        if (removeAttr) element.remove_attribute("hand");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttHandIdent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("hand"):
+            if (std::strcmp(name, "hand") != 0) break;
+            this->SetHand(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttHandIdent::WriteHandIdent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2184,14 +2792,28 @@ void AttHeight::ResetHeight()
 bool AttHeight::ReadHeight(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("height")) {
-        this->SetHeight(StrToMeasurementunsigned(element.attribute("height").value()));
-        if (removeAttr) element.remove_attribute("height");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttHeight::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("height"):
+            if (std::strcmp(name, "height") != 0) break;
+            this->SetHeight(StrToMeasurementunsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttHeight::WriteHeight(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2224,14 +2846,28 @@ void AttHorizontalAlign::ResetHorizontalAlign()
 bool AttHorizontalAlign::ReadHorizontalAlign(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("halign")) {
-        this->SetHalign(StrToHorizontalalignment(element.attribute("halign").value()));
-        if (removeAttr) element.remove_attribute("halign");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttHorizontalAlign::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("halign"):
+            if (std::strcmp(name, "halign") != 0) break;
+            this->SetHalign(StrToHorizontalalignment(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttHorizontalAlign::WriteHorizontalAlign(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2264,14 +2900,28 @@ void AttInternetMedia::ResetInternetMedia()
 bool AttInternetMedia::ReadInternetMedia(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mimetype")) {
-        this->SetMimetype(StrToStr(element.attribute("mimetype").value()));
-        if (removeAttr) element.remove_attribute("mimetype");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttInternetMedia::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("mimetype"):
+            if (std::strcmp(name, "mimetype") != 0) break;
+            this->SetMimetype(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttInternetMedia::WriteInternetMedia(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2304,14 +2954,28 @@ void AttJoined::ResetJoined()
 bool AttJoined::ReadJoined(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("join")) {
-        this->SetJoin(StrToStr(element.attribute("join").value()));
-        if (removeAttr) element.remove_attribute("join");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttJoined::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("join"):
+            if (std::strcmp(name, "join") != 0) break;
+            this->SetJoin(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttJoined::WriteJoined(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2344,14 +3008,28 @@ void AttKeyMode::ResetKeyMode()
 bool AttKeyMode::ReadKeyMode(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mode")) {
-        this->SetMode(StrToMode(element.attribute("mode").value()));
-        if (removeAttr) element.remove_attribute("mode");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttKeyMode::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("mode"):
+            if (std::strcmp(name, "mode") != 0) break;
+            this->SetMode(StrToMode(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttKeyMode::WriteKeyMode(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2384,14 +3062,28 @@ void AttKeySigLog::ResetKeySigLog()
 bool AttKeySigLog::ReadKeySigLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("sig")) {
-        this->SetSig(StrToKeysignature(element.attribute("sig").value()));
-        if (removeAttr) element.remove_attribute("sig");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttKeySigLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("sig"):
+            if (std::strcmp(name, "sig") != 0) break;
+            this->SetSig(StrToKeysignature(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttKeySigLog::WriteKeySigLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2424,14 +3116,28 @@ void AttKeySigDefaultLog::ResetKeySigDefaultLog()
 bool AttKeySigDefaultLog::ReadKeySigDefaultLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("keysig")) {
-        this->SetKeysig(StrToKeysignature(element.attribute("keysig").value()));
-        if (removeAttr) element.remove_attribute("keysig");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttKeySigDefaultLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("keysig"):
+            if (std::strcmp(name, "keysig") != 0) break;
+            this->SetKeysig(StrToKeysignature(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttKeySigDefaultLog::WriteKeySigDefaultLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2464,17 +3170,31 @@ void AttLabelled::ResetLabelled()
 bool AttLabelled::ReadLabelled(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("label")) {
-        this->SetLabel(StrToStr(element.attribute("label").value()));
-        if (removeAttr) element.remove_attribute("label");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
-bool AttLabelled::WriteLabelled(pugi::xml_node element)
+bool AttLabelled::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
 {
-    bool wroteAttribute = false;
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("label"):
+            if (std::strcmp(name, "label") != 0) break;
+            this->SetLabel(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
+bool AttLabelled::WriteLabelled(pugi::xml_node element)
+{
+    bool wroteAttribute = false;
     if (this->HasLabel()) {
         element.append_attribute("label") = StrToStr(this->GetLabel()).c_str();
         wroteAttribute = true;
@@ -2505,19 +3225,32 @@ void AttLang::ResetLang()
 bool AttLang::ReadLang(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:lang")) {
-        this->SetLang(StrToStr(element.attribute("xml:lang").value()));
-        if (removeAttr) element.remove_attribute("xml:lang");
-        hasAttribute = true;
-    }
-    if (element.attribute("translit")) {
-        this->SetTranslit(StrToStr(element.attribute("translit").value()));
-        if (removeAttr) element.remove_attribute("translit");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLang::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("xml:lang"):
+            if (std::strcmp(name, "xml:lang") != 0) break;
+            this->SetLang(StrToStr(attr.value()));
+            return true;
+        case StrHash("translit"):
+            if (std::strcmp(name, "translit") != 0) break;
+            this->SetTranslit(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLang::WriteLang(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2559,14 +3292,28 @@ void AttLayerLog::ResetLayerLog()
 bool AttLayerLog::ReadLayerLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        if (removeAttr) element.remove_attribute("def");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLayerLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("def"):
+            if (std::strcmp(name, "def") != 0) break;
+            this->SetDef(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLayerLog::WriteLayerLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2599,14 +3346,28 @@ void AttLayerIdent::ResetLayerIdent()
 bool AttLayerIdent::ReadLayerIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("layer")) {
-        this->SetLayer(StrToInt(element.attribute("layer").value()));
-        if (removeAttr) element.remove_attribute("layer");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLayerIdent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("layer"):
+            if (std::strcmp(name, "layer") != 0) break;
+            this->SetLayer(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLayerIdent::WriteLayerIdent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2639,14 +3400,28 @@ void AttLineLoc::ResetLineLoc()
 bool AttLineLoc::ReadLineLoc(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("line")) {
-        this->SetLine(StrToInt(element.attribute("line").value()));
-        if (removeAttr) element.remove_attribute("line");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLineLoc::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("line"):
+            if (std::strcmp(name, "line") != 0) break;
+            this->SetLine(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLineLoc::WriteLineLoc(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2682,29 +3457,40 @@ void AttLineRend::ResetLineRend()
 bool AttLineRend::ReadLineRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lendsym")) {
-        this->SetLendsym(StrToLinestartendsymbol(element.attribute("lendsym").value()));
-        if (removeAttr) element.remove_attribute("lendsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("lendsym.size")) {
-        this->SetLendsymSize(StrToInt(element.attribute("lendsym.size").value()));
-        if (removeAttr) element.remove_attribute("lendsym.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("lstartsym")) {
-        this->SetLstartsym(StrToLinestartendsymbol(element.attribute("lstartsym").value()));
-        if (removeAttr) element.remove_attribute("lstartsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("lstartsym.size")) {
-        this->SetLstartsymSize(StrToInt(element.attribute("lstartsym.size").value()));
-        if (removeAttr) element.remove_attribute("lstartsym.size");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLineRend::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("lendsym"):
+            if (std::strcmp(name, "lendsym") != 0) break;
+            this->SetLendsym(StrToLinestartendsymbol(attr.value()));
+            return true;
+        case StrHash("lendsym.size"):
+            if (std::strcmp(name, "lendsym.size") != 0) break;
+            this->SetLendsymSize(StrToInt(attr.value()));
+            return true;
+        case StrHash("lstartsym"):
+            if (std::strcmp(name, "lstartsym") != 0) break;
+            this->SetLstartsym(StrToLinestartendsymbol(attr.value()));
+            return true;
+        case StrHash("lstartsym.size"):
+            if (std::strcmp(name, "lstartsym.size") != 0) break;
+            this->SetLstartsymSize(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLineRend::WriteLineRend(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2766,24 +3552,36 @@ void AttLineRendBase::ResetLineRendBase()
 bool AttLineRendBase::ReadLineRendBase(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        if (removeAttr) element.remove_attribute("lform");
-        hasAttribute = true;
-    }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToLinewidth(element.attribute("lwidth").value()));
-        if (removeAttr) element.remove_attribute("lwidth");
-        hasAttribute = true;
-    }
-    if (element.attribute("lsegs")) {
-        this->SetLsegs(StrToInt(element.attribute("lsegs").value()));
-        if (removeAttr) element.remove_attribute("lsegs");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLineRendBase::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("lform"):
+            if (std::strcmp(name, "lform") != 0) break;
+            this->SetLform(StrToLineform(attr.value()));
+            return true;
+        case StrHash("lwidth"):
+            if (std::strcmp(name, "lwidth") != 0) break;
+            this->SetLwidth(StrToLinewidth(attr.value()));
+            return true;
+        case StrHash("lsegs"):
+            if (std::strcmp(name, "lsegs") != 0) break;
+            this->SetLsegs(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLineRendBase::WriteLineRendBase(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2841,47 +3639,54 @@ void AttLinking::ResetLinking()
 bool AttLinking::ReadLinking(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("copyof")) {
-        this->SetCopyof(StrToStr(element.attribute("copyof").value()));
-        if (removeAttr) element.remove_attribute("copyof");
-        hasAttribute = true;
-    }
-    if (element.attribute("corresp")) {
-        this->SetCorresp(StrToStr(element.attribute("corresp").value()));
-        if (removeAttr) element.remove_attribute("corresp");
-        hasAttribute = true;
-    }
-    if (element.attribute("follows")) {
-        this->SetFollows(StrToStr(element.attribute("follows").value()));
-        if (removeAttr) element.remove_attribute("follows");
-        hasAttribute = true;
-    }
-    if (element.attribute("next")) {
-        this->SetNext(StrToStr(element.attribute("next").value()));
-        if (removeAttr) element.remove_attribute("next");
-        hasAttribute = true;
-    }
-    if (element.attribute("precedes")) {
-        this->SetPrecedes(StrToStr(element.attribute("precedes").value()));
-        if (removeAttr) element.remove_attribute("precedes");
-        hasAttribute = true;
-    }
-    if (element.attribute("prev")) {
-        this->SetPrev(StrToStr(element.attribute("prev").value()));
-        if (removeAttr) element.remove_attribute("prev");
-        hasAttribute = true;
-    }
-    if (element.attribute("sameas")) {
-        this->SetSameas(StrToStr(element.attribute("sameas").value()));
-        if (removeAttr) element.remove_attribute("sameas");
-        hasAttribute = true;
-    }
-    if (element.attribute("synch")) {
-        this->SetSynch(StrToStr(element.attribute("synch").value()));
-        if (removeAttr) element.remove_attribute("synch");
-        hasAttribute = true;
-    }
-    return hasAttribute;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
+        hasAttribute = true;
+    }
+    return hasAttribute;
+}
+
+bool AttLinking::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("copyof"):
+            if (std::strcmp(name, "copyof") != 0) break;
+            this->SetCopyof(StrToStr(attr.value()));
+            return true;
+        case StrHash("corresp"):
+            if (std::strcmp(name, "corresp") != 0) break;
+            this->SetCorresp(StrToStr(attr.value()));
+            return true;
+        case StrHash("follows"):
+            if (std::strcmp(name, "follows") != 0) break;
+            this->SetFollows(StrToStr(attr.value()));
+            return true;
+        case StrHash("next"):
+            if (std::strcmp(name, "next") != 0) break;
+            this->SetNext(StrToStr(attr.value()));
+            return true;
+        case StrHash("precedes"):
+            if (std::strcmp(name, "precedes") != 0) break;
+            this->SetPrecedes(StrToStr(attr.value()));
+            return true;
+        case StrHash("prev"):
+            if (std::strcmp(name, "prev") != 0) break;
+            this->SetPrev(StrToStr(attr.value()));
+            return true;
+        case StrHash("sameas"):
+            if (std::strcmp(name, "sameas") != 0) break;
+            this->SetSameas(StrToStr(attr.value()));
+            return true;
+        case StrHash("synch"):
+            if (std::strcmp(name, "synch") != 0) break;
+            this->SetSynch(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
 }
 
 bool AttLinking::WriteLinking(pugi::xml_node element)
@@ -2984,39 +3789,48 @@ void AttLyricStyle::ResetLyricStyle()
 bool AttLyricStyle::ReadLyricStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lyric.align")) {
-        this->SetLyricAlign(StrToMeasurementsigned(element.attribute("lyric.align").value()));
-        if (removeAttr) element.remove_attribute("lyric.align");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.fam")) {
-        this->SetLyricFam(StrToStr(element.attribute("lyric.fam").value()));
-        if (removeAttr) element.remove_attribute("lyric.fam");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.name")) {
-        this->SetLyricName(StrToStr(element.attribute("lyric.name").value()));
-        if (removeAttr) element.remove_attribute("lyric.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.size")) {
-        this->SetLyricSize(StrToFontsize(element.attribute("lyric.size").value()));
-        if (removeAttr) element.remove_attribute("lyric.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.style")) {
-        this->SetLyricStyle(StrToFontstyle(element.attribute("lyric.style").value()));
-        if (removeAttr) element.remove_attribute("lyric.style");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.weight")) {
-        this->SetLyricWeight(StrToFontweight(element.attribute("lyric.weight").value()));
-        if (removeAttr) element.remove_attribute("lyric.weight");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLyricStyle::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("lyric.align"):
+            if (std::strcmp(name, "lyric.align") != 0) break;
+            this->SetLyricAlign(StrToMeasurementsigned(attr.value()));
+            return true;
+        case StrHash("lyric.fam"):
+            if (std::strcmp(name, "lyric.fam") != 0) break;
+            this->SetLyricFam(StrToStr(attr.value()));
+            return true;
+        case StrHash("lyric.name"):
+            if (std::strcmp(name, "lyric.name") != 0) break;
+            this->SetLyricName(StrToStr(attr.value()));
+            return true;
+        case StrHash("lyric.size"):
+            if (std::strcmp(name, "lyric.size") != 0) break;
+            this->SetLyricSize(StrToFontsize(attr.value()));
+            return true;
+        case StrHash("lyric.style"):
+            if (std::strcmp(name, "lyric.style") != 0) break;
+            this->SetLyricStyle(StrToFontstyle(attr.value()));
+            return true;
+        case StrHash("lyric.weight"):
+            if (std::strcmp(name, "lyric.weight") != 0) break;
+            this->SetLyricWeight(StrToFontweight(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLyricStyle::WriteLyricStyle(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3094,14 +3908,28 @@ void AttMeasureNumbers::ResetMeasureNumbers()
 bool AttMeasureNumbers::ReadMeasureNumbers(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mnum.visible")) {
-        this->SetMnumVisible(StrToBoolean(element.attribute("mnum.visible").value()));
-        if (removeAttr) element.remove_attribute("mnum.visible");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMeasureNumbers::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("mnum.visible"):
+            if (std::strcmp(name, "mnum.visible") != 0) break;
+            this->SetMnumVisible(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMeasureNumbers::WriteMeasureNumbers(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3134,14 +3962,28 @@ void AttMeasurement::ResetMeasurement()
 bool AttMeasurement::ReadMeasurement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToStr(element.attribute("unit").value()));
-        if (removeAttr) element.remove_attribute("unit");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMeasurement::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("unit"):
+            if (std::strcmp(name, "unit") != 0) break;
+            this->SetUnit(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMeasurement::WriteMeasurement(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3176,24 +4018,36 @@ void AttMediaBounds::ResetMediaBounds()
 bool AttMediaBounds::ReadMediaBounds(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("begin")) {
-        this->SetBegin(StrToStr(element.attribute("begin").value()));
-        if (removeAttr) element.remove_attribute("begin");
-        hasAttribute = true;
-    }
-    if (element.attribute("end")) {
-        this->SetEnd(StrToStr(element.attribute("end").value()));
-        if (removeAttr) element.remove_attribute("end");
-        hasAttribute = true;
-    }
-    if (element.attribute("betype")) {
-        this->SetBetype(StrToBetype(element.attribute("betype").value()));
-        if (removeAttr) element.remove_attribute("betype");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMediaBounds::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("begin"):
+            if (std::strcmp(name, "begin") != 0) break;
+            this->SetBegin(StrToStr(attr.value()));
+            return true;
+        case StrHash("end"):
+            if (std::strcmp(name, "end") != 0) break;
+            this->SetEnd(StrToStr(attr.value()));
+            return true;
+        case StrHash("betype"):
+            if (std::strcmp(name, "betype") != 0) break;
+            this->SetBetype(StrToBetype(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMediaBounds::WriteMediaBounds(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3244,14 +4098,28 @@ void AttMedium::ResetMedium()
 bool AttMedium::ReadMedium(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("medium")) {
-        this->SetMedium(StrToStr(element.attribute("medium").value()));
-        if (removeAttr) element.remove_attribute("medium");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMedium::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("medium"):
+            if (std::strcmp(name, "medium") != 0) break;
+            this->SetMedium(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMedium::WriteMedium(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3284,14 +4152,28 @@ void AttMeiVersion::ResetMeiVersion()
 bool AttMeiVersion::ReadMeiVersion(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meiversion")) {
-        this->SetMeiversion(StrToMeiVersionMeiversion(element.attribute("meiversion").value()));
-        if (removeAttr) element.remove_attribute("meiversion");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMeiVersion::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("meiversion"):
+            if (std::strcmp(name, "meiversion") != 0) break;
+            this->SetMeiversion(StrToMeiVersionMeiversion(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMeiVersion::WriteMeiVersion(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3324,14 +4206,28 @@ void AttMensurLog::ResetMensurLog()
 bool AttMensurLog::ReadMensurLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("level")) {
-        this->SetLevel(StrToDuration(element.attribute("level").value()));
-        if (removeAttr) element.remove_attribute("level");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMensurLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("level"):
+            if (std::strcmp(name, "level") != 0) break;
+            this->SetLevel(StrToDuration(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMensurLog::WriteMensurLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3364,14 +4260,28 @@ void AttMetadataPointing::ResetMetadataPointing()
 bool AttMetadataPointing::ReadMetadataPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("decls")) {
-        this->SetDecls(StrToStr(element.attribute("decls").value()));
-        if (removeAttr) element.remove_attribute("decls");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMetadataPointing::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("decls"):
+            if (std::strcmp(name, "decls") != 0) break;
+            this->SetDecls(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMetadataPointing::WriteMetadataPointing(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3404,14 +4314,28 @@ void AttMeterConformance::ResetMeterConformance()
 bool AttMeterConformance::ReadMeterConformance(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToMeterConformanceMetcon(element.attribute("metcon").value()));
-        if (removeAttr) element.remove_attribute("metcon");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMeterConformance::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("metcon"):
+            if (std::strcmp(name, "metcon") != 0) break;
+            this->SetMetcon(StrToMeterConformanceMetcon(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMeterConformance::WriteMeterConformance(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3445,19 +4369,32 @@ void AttMeterConformanceBar::ResetMeterConformanceBar()
 bool AttMeterConformanceBar::ReadMeterConformanceBar(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToBoolean(element.attribute("metcon").value()));
-        if (removeAttr) element.remove_attribute("metcon");
-        hasAttribute = true;
-    }
-    if (element.attribute("control")) {
-        this->SetControl(StrToBoolean(element.attribute("control").value()));
-        if (removeAttr) element.remove_attribute("control");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMeterConformanceBar::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("metcon"):
+            if (std::strcmp(name, "metcon") != 0) break;
+            this->SetMetcon(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("control"):
+            if (std::strcmp(name, "control") != 0) break;
+            this->SetControl(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMeterConformanceBar::WriteMeterConformanceBar(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3501,24 +4438,36 @@ void AttMeterSigLog::ResetMeterSigLog()
 bool AttMeterSigLog::ReadMeterSigLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("count")) {
-        this->SetCount(StrToMetercountPair(element.attribute("count").value()));
-        if (removeAttr) element.remove_attribute("count");
-        hasAttribute = true;
-    }
-    if (element.attribute("sym")) {
-        this->SetSym(StrToMetersign(element.attribute("sym").value()));
-        if (removeAttr) element.remove_attribute("sym");
-        hasAttribute = true;
-    }
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToInt(element.attribute("unit").value()));
-        if (removeAttr) element.remove_attribute("unit");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMeterSigLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("count"):
+            if (std::strcmp(name, "count") != 0) break;
+            this->SetCount(StrToMetercountPair(attr.value()));
+            return true;
+        case StrHash("sym"):
+            if (std::strcmp(name, "sym") != 0) break;
+            this->SetSym(StrToMetersign(attr.value()));
+            return true;
+        case StrHash("unit"):
+            if (std::strcmp(name, "unit") != 0) break;
+            this->SetUnit(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMeterSigLog::WriteMeterSigLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3571,24 +4520,36 @@ void AttMeterSigDefaultLog::ResetMeterSigDefaultLog()
 bool AttMeterSigDefaultLog::ReadMeterSigDefaultLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.count")) {
-        this->SetMeterCount(StrToMetercountPair(element.attribute("meter.count").value()));
-        if (removeAttr) element.remove_attribute("meter.count");
-        hasAttribute = true;
-    }
-    if (element.attribute("meter.unit")) {
-        this->SetMeterUnit(StrToInt(element.attribute("meter.unit").value()));
-        if (removeAttr) element.remove_attribute("meter.unit");
-        hasAttribute = true;
-    }
-    if (element.attribute("meter.sym")) {
-        this->SetMeterSym(StrToMetersign(element.attribute("meter.sym").value()));
-        if (removeAttr) element.remove_attribute("meter.sym");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMeterSigDefaultLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("meter.count"):
+            if (std::strcmp(name, "meter.count") != 0) break;
+            this->SetMeterCount(StrToMetercountPair(attr.value()));
+            return true;
+        case StrHash("meter.unit"):
+            if (std::strcmp(name, "meter.unit") != 0) break;
+            this->SetMeterUnit(StrToInt(attr.value()));
+            return true;
+        case StrHash("meter.sym"):
+            if (std::strcmp(name, "meter.sym") != 0) break;
+            this->SetMeterSym(StrToMetersign(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMeterSigDefaultLog::WriteMeterSigDefaultLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3641,24 +4602,36 @@ void AttMmTempo::ResetMmTempo()
 bool AttMmTempo::ReadMmTempo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mm")) {
-        this->SetMm(StrToDbl(element.attribute("mm").value()));
-        if (removeAttr) element.remove_attribute("mm");
-        hasAttribute = true;
-    }
-    if (element.attribute("mm.unit")) {
-        this->SetMmUnit(StrToDuration(element.attribute("mm.unit").value()));
-        if (removeAttr) element.remove_attribute("mm.unit");
-        hasAttribute = true;
-    }
-    if (element.attribute("mm.dots")) {
-        this->SetMmDots(StrToInt(element.attribute("mm.dots").value()));
-        if (removeAttr) element.remove_attribute("mm.dots");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMmTempo::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("mm"):
+            if (std::strcmp(name, "mm") != 0) break;
+            this->SetMm(StrToDbl(attr.value()));
+            return true;
+        case StrHash("mm.unit"):
+            if (std::strcmp(name, "mm.unit") != 0) break;
+            this->SetMmUnit(StrToDuration(attr.value()));
+            return true;
+        case StrHash("mm.dots"):
+            if (std::strcmp(name, "mm.dots") != 0) break;
+            this->SetMmDots(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMmTempo::WriteMmTempo(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3709,14 +4682,28 @@ void AttMultinumMeasures::ResetMultinumMeasures()
 bool AttMultinumMeasures::ReadMultinumMeasures(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("multi.number")) {
-        this->SetMultiNumber(StrToBoolean(element.attribute("multi.number").value()));
-        if (removeAttr) element.remove_attribute("multi.number");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMultinumMeasures::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("multi.number"):
+            if (std::strcmp(name, "multi.number") != 0) break;
+            this->SetMultiNumber(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMultinumMeasures::WriteMultinumMeasures(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3749,14 +4736,28 @@ void AttNInteger::ResetNInteger()
 bool AttNInteger::ReadNInteger(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToInt(element.attribute("n").value()));
-        if (removeAttr) element.remove_attribute("n");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNInteger::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("n"):
+            if (std::strcmp(name, "n") != 0) break;
+            this->SetN(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNInteger::WriteNInteger(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3789,14 +4790,28 @@ void AttNNumberLike::ResetNNumberLike()
 bool AttNNumberLike::ReadNNumberLike(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToStr(element.attribute("n").value()));
-        if (removeAttr) element.remove_attribute("n");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNNumberLike::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("n"):
+            if (std::strcmp(name, "n") != 0) break;
+            this->SetN(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNNumberLike::WriteNNumberLike(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3830,19 +4845,32 @@ void AttName::ResetName()
 bool AttName::ReadName(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("nymref")) {
-        this->SetNymref(StrToStr(element.attribute("nymref").value()));
-        if (removeAttr) element.remove_attribute("nymref");
-        hasAttribute = true;
-    }
-    if (element.attribute("role")) {
-        this->SetRole(StrToStr(element.attribute("role").value()));
-        if (removeAttr) element.remove_attribute("role");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttName::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("nymref"):
+            if (std::strcmp(name, "nymref") != 0) break;
+            this->SetNymref(StrToStr(attr.value()));
+            return true;
+        case StrHash("role"):
+            if (std::strcmp(name, "role") != 0) break;
+            this->SetRole(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttName::WriteName(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3885,19 +4913,32 @@ void AttNotationStyle::ResetNotationStyle()
 bool AttNotationStyle::ReadNotationStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("music.name")) {
-        this->SetMusicName(StrToStr(element.attribute("music.name").value()));
-        if (removeAttr) element.remove_attribute("music.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("music.size")) {
-        this->SetMusicSize(StrToFontsize(element.attribute("music.size").value()));
-        if (removeAttr) element.remove_attribute("music.size");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttNotationStyle::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("music.name"):
+            if (std::strcmp(name, "music.name") != 0) break;
+            this->SetMusicName(StrToStr(attr.value()));
+            return true;
+        case StrHash("music.size"):
+            if (std::strcmp(name, "music.size") != 0) break;
+            this->SetMusicSize(StrToFontsize(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttNotationStyle::WriteNotationStyle(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -3947,52 +4988,58 @@ void AttNoteHeads::ResetNoteHeads()
 bool AttNoteHeads::ReadNoteHeads(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("head.altsym")) {
-        this->SetHeadAltsym(StrToStr(element.attribute("head.altsym").value()));
-        if (removeAttr) element.remove_attribute("head.altsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.auth")) {
-        this->SetHeadAuth(StrToStr(element.attribute("head.auth").value()));
-        if (removeAttr) element.remove_attribute("head.auth");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.color")) {
-        this->SetHeadColor(StrToStr(element.attribute("head.color").value()));
-        if (removeAttr) element.remove_attribute("head.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.fill")) {
-        this->SetHeadFill(StrToFill(element.attribute("head.fill").value()));
-        if (removeAttr) element.remove_attribute("head.fill");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.fillcolor")) {
-        this->SetHeadFillcolor(StrToStr(element.attribute("head.fillcolor").value()));
-        if (removeAttr) element.remove_attribute("head.fillcolor");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.mod")) {
-        this->SetHeadMod(StrToNoteheadmodifier(element.attribute("head.mod").value()));
-        if (removeAttr) element.remove_attribute("head.mod");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.rotation")) {
-        this->SetHeadRotation(StrToRotation(element.attribute("head.rotation").value()));
-        if (removeAttr) element.remove_attribute("head.rotation");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.shape")) {
-        this->SetHeadShape(StrToHeadshape(element.attribute("head.shape").value()));
-        if (removeAttr) element.remove_attribute("head.shape");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.visible")) {
-        this->SetHeadVisible(StrToBoolean(element.attribute("head.visible").value()));
-        if (removeAttr) element.remove_attribute("head.visible");
-        hasAttribute = true;
-    }
-    return hasAttribute;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
+        hasAttribute = true;
+    }
+    return hasAttribute;
+}
+
+bool AttNoteHeads::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("head.altsym"):
+            if (std::strcmp(name, "head.altsym") != 0) break;
+            this->SetHeadAltsym(StrToStr(attr.value()));
+            return true;
+        case StrHash("head.auth"):
+            if (std::strcmp(name, "head.auth") != 0) break;
+            this->SetHeadAuth(StrToStr(attr.value()));
+            return true;
+        case StrHash("head.color"):
+            if (std::strcmp(name, "head.color") != 0) break;
+            this->SetHeadColor(StrToStr(attr.value()));
+            return true;
+        case StrHash("head.fill"):
+            if (std::strcmp(name, "head.fill") != 0) break;
+            this->SetHeadFill(StrToFill(attr.value()));
+            return true;
+        case StrHash("head.fillcolor"):
+            if (std::strcmp(name, "head.fillcolor") != 0) break;
+            this->SetHeadFillcolor(StrToStr(attr.value()));
+            return true;
+        case StrHash("head.mod"):
+            if (std::strcmp(name, "head.mod") != 0) break;
+            this->SetHeadMod(StrToNoteheadmodifier(attr.value()));
+            return true;
+        case StrHash("head.rotation"):
+            if (std::strcmp(name, "head.rotation") != 0) break;
+            this->SetHeadRotation(StrToRotation(attr.value()));
+            return true;
+        case StrHash("head.shape"):
+            if (std::strcmp(name, "head.shape") != 0) break;
+            this->SetHeadShape(StrToHeadshape(attr.value()));
+            return true;
+        case StrHash("head.visible"):
+            if (std::strcmp(name, "head.visible") != 0) break;
+            this->SetHeadVisible(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
 }
 
 bool AttNoteHeads::WriteNoteHeads(pugi::xml_node element)
@@ -4099,14 +5146,28 @@ void AttOctave::ResetOctave()
 bool AttOctave::ReadOctave(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToOctave(element.attribute("oct").value()));
-        if (removeAttr) element.remove_attribute("oct");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOctave::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("oct"):
+            if (std::strcmp(name, "oct") != 0) break;
+            this->SetOct(StrToOctave(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOctave::WriteOctave(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4139,14 +5200,28 @@ void AttOctaveDefault::ResetOctaveDefault()
 bool AttOctaveDefault::ReadOctaveDefault(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct.default")) {
-        this->SetOctDefault(StrToOctave(element.attribute("oct.default").value()));
-        if (removeAttr) element.remove_attribute("oct.default");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOctaveDefault::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("oct.default"):
+            if (std::strcmp(name, "oct.default") != 0) break;
+            this->SetOctDefault(StrToOctave(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOctaveDefault::WriteOctaveDefault(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4180,19 +5255,32 @@ void AttOctaveDisplacement::ResetOctaveDisplacement()
 bool AttOctaveDisplacement::ReadOctaveDisplacement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dis")) {
-        this->SetDis(StrToOctaveDis(element.attribute("dis").value()));
-        if (removeAttr) element.remove_attribute("dis");
-        hasAttribute = true;
-    }
-    if (element.attribute("dis.place")) {
-        this->SetDisPlace(StrToStaffrelBasic(element.attribute("dis.place").value()));
-        if (removeAttr) element.remove_attribute("dis.place");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOctaveDisplacement::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dis"):
+            if (std::strcmp(name, "dis") != 0) break;
+            this->SetDis(StrToOctaveDis(attr.value()));
+            return true;
+        case StrHash("dis.place"):
+            if (std::strcmp(name, "dis.place") != 0) break;
+            this->SetDisPlace(StrToStaffrelBasic(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOctaveDisplacement::WriteOctaveDisplacement(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4234,14 +5322,28 @@ void AttOneLineStaff::ResetOneLineStaff()
 bool AttOneLineStaff::ReadOneLineStaff(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ontheline")) {
-        this->SetOntheline(StrToBoolean(element.attribute("ontheline").value()));
-        if (removeAttr) element.remove_attribute("ontheline");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOneLineStaff::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("ontheline"):
+            if (std::strcmp(name, "ontheline") != 0) break;
+            this->SetOntheline(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOneLineStaff::WriteOneLineStaff(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4274,14 +5376,28 @@ void AttOptimization::ResetOptimization()
 bool AttOptimization::ReadOptimization(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("optimize")) {
-        this->SetOptimize(StrToBoolean(element.attribute("optimize").value()));
-        if (removeAttr) element.remove_attribute("optimize");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOptimization::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("optimize"):
+            if (std::strcmp(name, "optimize") != 0) break;
+            this->SetOptimize(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOptimization::WriteOptimization(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4314,14 +5430,28 @@ void AttOriginLayerIdent::ResetOriginLayerIdent()
 bool AttOriginLayerIdent::ReadOriginLayerIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.layer")) {
-        this->SetOriginLayer(StrToStr(element.attribute("origin.layer").value()));
-        if (removeAttr) element.remove_attribute("origin.layer");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOriginLayerIdent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("origin.layer"):
+            if (std::strcmp(name, "origin.layer") != 0) break;
+            this->SetOriginLayer(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOriginLayerIdent::WriteOriginLayerIdent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4354,14 +5484,28 @@ void AttOriginStaffIdent::ResetOriginStaffIdent()
 bool AttOriginStaffIdent::ReadOriginStaffIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.staff")) {
-        this->SetOriginStaff(StrToStr(element.attribute("origin.staff").value()));
-        if (removeAttr) element.remove_attribute("origin.staff");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOriginStaffIdent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("origin.staff"):
+            if (std::strcmp(name, "origin.staff") != 0) break;
+            this->SetOriginStaff(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOriginStaffIdent::WriteOriginStaffIdent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4395,19 +5539,32 @@ void AttOriginStartEndId::ResetOriginStartEndId()
 bool AttOriginStartEndId::ReadOriginStartEndId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.startid")) {
-        this->SetOriginStartid(StrToStr(element.attribute("origin.startid").value()));
-        if (removeAttr) element.remove_attribute("origin.startid");
-        hasAttribute = true;
-    }
-    if (element.attribute("origin.endid")) {
-        this->SetOriginEndid(StrToStr(element.attribute("origin.endid").value()));
-        if (removeAttr) element.remove_attribute("origin.endid");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOriginStartEndId::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("origin.startid"):
+            if (std::strcmp(name, "origin.startid") != 0) break;
+            this->SetOriginStartid(StrToStr(attr.value()));
+            return true;
+        case StrHash("origin.endid"):
+            if (std::strcmp(name, "origin.endid") != 0) break;
+            this->SetOriginEndid(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOriginStartEndId::WriteOriginStartEndId(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4450,19 +5607,32 @@ void AttOriginTimestampLog::ResetOriginTimestampLog()
 bool AttOriginTimestampLog::ReadOriginTimestampLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.tstamp")) {
-        this->SetOriginTstamp(StrToMeasurebeat(element.attribute("origin.tstamp").value()));
-        if (removeAttr) element.remove_attribute("origin.tstamp");
-        hasAttribute = true;
-    }
-    if (element.attribute("origin.tstamp2")) {
-        this->SetOriginTstamp2(StrToMeasurebeat(element.attribute("origin.tstamp2").value()));
-        if (removeAttr) element.remove_attribute("origin.tstamp2");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttOriginTimestampLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("origin.tstamp"):
+            if (std::strcmp(name, "origin.tstamp") != 0) break;
+            this->SetOriginTstamp(StrToMeasurebeat(attr.value()));
+            return true;
+        case StrHash("origin.tstamp2"):
+            if (std::strcmp(name, "origin.tstamp2") != 0) break;
+            this->SetOriginTstamp2(StrToMeasurebeat(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttOriginTimestampLog::WriteOriginTimestampLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4511,47 +5681,54 @@ void AttPages::ResetPages()
 bool AttPages::ReadPages(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("page.height")) {
-        this->SetPageHeight(StrToMeasurementunsigned(element.attribute("page.height").value()));
-        if (removeAttr) element.remove_attribute("page.height");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.width")) {
-        this->SetPageWidth(StrToMeasurementunsigned(element.attribute("page.width").value()));
-        if (removeAttr) element.remove_attribute("page.width");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.topmar")) {
-        this->SetPageTopmar(StrToMeasurementunsigned(element.attribute("page.topmar").value()));
-        if (removeAttr) element.remove_attribute("page.topmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.botmar")) {
-        this->SetPageBotmar(StrToMeasurementunsigned(element.attribute("page.botmar").value()));
-        if (removeAttr) element.remove_attribute("page.botmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.leftmar")) {
-        this->SetPageLeftmar(StrToMeasurementunsigned(element.attribute("page.leftmar").value()));
-        if (removeAttr) element.remove_attribute("page.leftmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.rightmar")) {
-        this->SetPageRightmar(StrToMeasurementunsigned(element.attribute("page.rightmar").value()));
-        if (removeAttr) element.remove_attribute("page.rightmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.panels")) {
-        this->SetPagePanels(StrToStr(element.attribute("page.panels").value()));
-        if (removeAttr) element.remove_attribute("page.panels");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.scale")) {
-        this->SetPageScale(StrToStr(element.attribute("page.scale").value()));
-        if (removeAttr) element.remove_attribute("page.scale");
-        hasAttribute = true;
-    }
-    return hasAttribute;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
+        hasAttribute = true;
+    }
+    return hasAttribute;
+}
+
+bool AttPages::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("page.height"):
+            if (std::strcmp(name, "page.height") != 0) break;
+            this->SetPageHeight(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("page.width"):
+            if (std::strcmp(name, "page.width") != 0) break;
+            this->SetPageWidth(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("page.topmar"):
+            if (std::strcmp(name, "page.topmar") != 0) break;
+            this->SetPageTopmar(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("page.botmar"):
+            if (std::strcmp(name, "page.botmar") != 0) break;
+            this->SetPageBotmar(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("page.leftmar"):
+            if (std::strcmp(name, "page.leftmar") != 0) break;
+            this->SetPageLeftmar(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("page.rightmar"):
+            if (std::strcmp(name, "page.rightmar") != 0) break;
+            this->SetPageRightmar(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("page.panels"):
+            if (std::strcmp(name, "page.panels") != 0) break;
+            this->SetPagePanels(StrToStr(attr.value()));
+            return true;
+        case StrHash("page.scale"):
+            if (std::strcmp(name, "page.scale") != 0) break;
+            this->SetPageScale(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
 }
 
 bool AttPages::WritePages(pugi::xml_node element)
@@ -4650,19 +5827,32 @@ void AttPartIdent::ResetPartIdent()
 bool AttPartIdent::ReadPartIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("part")) {
-        this->SetPart(StrToStr(element.attribute("part").value()));
-        if (removeAttr) element.remove_attribute("part");
-        hasAttribute = true;
-    }
-    if (element.attribute("partstaff")) {
-        this->SetPartstaff(StrToStr(element.attribute("partstaff").value()));
-        if (removeAttr) element.remove_attribute("partstaff");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPartIdent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("part"):
+            if (std::strcmp(name, "part") != 0) break;
+            this->SetPart(StrToStr(attr.value()));
+            return true;
+        case StrHash("partstaff"):
+            if (std::strcmp(name, "partstaff") != 0) break;
+            this->SetPartstaff(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPartIdent::WritePartIdent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4704,14 +5894,28 @@ void AttPitch::ResetPitch()
 bool AttPitch::ReadPitch(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pname")) {
-        this->SetPname(StrToPitchname(element.attribute("pname").value()));
-        if (removeAttr) element.remove_attribute("pname");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPitch::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("pname"):
+            if (std::strcmp(name, "pname") != 0) break;
+            this->SetPname(StrToPitchname(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPitch::WritePitch(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4744,14 +5948,28 @@ void AttPlacementOnStaff::ResetPlacementOnStaff()
 bool AttPlacementOnStaff::ReadPlacementOnStaff(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("onstaff")) {
-        this->SetOnstaff(StrToBoolean(element.attribute("onstaff").value()));
-        if (removeAttr) element.remove_attribute("onstaff");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPlacementOnStaff::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("onstaff"):
+            if (std::strcmp(name, "onstaff") != 0) break;
+            this->SetOnstaff(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPlacementOnStaff::WritePlacementOnStaff(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4784,14 +6002,28 @@ void AttPlacementRelEvent::ResetPlacementRelEvent()
 bool AttPlacementRelEvent::ReadPlacementRelEvent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToStaffrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPlacementRelEvent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("place"):
+            if (std::strcmp(name, "place") != 0) break;
+            this->SetPlace(StrToStaffrel(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPlacementRelEvent::WritePlacementRelEvent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4824,14 +6056,28 @@ void AttPlacementRelStaff::ResetPlacementRelStaff()
 bool AttPlacementRelStaff::ReadPlacementRelStaff(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToStaffrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPlacementRelStaff::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("place"):
+            if (std::strcmp(name, "place") != 0) break;
+            this->SetPlace(StrToStaffrel(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPlacementRelStaff::WritePlacementRelStaff(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4864,14 +6110,28 @@ void AttPlist::ResetPlist()
 bool AttPlist::ReadPlist(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("plist")) {
-        this->SetPlist(StrToXsdAnyURIList(element.attribute("plist").value()));
-        if (removeAttr) element.remove_attribute("plist");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPlist::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("plist"):
+            if (std::strcmp(name, "plist") != 0) break;
+            this->SetPlist(StrToXsdAnyURIList(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPlist::WritePlist(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -4908,34 +6168,44 @@ void AttPointing::ResetPointing()
 bool AttPointing::ReadPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xlink:actuate")) {
-        this->SetActuate(StrToStr(element.attribute("xlink:actuate").value()));
-        if (removeAttr) element.remove_attribute("xlink:actuate");
-        hasAttribute = true;
-    }
-    if (element.attribute("xlink:role")) {
-        this->SetRole(StrToStr(element.attribute("xlink:role").value()));
-        if (removeAttr) element.remove_attribute("xlink:role");
-        hasAttribute = true;
-    }
-    if (element.attribute("xlink:show")) {
-        this->SetShow(StrToStr(element.attribute("xlink:show").value()));
-        if (removeAttr) element.remove_attribute("xlink:show");
-        hasAttribute = true;
-    }
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        if (removeAttr) element.remove_attribute("target");
-        hasAttribute = true;
-    }
-    if (element.attribute("targettype")) {
-        this->SetTargettype(StrToStr(element.attribute("targettype").value()));
-        if (removeAttr) element.remove_attribute("targettype");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPointing::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("xlink:actuate"):
+            if (std::strcmp(name, "xlink:actuate") != 0) break;
+            this->SetActuate(StrToStr(attr.value()));
+            return true;
+        case StrHash("xlink:role"):
+            if (std::strcmp(name, "xlink:role") != 0) break;
+            this->SetRole(StrToStr(attr.value()));
+            return true;
+        case StrHash("xlink:show"):
+            if (std::strcmp(name, "xlink:show") != 0) break;
+            this->SetShow(StrToStr(attr.value()));
+            return true;
+        case StrHash("target"):
+            if (std::strcmp(name, "target") != 0) break;
+            this->SetTarget(StrToStr(attr.value()));
+            return true;
+        case StrHash("targettype"):
+            if (std::strcmp(name, "targettype") != 0) break;
+            this->SetTargettype(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPointing::WritePointing(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5004,14 +6274,28 @@ void AttQuantity::ResetQuantity()
 bool AttQuantity::ReadQuantity(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("quantity")) {
-        this->SetQuantity(StrToDbl(element.attribute("quantity").value()));
-        if (removeAttr) element.remove_attribute("quantity");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttQuantity::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("quantity"):
+            if (std::strcmp(name, "quantity") != 0) break;
+            this->SetQuantity(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttQuantity::WriteQuantity(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5048,34 +6332,44 @@ void AttRanging::ResetRanging()
 bool AttRanging::ReadRanging(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("atleast")) {
-        this->SetAtleast(StrToDbl(element.attribute("atleast").value()));
-        if (removeAttr) element.remove_attribute("atleast");
-        hasAttribute = true;
-    }
-    if (element.attribute("atmost")) {
-        this->SetAtmost(StrToDbl(element.attribute("atmost").value()));
-        if (removeAttr) element.remove_attribute("atmost");
-        hasAttribute = true;
-    }
-    if (element.attribute("min")) {
-        this->SetMin(StrToDbl(element.attribute("min").value()));
-        if (removeAttr) element.remove_attribute("min");
-        hasAttribute = true;
-    }
-    if (element.attribute("max")) {
-        this->SetMax(StrToDbl(element.attribute("max").value()));
-        if (removeAttr) element.remove_attribute("max");
-        hasAttribute = true;
-    }
-    if (element.attribute("confidence")) {
-        this->SetConfidence(StrToDbl(element.attribute("confidence").value()));
-        if (removeAttr) element.remove_attribute("confidence");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttRanging::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("atleast"):
+            if (std::strcmp(name, "atleast") != 0) break;
+            this->SetAtleast(StrToDbl(attr.value()));
+            return true;
+        case StrHash("atmost"):
+            if (std::strcmp(name, "atmost") != 0) break;
+            this->SetAtmost(StrToDbl(attr.value()));
+            return true;
+        case StrHash("min"):
+            if (std::strcmp(name, "min") != 0) break;
+            this->SetMin(StrToDbl(attr.value()));
+            return true;
+        case StrHash("max"):
+            if (std::strcmp(name, "max") != 0) break;
+            this->SetMax(StrToDbl(attr.value()));
+            return true;
+        case StrHash("confidence"):
+            if (std::strcmp(name, "confidence") != 0) break;
+            this->SetConfidence(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttRanging::WriteRanging(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5144,14 +6438,28 @@ void AttRepeatMarkLog::ResetRepeatMarkLog()
 bool AttRepeatMarkLog::ReadRepeatMarkLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToRepeatMarkLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttRepeatMarkLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("func"):
+            if (std::strcmp(name, "func") != 0) break;
+            this->SetFunc(StrToRepeatMarkLogFunc(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttRepeatMarkLog::WriteRepeatMarkLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5184,12 +6492,26 @@ void AttResponsibility::ResetResponsibility()
 bool AttResponsibility::ReadResponsibility(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("resp")) {
-        this->SetResp(StrToStr(element.attribute("resp").value()));
-        if (removeAttr) element.remove_attribute("resp");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    return hasAttribute;
+    return hasAttribute;
+}
+
+bool AttResponsibility::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("resp"):
+            if (std::strcmp(name, "resp") != 0) break;
+            this->SetResp(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
 }
 
 bool AttResponsibility::WriteResponsibility(pugi::xml_node element)
@@ -5224,14 +6546,28 @@ void AttRestdurationLog::ResetRestdurationLog()
 bool AttRestdurationLog::ReadRestdurationLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        if (removeAttr) element.remove_attribute("dur");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttRestdurationLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dur"):
+            if (std::strcmp(name, "dur") != 0) break;
+            this->SetDur(StrToDuration(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttRestdurationLog::WriteRestdurationLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5264,14 +6600,28 @@ void AttScalable::ResetScalable()
 bool AttScalable::ReadScalable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("scale")) {
-        this->SetScale(StrToPercent(element.attribute("scale").value()));
-        if (removeAttr) element.remove_attribute("scale");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttScalable::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("scale"):
+            if (std::strcmp(name, "scale") != 0) break;
+            this->SetScale(StrToPercent(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttScalable::WriteScalable(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5304,14 +6654,28 @@ void AttSequence::ResetSequence()
 bool AttSequence::ReadSequence(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("seq")) {
-        this->SetSeq(StrToInt(element.attribute("seq").value()));
-        if (removeAttr) element.remove_attribute("seq");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSequence::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("seq"):
+            if (std::strcmp(name, "seq") != 0) break;
+            this->SetSeq(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSequence::WriteSequence(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5344,14 +6708,28 @@ void AttSlashCount::ResetSlashCount()
 bool AttSlashCount::ReadSlashCount(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToInt(element.attribute("slash").value()));
-        if (removeAttr) element.remove_attribute("slash");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSlashCount::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("slash"):
+            if (std::strcmp(name, "slash") != 0) break;
+            this->SetSlash(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSlashCount::WriteSlashCount(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5384,14 +6762,28 @@ void AttSlurPresent::ResetSlurPresent()
 bool AttSlurPresent::ReadSlurPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur")) {
-        this->SetSlur(StrToStr(element.attribute("slur").value()));
-        if (removeAttr) element.remove_attribute("slur");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSlurPresent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("slur"):
+            if (std::strcmp(name, "slur") != 0) break;
+            this->SetSlur(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSlurPresent::WriteSlurPresent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5424,14 +6816,28 @@ void AttSource::ResetSource()
 bool AttSource::ReadSource(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("source")) {
-        this->SetSource(StrToStr(element.attribute("source").value()));
-        if (removeAttr) element.remove_attribute("source");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSource::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("source"):
+            if (std::strcmp(name, "source") != 0) break;
+            this->SetSource(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSource::WriteSource(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5467,29 +6873,40 @@ void AttSpacing::ResetSpacing()
 bool AttSpacing::ReadSpacing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("spacing.packexp")) {
-        this->SetSpacingPackexp(StrToDbl(element.attribute("spacing.packexp").value()));
-        if (removeAttr) element.remove_attribute("spacing.packexp");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing.packfact")) {
-        this->SetSpacingPackfact(StrToDbl(element.attribute("spacing.packfact").value()));
-        if (removeAttr) element.remove_attribute("spacing.packfact");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing.staff")) {
-        this->SetSpacingStaff(StrToMeasurementsigned(element.attribute("spacing.staff").value()));
-        if (removeAttr) element.remove_attribute("spacing.staff");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing.system")) {
-        this->SetSpacingSystem(StrToMeasurementsigned(element.attribute("spacing.system").value()));
-        if (removeAttr) element.remove_attribute("spacing.system");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSpacing::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("spacing.packexp"):
+            if (std::strcmp(name, "spacing.packexp") != 0) break;
+            this->SetSpacingPackexp(StrToDbl(attr.value()));
+            return true;
+        case StrHash("spacing.packfact"):
+            if (std::strcmp(name, "spacing.packfact") != 0) break;
+            this->SetSpacingPackfact(StrToDbl(attr.value()));
+            return true;
+        case StrHash("spacing.staff"):
+            if (std::strcmp(name, "spacing.staff") != 0) break;
+            this->SetSpacingStaff(StrToMeasurementsigned(attr.value()));
+            return true;
+        case StrHash("spacing.system"):
+            if (std::strcmp(name, "spacing.system") != 0) break;
+            this->SetSpacingSystem(StrToMeasurementsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSpacing::WriteSpacing(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5549,14 +6966,28 @@ void AttStaffLog::ResetStaffLog()
 bool AttStaffLog::ReadStaffLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        if (removeAttr) element.remove_attribute("def");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStaffLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("def"):
+            if (std::strcmp(name, "def") != 0) break;
+            this->SetDef(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStaffLog::WriteStaffLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5589,14 +7020,28 @@ void AttStaffDefLog::ResetStaffDefLog()
 bool AttStaffDefLog::ReadStaffDefLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lines")) {
-        this->SetLines(StrToInt(element.attribute("lines").value()));
-        if (removeAttr) element.remove_attribute("lines");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStaffDefLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("lines"):
+            if (std::strcmp(name, "lines") != 0) break;
+            this->SetLines(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStaffDefLog::WriteStaffDefLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5629,14 +7074,28 @@ void AttStaffGroupingSym::ResetStaffGroupingSym()
 bool AttStaffGroupingSym::ReadStaffGroupingSym(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("symbol")) {
-        this->SetSymbol(StrToStaffGroupingSymSymbol(element.attribute("symbol").value()));
-        if (removeAttr) element.remove_attribute("symbol");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStaffGroupingSym::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("symbol"):
+            if (std::strcmp(name, "symbol") != 0) break;
+            this->SetSymbol(StrToStaffGroupingSymSymbol(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStaffGroupingSym::WriteStaffGroupingSym(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5669,14 +7128,28 @@ void AttStaffIdent::ResetStaffIdent()
 bool AttStaffIdent::ReadStaffIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("staff")) {
-        this->SetStaff(StrToXsdPositiveIntegerList(element.attribute("staff").value()));
-        if (removeAttr) element.remove_attribute("staff");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStaffIdent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("staff"):
+            if (std::strcmp(name, "staff") != 0) break;
+            this->SetStaff(StrToXsdPositiveIntegerList(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStaffIdent::WriteStaffIdent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5711,24 +7184,36 @@ void AttStaffItems::ResetStaffItems()
 bool AttStaffItems::ReadStaffItems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("aboveorder")) {
-        this->SetAboveorder(StrToStaffitem(element.attribute("aboveorder").value()));
-        if (removeAttr) element.remove_attribute("aboveorder");
-        hasAttribute = true;
-    }
-    if (element.attribute("beloworder")) {
-        this->SetBeloworder(StrToStaffitem(element.attribute("beloworder").value()));
-        if (removeAttr) element.remove_attribute("beloworder");
-        hasAttribute = true;
-    }
-    if (element.attribute("betweenorder")) {
-        this->SetBetweenorder(StrToStaffitem(element.attribute("betweenorder").value()));
-        if (removeAttr) element.remove_attribute("betweenorder");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStaffItems::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("aboveorder"):
+            if (std::strcmp(name, "aboveorder") != 0) break;
+            this->SetAboveorder(StrToStaffitem(attr.value()));
+            return true;
+        case StrHash("beloworder"):
+            if (std::strcmp(name, "beloworder") != 0) break;
+            this->SetBeloworder(StrToStaffitem(attr.value()));
+            return true;
+        case StrHash("betweenorder"):
+            if (std::strcmp(name, "betweenorder") != 0) break;
+            this->SetBetweenorder(StrToStaffitem(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStaffItems::WriteStaffItems(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5779,14 +7264,28 @@ void AttStaffLoc::ResetStaffLoc()
 bool AttStaffLoc::ReadStaffLoc(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("loc")) {
-        this->SetLoc(StrToInt(element.attribute("loc").value()));
-        if (removeAttr) element.remove_attribute("loc");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStaffLoc::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("loc"):
+            if (std::strcmp(name, "loc") != 0) break;
+            this->SetLoc(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStaffLoc::WriteStaffLoc(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5820,19 +7319,32 @@ void AttStaffLocPitched::ResetStaffLocPitched()
 bool AttStaffLocPitched::ReadStaffLocPitched(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ploc")) {
-        this->SetPloc(StrToPitchname(element.attribute("ploc").value()));
-        if (removeAttr) element.remove_attribute("ploc");
-        hasAttribute = true;
-    }
-    if (element.attribute("oloc")) {
-        this->SetOloc(StrToOctave(element.attribute("oloc").value()));
-        if (removeAttr) element.remove_attribute("oloc");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStaffLocPitched::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("ploc"):
+            if (std::strcmp(name, "ploc") != 0) break;
+            this->SetPloc(StrToPitchname(attr.value()));
+            return true;
+        case StrHash("oloc"):
+            if (std::strcmp(name, "oloc") != 0) break;
+            this->SetOloc(StrToOctave(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStaffLocPitched::WriteStaffLocPitched(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5874,14 +7386,28 @@ void AttStartEndId::ResetStartEndId()
 bool AttStartEndId::ReadStartEndId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("endid")) {
-        this->SetEndid(StrToStr(element.attribute("endid").value()));
-        if (removeAttr) element.remove_attribute("endid");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStartEndId::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("endid"):
+            if (std::strcmp(name, "endid") != 0) break;
+            this->SetEndid(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStartEndId::WriteStartEndId(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5914,14 +7440,28 @@ void AttStartId::ResetStartId()
 bool AttStartId::ReadStartId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startid")) {
-        this->SetStartid(StrToStr(element.attribute("startid").value()));
-        if (removeAttr) element.remove_attribute("startid");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStartId::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("startid"):
+            if (std::strcmp(name, "startid") != 0) break;
+            this->SetStartid(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStartId::WriteStartId(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -5961,47 +7501,54 @@ void AttStems::ResetStems()
 bool AttStems::ReadStems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.dir")) {
-        this->SetStemDir(StrToStemdirection(element.attribute("stem.dir").value()));
-        if (removeAttr) element.remove_attribute("stem.dir");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.len")) {
-        this->SetStemLen(StrToDbl(element.attribute("stem.len").value()));
-        if (removeAttr) element.remove_attribute("stem.len");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.mod")) {
-        this->SetStemMod(StrToStemmodifier(element.attribute("stem.mod").value()));
-        if (removeAttr) element.remove_attribute("stem.mod");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.pos")) {
-        this->SetStemPos(StrToStemposition(element.attribute("stem.pos").value()));
-        if (removeAttr) element.remove_attribute("stem.pos");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.sameas")) {
-        this->SetStemSameas(StrToStr(element.attribute("stem.sameas").value()));
-        if (removeAttr) element.remove_attribute("stem.sameas");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.visible")) {
-        this->SetStemVisible(StrToBoolean(element.attribute("stem.visible").value()));
-        if (removeAttr) element.remove_attribute("stem.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.x")) {
-        this->SetStemX(StrToDbl(element.attribute("stem.x").value()));
-        if (removeAttr) element.remove_attribute("stem.x");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.y")) {
-        this->SetStemY(StrToDbl(element.attribute("stem.y").value()));
-        if (removeAttr) element.remove_attribute("stem.y");
-        hasAttribute = true;
-    }
-    return hasAttribute;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
+        hasAttribute = true;
+    }
+    return hasAttribute;
+}
+
+bool AttStems::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("stem.dir"):
+            if (std::strcmp(name, "stem.dir") != 0) break;
+            this->SetStemDir(StrToStemdirection(attr.value()));
+            return true;
+        case StrHash("stem.len"):
+            if (std::strcmp(name, "stem.len") != 0) break;
+            this->SetStemLen(StrToDbl(attr.value()));
+            return true;
+        case StrHash("stem.mod"):
+            if (std::strcmp(name, "stem.mod") != 0) break;
+            this->SetStemMod(StrToStemmodifier(attr.value()));
+            return true;
+        case StrHash("stem.pos"):
+            if (std::strcmp(name, "stem.pos") != 0) break;
+            this->SetStemPos(StrToStemposition(attr.value()));
+            return true;
+        case StrHash("stem.sameas"):
+            if (std::strcmp(name, "stem.sameas") != 0) break;
+            this->SetStemSameas(StrToStr(attr.value()));
+            return true;
+        case StrHash("stem.visible"):
+            if (std::strcmp(name, "stem.visible") != 0) break;
+            this->SetStemVisible(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("stem.x"):
+            if (std::strcmp(name, "stem.x") != 0) break;
+            this->SetStemX(StrToDbl(attr.value()));
+            return true;
+        case StrHash("stem.y"):
+            if (std::strcmp(name, "stem.y") != 0) break;
+            this->SetStemY(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
 }
 
 bool AttStems::WriteStems(pugi::xml_node element)
@@ -6100,19 +7647,32 @@ void AttSylLog::ResetSylLog()
 bool AttSylLog::ReadSylLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("con")) {
-        this->SetCon(StrToSylLogCon(element.attribute("con").value()));
-        if (removeAttr) element.remove_attribute("con");
-        hasAttribute = true;
-    }
-    if (element.attribute("wordpos")) {
-        this->SetWordpos(StrToSylLogWordpos(element.attribute("wordpos").value()));
-        if (removeAttr) element.remove_attribute("wordpos");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSylLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("con"):
+            if (std::strcmp(name, "con") != 0) break;
+            this->SetCon(StrToSylLogCon(attr.value()));
+            return true;
+        case StrHash("wordpos"):
+            if (std::strcmp(name, "wordpos") != 0) break;
+            this->SetWordpos(StrToSylLogWordpos(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSylLog::WriteSylLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6154,14 +7714,28 @@ void AttSylText::ResetSylText()
 bool AttSylText::ReadSylText(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("syl")) {
-        this->SetSyl(StrToStr(element.attribute("syl").value()));
-        if (removeAttr) element.remove_attribute("syl");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSylText::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("syl"):
+            if (std::strcmp(name, "syl") != 0) break;
+            this->SetSyl(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSylText::WriteSylText(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6197,29 +7771,40 @@ void AttSystems::ResetSystems()
 bool AttSystems::ReadSystems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("system.leftline")) {
-        this->SetSystemLeftline(StrToBoolean(element.attribute("system.leftline").value()));
-        if (removeAttr) element.remove_attribute("system.leftline");
-        hasAttribute = true;
-    }
-    if (element.attribute("system.leftmar")) {
-        this->SetSystemLeftmar(StrToMeasurementunsigned(element.attribute("system.leftmar").value()));
-        if (removeAttr) element.remove_attribute("system.leftmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("system.rightmar")) {
-        this->SetSystemRightmar(StrToMeasurementunsigned(element.attribute("system.rightmar").value()));
-        if (removeAttr) element.remove_attribute("system.rightmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("system.topmar")) {
-        this->SetSystemTopmar(StrToMeasurementunsigned(element.attribute("system.topmar").value()));
-        if (removeAttr) element.remove_attribute("system.topmar");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSystems::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("system.leftline"):
+            if (std::strcmp(name, "system.leftline") != 0) break;
+            this->SetSystemLeftline(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("system.leftmar"):
+            if (std::strcmp(name, "system.leftmar") != 0) break;
+            this->SetSystemLeftmar(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("system.rightmar"):
+            if (std::strcmp(name, "system.rightmar") != 0) break;
+            this->SetSystemRightmar(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("system.topmar"):
+            if (std::strcmp(name, "system.topmar") != 0) break;
+            this->SetSystemTopmar(StrToMeasurementunsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSystems::WriteSystems(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6279,14 +7864,28 @@ void AttTargetEval::ResetTargetEval()
 bool AttTargetEval::ReadTargetEval(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("evaluate")) {
-        this->SetEvaluate(StrToTargetEvalEvaluate(element.attribute("evaluate").value()));
-        if (removeAttr) element.remove_attribute("evaluate");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTargetEval::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("evaluate"):
+            if (std::strcmp(name, "evaluate") != 0) break;
+            this->SetEvaluate(StrToTargetEvalEvaluate(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTargetEval::WriteTargetEval(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6319,14 +7918,28 @@ void AttTempoLog::ResetTempoLog()
 bool AttTempoLog::ReadTempoLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToTempoLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTempoLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("func"):
+            if (std::strcmp(name, "func") != 0) break;
+            this->SetFunc(StrToTempoLogFunc(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTempoLog::WriteTempoLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6360,19 +7973,32 @@ void AttTextRendition::ResetTextRendition()
 bool AttTextRendition::ReadTextRendition(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("altrend")) {
-        this->SetAltrend(StrToStr(element.attribute("altrend").value()));
-        if (removeAttr) element.remove_attribute("altrend");
-        hasAttribute = true;
-    }
-    if (element.attribute("rend")) {
-        this->SetRend(StrToTextrendition(element.attribute("rend").value()));
-        if (removeAttr) element.remove_attribute("rend");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTextRendition::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("altrend"):
+            if (std::strcmp(name, "altrend") != 0) break;
+            this->SetAltrend(StrToStr(attr.value()));
+            return true;
+        case StrHash("rend"):
+            if (std::strcmp(name, "rend") != 0) break;
+            this->SetRend(StrToTextrendition(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTextRendition::WriteTextRendition(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6418,34 +8044,44 @@ void AttTextStyle::ResetTextStyle()
 bool AttTextStyle::ReadTextStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("text.fam")) {
-        this->SetTextFam(StrToStr(element.attribute("text.fam").value()));
-        if (removeAttr) element.remove_attribute("text.fam");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.name")) {
-        this->SetTextName(StrToStr(element.attribute("text.name").value()));
-        if (removeAttr) element.remove_attribute("text.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.size")) {
-        this->SetTextSize(StrToFontsize(element.attribute("text.size").value()));
-        if (removeAttr) element.remove_attribute("text.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.style")) {
-        this->SetTextStyle(StrToFontstyle(element.attribute("text.style").value()));
-        if (removeAttr) element.remove_attribute("text.style");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.weight")) {
-        this->SetTextWeight(StrToFontweight(element.attribute("text.weight").value()));
-        if (removeAttr) element.remove_attribute("text.weight");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTextStyle::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("text.fam"):
+            if (std::strcmp(name, "text.fam") != 0) break;
+            this->SetTextFam(StrToStr(attr.value()));
+            return true;
+        case StrHash("text.name"):
+            if (std::strcmp(name, "text.name") != 0) break;
+            this->SetTextName(StrToStr(attr.value()));
+            return true;
+        case StrHash("text.size"):
+            if (std::strcmp(name, "text.size") != 0) break;
+            this->SetTextSize(StrToFontsize(attr.value()));
+            return true;
+        case StrHash("text.style"):
+            if (std::strcmp(name, "text.style") != 0) break;
+            this->SetTextStyle(StrToFontstyle(attr.value()));
+            return true;
+        case StrHash("text.weight"):
+            if (std::strcmp(name, "text.weight") != 0) break;
+            this->SetTextWeight(StrToFontweight(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTextStyle::WriteTextStyle(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6514,14 +8150,28 @@ void AttTiePresent::ResetTiePresent()
 bool AttTiePresent::ReadTiePresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie")) {
-        this->SetTie(StrToTie(element.attribute("tie").value()));
-        if (removeAttr) element.remove_attribute("tie");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTiePresent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("tie"):
+            if (std::strcmp(name, "tie") != 0) break;
+            this->SetTie(StrToTie(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTiePresent::WriteTiePresent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6554,14 +8204,28 @@ void AttTimestampLog::ResetTimestampLog()
 bool AttTimestampLog::ReadTimestampLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp")) {
-        this->SetTstamp(StrToDbl(element.attribute("tstamp").value()));
-        if (removeAttr) element.remove_attribute("tstamp");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTimestampLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("tstamp"):
+            if (std::strcmp(name, "tstamp") != 0) break;
+            this->SetTstamp(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTimestampLog::WriteTimestampLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6594,14 +8258,28 @@ void AttTimestamp2Log::ResetTimestamp2Log()
 bool AttTimestamp2Log::ReadTimestamp2Log(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp2")) {
-        this->SetTstamp2(StrToMeasurebeat(element.attribute("tstamp2").value()));
-        if (removeAttr) element.remove_attribute("tstamp2");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTimestamp2Log::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("tstamp2"):
+            if (std::strcmp(name, "tstamp2") != 0) break;
+            this->SetTstamp2(StrToMeasurebeat(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTimestamp2Log::WriteTimestamp2Log(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6635,19 +8313,32 @@ void AttTransposition::ResetTransposition()
 bool AttTransposition::ReadTransposition(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("trans.diat")) {
-        this->SetTransDiat(StrToInt(element.attribute("trans.diat").value()));
-        if (removeAttr) element.remove_attribute("trans.diat");
-        hasAttribute = true;
-    }
-    if (element.attribute("trans.semi")) {
-        this->SetTransSemi(StrToInt(element.attribute("trans.semi").value()));
-        if (removeAttr) element.remove_attribute("trans.semi");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTransposition::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("trans.diat"):
+            if (std::strcmp(name, "trans.diat") != 0) break;
+            this->SetTransDiat(StrToInt(attr.value()));
+            return true;
+        case StrHash("trans.semi"):
+            if (std::strcmp(name, "trans.semi") != 0) break;
+            this->SetTransSemi(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTransposition::WriteTransposition(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6691,24 +8382,36 @@ void AttTuning::ResetTuning()
 bool AttTuning::ReadTuning(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tune.Hz")) {
-        this->SetTuneHz(StrToDbl(element.attribute("tune.Hz").value()));
-        if (removeAttr) element.remove_attribute("tune.Hz");
-        hasAttribute = true;
-    }
-    if (element.attribute("tune.pname")) {
-        this->SetTunePname(StrToPitchname(element.attribute("tune.pname").value()));
-        if (removeAttr) element.remove_attribute("tune.pname");
-        hasAttribute = true;
-    }
-    if (element.attribute("tune.temper")) {
-        this->SetTuneTemper(StrToTemperament(element.attribute("tune.temper").value()));
-        if (removeAttr) element.remove_attribute("tune.temper");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTuning::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("tune.Hz"):
+            if (std::strcmp(name, "tune.Hz") != 0) break;
+            this->SetTuneHz(StrToDbl(attr.value()));
+            return true;
+        case StrHash("tune.pname"):
+            if (std::strcmp(name, "tune.pname") != 0) break;
+            this->SetTunePname(StrToPitchname(attr.value()));
+            return true;
+        case StrHash("tune.temper"):
+            if (std::strcmp(name, "tune.temper") != 0) break;
+            this->SetTuneTemper(StrToTemperament(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTuning::WriteTuning(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6759,14 +8462,28 @@ void AttTupletPresent::ResetTupletPresent()
 bool AttTupletPresent::ReadTupletPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tuplet")) {
-        this->SetTuplet(StrToStr(element.attribute("tuplet").value()));
-        if (removeAttr) element.remove_attribute("tuplet");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTupletPresent::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("tuplet"):
+            if (std::strcmp(name, "tuplet") != 0) break;
+            this->SetTuplet(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTupletPresent::WriteTupletPresent(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6799,14 +8516,28 @@ void AttTyped::ResetTyped()
 bool AttTyped::ReadTyped(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("type")) {
-        this->SetType(StrToStr(element.attribute("type").value()));
-        if (removeAttr) element.remove_attribute("type");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTyped::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("type"):
+            if (std::strcmp(name, "type") != 0) break;
+            this->SetType(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTyped::WriteTyped(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -6845,42 +8576,50 @@ void AttTypography::ResetTypography()
 bool AttTypography::ReadTypography(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("fontfam")) {
-        this->SetFontfam(StrToStr(element.attribute("fontfam").value()));
-        if (removeAttr) element.remove_attribute("fontfam");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontname")) {
-        this->SetFontname(StrToStr(element.attribute("fontname").value()));
-        if (removeAttr) element.remove_attribute("fontname");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontsize")) {
-        this->SetFontsize(StrToFontsize(element.attribute("fontsize").value()));
-        if (removeAttr) element.remove_attribute("fontsize");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontstyle")) {
-        this->SetFontstyle(StrToFontstyle(element.attribute("fontstyle").value()));
-        if (removeAttr) element.remove_attribute("fontstyle");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontweight")) {
-        this->SetFontweight(StrToFontweight(element.attribute("fontweight").value()));
-        if (removeAttr) element.remove_attribute("fontweight");
-        hasAttribute = true;
-    }
-    if (element.attribute("letterspacing")) {
-        this->SetLetterspacing(StrToDbl(element.attribute("letterspacing").value()));
-        if (removeAttr) element.remove_attribute("letterspacing");
-        hasAttribute = true;
-    }
-    if (element.attribute("lineheight")) {
-        this->SetLineheight(StrToStr(element.attribute("lineheight").value()));
-        if (removeAttr) element.remove_attribute("lineheight");
-        hasAttribute = true;
-    }
-    return hasAttribute;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
+        hasAttribute = true;
+    }
+    return hasAttribute;
+}
+
+bool AttTypography::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("fontfam"):
+            if (std::strcmp(name, "fontfam") != 0) break;
+            this->SetFontfam(StrToStr(attr.value()));
+            return true;
+        case StrHash("fontname"):
+            if (std::strcmp(name, "fontname") != 0) break;
+            this->SetFontname(StrToStr(attr.value()));
+            return true;
+        case StrHash("fontsize"):
+            if (std::strcmp(name, "fontsize") != 0) break;
+            this->SetFontsize(StrToFontsize(attr.value()));
+            return true;
+        case StrHash("fontstyle"):
+            if (std::strcmp(name, "fontstyle") != 0) break;
+            this->SetFontstyle(StrToFontstyle(attr.value()));
+            return true;
+        case StrHash("fontweight"):
+            if (std::strcmp(name, "fontweight") != 0) break;
+            this->SetFontweight(StrToFontweight(attr.value()));
+            return true;
+        case StrHash("letterspacing"):
+            if (std::strcmp(name, "letterspacing") != 0) break;
+            this->SetLetterspacing(StrToDbl(attr.value()));
+            return true;
+        case StrHash("lineheight"):
+            if (std::strcmp(name, "lineheight") != 0) break;
+            this->SetLineheight(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
 }
 
 bool AttTypography::WriteTypography(pugi::xml_node element)
@@ -6969,14 +8708,28 @@ void AttVerticalAlign::ResetVerticalAlign()
 bool AttVerticalAlign::ReadVerticalAlign(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("valign")) {
-        this->SetValign(StrToVerticalalignment(element.attribute("valign").value()));
-        if (removeAttr) element.remove_attribute("valign");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttVerticalAlign::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("valign"):
+            if (std::strcmp(name, "valign") != 0) break;
+            this->SetValign(StrToVerticalalignment(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttVerticalAlign::WriteVerticalAlign(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7009,14 +8762,28 @@ void AttVerticalGroup::ResetVerticalGroup()
 bool AttVerticalGroup::ReadVerticalGroup(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vgrp")) {
-        this->SetVgrp(StrToInt(element.attribute("vgrp").value()));
-        if (removeAttr) element.remove_attribute("vgrp");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttVerticalGroup::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("vgrp"):
+            if (std::strcmp(name, "vgrp") != 0) break;
+            this->SetVgrp(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttVerticalGroup::WriteVerticalGroup(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7049,14 +8816,28 @@ void AttVisibility::ResetVisibility()
 bool AttVisibility::ReadVisibility(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("visible")) {
-        this->SetVisible(StrToBoolean(element.attribute("visible").value()));
-        if (removeAttr) element.remove_attribute("visible");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttVisibility::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("visible"):
+            if (std::strcmp(name, "visible") != 0) break;
+            this->SetVisible(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttVisibility::WriteVisibility(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7089,14 +8870,28 @@ void AttVisualOffsetHo::ResetVisualOffsetHo()
 bool AttVisualOffsetHo::ReadVisualOffsetHo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ho")) {
-        this->SetHo(StrToMeasurementsigned(element.attribute("ho").value()));
-        if (removeAttr) element.remove_attribute("ho");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttVisualOffsetHo::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("ho"):
+            if (std::strcmp(name, "ho") != 0) break;
+            this->SetHo(StrToMeasurementsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttVisualOffsetHo::WriteVisualOffsetHo(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7129,14 +8924,28 @@ void AttVisualOffsetTo::ResetVisualOffsetTo()
 bool AttVisualOffsetTo::ReadVisualOffsetTo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("to")) {
-        this->SetTo(StrToDbl(element.attribute("to").value()));
-        if (removeAttr) element.remove_attribute("to");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttVisualOffsetTo::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("to"):
+            if (std::strcmp(name, "to") != 0) break;
+            this->SetTo(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttVisualOffsetTo::WriteVisualOffsetTo(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7169,14 +8978,28 @@ void AttVisualOffsetVo::ResetVisualOffsetVo()
 bool AttVisualOffsetVo::ReadVisualOffsetVo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vo")) {
-        this->SetVo(StrToMeasurementsigned(element.attribute("vo").value()));
-        if (removeAttr) element.remove_attribute("vo");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttVisualOffsetVo::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("vo"):
+            if (std::strcmp(name, "vo") != 0) break;
+            this->SetVo(StrToMeasurementsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttVisualOffsetVo::WriteVisualOffsetVo(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7210,19 +9033,32 @@ void AttVisualOffset2Ho::ResetVisualOffset2Ho()
 bool AttVisualOffset2Ho::ReadVisualOffset2Ho(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startho")) {
-        this->SetStartho(StrToMeasurementsigned(element.attribute("startho").value()));
-        if (removeAttr) element.remove_attribute("startho");
-        hasAttribute = true;
-    }
-    if (element.attribute("endho")) {
-        this->SetEndho(StrToMeasurementsigned(element.attribute("endho").value()));
-        if (removeAttr) element.remove_attribute("endho");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttVisualOffset2Ho::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("startho"):
+            if (std::strcmp(name, "startho") != 0) break;
+            this->SetStartho(StrToMeasurementsigned(attr.value()));
+            return true;
+        case StrHash("endho"):
+            if (std::strcmp(name, "endho") != 0) break;
+            this->SetEndho(StrToMeasurementsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttVisualOffset2Ho::WriteVisualOffset2Ho(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7265,19 +9101,32 @@ void AttVisualOffset2To::ResetVisualOffset2To()
 bool AttVisualOffset2To::ReadVisualOffset2To(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startto")) {
-        this->SetStartto(StrToDbl(element.attribute("startto").value()));
-        if (removeAttr) element.remove_attribute("startto");
-        hasAttribute = true;
-    }
-    if (element.attribute("endto")) {
-        this->SetEndto(StrToDbl(element.attribute("endto").value()));
-        if (removeAttr) element.remove_attribute("endto");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttVisualOffset2To::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("startto"):
+            if (std::strcmp(name, "startto") != 0) break;
+            this->SetStartto(StrToDbl(attr.value()));
+            return true;
+        case StrHash("endto"):
+            if (std::strcmp(name, "endto") != 0) break;
+            this->SetEndto(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttVisualOffset2To::WriteVisualOffset2To(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7320,19 +9169,32 @@ void AttVisualOffset2Vo::ResetVisualOffset2Vo()
 bool AttVisualOffset2Vo::ReadVisualOffset2Vo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startvo")) {
-        this->SetStartvo(StrToMeasurementsigned(element.attribute("startvo").value()));
-        if (removeAttr) element.remove_attribute("startvo");
-        hasAttribute = true;
-    }
-    if (element.attribute("endvo")) {
-        this->SetEndvo(StrToMeasurementsigned(element.attribute("endvo").value()));
-        if (removeAttr) element.remove_attribute("endvo");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttVisualOffset2Vo::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("startvo"):
+            if (std::strcmp(name, "startvo") != 0) break;
+            this->SetStartvo(StrToMeasurementsigned(attr.value()));
+            return true;
+        case StrHash("endvo"):
+            if (std::strcmp(name, "endvo") != 0) break;
+            this->SetEndvo(StrToMeasurementsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttVisualOffset2Vo::WriteVisualOffset2Vo(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7374,14 +9236,28 @@ void AttVoltaGroupingSym::ResetVoltaGroupingSym()
 bool AttVoltaGroupingSym::ReadVoltaGroupingSym(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("voltasym")) {
-        this->SetVoltasym(StrToVoltaGroupingSymVoltasym(element.attribute("voltasym").value()));
-        if (removeAttr) element.remove_attribute("voltasym");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttVoltaGroupingSym::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("voltasym"):
+            if (std::strcmp(name, "voltasym") != 0) break;
+            this->SetVoltasym(StrToVoltaGroupingSymVoltasym(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttVoltaGroupingSym::WriteVoltaGroupingSym(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7414,14 +9290,28 @@ void AttWhitespace::ResetWhitespace()
 bool AttWhitespace::ReadWhitespace(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:space")) {
-        this->SetSpace(StrToStr(element.attribute("xml:space").value()));
-        if (removeAttr) element.remove_attribute("xml:space");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttWhitespace::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("xml:space"):
+            if (std::strcmp(name, "xml:space") != 0) break;
+            this->SetSpace(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttWhitespace::WriteWhitespace(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7454,14 +9344,28 @@ void AttWidth::ResetWidth()
 bool AttWidth::ReadWidth(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("width")) {
-        this->SetWidth(StrToMeasurementunsigned(element.attribute("width").value()));
-        if (removeAttr) element.remove_attribute("width");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttWidth::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("width"):
+            if (std::strcmp(name, "width") != 0) break;
+            this->SetWidth(StrToMeasurementunsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttWidth::WriteWidth(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7495,19 +9399,32 @@ void AttXy::ResetXy()
 bool AttXy::ReadXy(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("x")) {
-        this->SetX(StrToDbl(element.attribute("x").value()));
-        if (removeAttr) element.remove_attribute("x");
-        hasAttribute = true;
-    }
-    if (element.attribute("y")) {
-        this->SetY(StrToDbl(element.attribute("y").value()));
-        if (removeAttr) element.remove_attribute("y");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttXy::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("x"):
+            if (std::strcmp(name, "x") != 0) break;
+            this->SetX(StrToDbl(attr.value()));
+            return true;
+        case StrHash("y"):
+            if (std::strcmp(name, "y") != 0) break;
+            this->SetY(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttXy::WriteXy(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -7550,19 +9467,32 @@ void AttXy2::ResetXy2()
 bool AttXy2::ReadXy2(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("x2")) {
-        this->SetX2(StrToDbl(element.attribute("x2").value()));
-        if (removeAttr) element.remove_attribute("x2");
-        hasAttribute = true;
-    }
-    if (element.attribute("y2")) {
-        this->SetY2(StrToDbl(element.attribute("y2").value()));
-        if (removeAttr) element.remove_attribute("y2");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttXy2::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("x2"):
+            if (std::strcmp(name, "x2") != 0) break;
+            this->SetX2(StrToDbl(attr.value()));
+            return true;
+        case StrHash("y2"):
+            if (std::strcmp(name, "y2") != 0) break;
+            this->SetY2(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttXy2::WriteXy2(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAccidLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAccidLog(pugi::xml_node element);
 
@@ -90,6 +93,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAccidental(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAccidental(pugi::xml_node element);
 
@@ -139,6 +145,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadArticulation(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteArticulation(pugi::xml_node element);
 
@@ -194,6 +203,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAttaccaLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAttaccaLog(pugi::xml_node element);
 
@@ -243,6 +255,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAudience(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAudience(pugi::xml_node element);
 
@@ -292,6 +307,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAugmentDots(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAugmentDots(pugi::xml_node element);
 
@@ -341,6 +359,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAuthorized(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAuthorized(pugi::xml_node element);
 
@@ -404,6 +425,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBarLineLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBarLineLog(pugi::xml_node element);
 
@@ -453,6 +477,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBarring(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBarring(pugi::xml_node element);
 
@@ -521,6 +548,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBasic(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBasic(pugi::xml_node element);
 
@@ -570,6 +600,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBibl(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBibl(pugi::xml_node element);
 
@@ -622,6 +655,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCalendared(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCalendared(pugi::xml_node element);
 
@@ -674,6 +710,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCanonical(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCanonical(pugi::xml_node element);
 
@@ -727,6 +766,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadClassed(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteClassed(pugi::xml_node element);
 
@@ -779,6 +821,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadClefLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteClefLog(pugi::xml_node element);
 
@@ -831,6 +876,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadClefShape(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteClefShape(pugi::xml_node element);
 
@@ -880,6 +928,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCleffingLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCleffingLog(pugi::xml_node element);
 
@@ -951,6 +1002,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadColor(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteColor(pugi::xml_node element);
 
@@ -1003,6 +1057,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadColoration(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteColoration(pugi::xml_node element);
 
@@ -1059,6 +1116,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCoordX1(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCoordX1(pugi::xml_node element);
 
@@ -1108,6 +1168,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCoordX2(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCoordX2(pugi::xml_node element);
 
@@ -1157,6 +1220,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCoordY1(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCoordY1(pugi::xml_node element);
 
@@ -1206,6 +1272,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCoordinated(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCoordinated(pugi::xml_node element);
 
@@ -1272,6 +1341,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCoordinatedUl(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCoordinatedUl(pugi::xml_node element);
 
@@ -1327,6 +1399,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCue(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCue(pugi::xml_node element);
 
@@ -1376,6 +1451,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCurvature(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCurvature(pugi::xml_node element);
 
@@ -1449,6 +1527,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCustosLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCustosLog(pugi::xml_node element);
 
@@ -1498,6 +1579,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadDataPointing(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteDataPointing(pugi::xml_node element);
 
@@ -1547,6 +1631,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadDatable(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteDatable(pugi::xml_node element);
 
@@ -1620,6 +1707,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadDistances(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteDistances(pugi::xml_node element);
 
@@ -1696,6 +1786,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadDotLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteDotLog(pugi::xml_node element);
 
@@ -1745,6 +1838,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadDurationAdditive(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteDurationAdditive(pugi::xml_node element);
 
@@ -1797,6 +1893,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadDurationDefault(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteDurationDefault(pugi::xml_node element);
 
@@ -1868,6 +1967,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadDurationLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteDurationLog(pugi::xml_node element);
 
@@ -1920,6 +2022,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadDurationRatio(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteDurationRatio(pugi::xml_node element);
 
@@ -1978,6 +2083,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadEnclosingChars(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteEnclosingChars(pugi::xml_node element);
 
@@ -2032,6 +2140,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadEndings(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteEndings(pugi::xml_node element);
 
@@ -2081,6 +2192,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadEvidence(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteEvidence(pugi::xml_node element);
 
@@ -2139,6 +2253,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadExtender(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteExtender(pugi::xml_node element);
 
@@ -2188,6 +2305,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadExtent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteExtent(pugi::xml_node element);
 
@@ -2241,6 +2361,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadFermataPresent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteFermataPresent(pugi::xml_node element);
 
@@ -2294,6 +2417,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadFiling(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteFiling(pugi::xml_node element);
 
@@ -2346,6 +2472,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadFormework(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteFormework(pugi::xml_node element);
 
@@ -2395,6 +2524,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadGrpSymLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteGrpSymLog(pugi::xml_node element);
 
@@ -2444,6 +2576,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadHandIdent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteHandIdent(pugi::xml_node element);
 
@@ -2496,6 +2631,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadHeight(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteHeight(pugi::xml_node element);
 
@@ -2545,6 +2683,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadHorizontalAlign(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteHorizontalAlign(pugi::xml_node element);
 
@@ -2594,6 +2735,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadInternetMedia(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteInternetMedia(pugi::xml_node element);
 
@@ -2647,6 +2791,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadJoined(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteJoined(pugi::xml_node element);
 
@@ -2703,6 +2850,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadKeyMode(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteKeyMode(pugi::xml_node element);
 
@@ -2752,6 +2902,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadKeySigLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteKeySigLog(pugi::xml_node element);
 
@@ -2801,6 +2954,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadKeySigDefaultLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteKeySigDefaultLog(pugi::xml_node element);
 
@@ -2850,6 +3006,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLabelled(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLabelled(pugi::xml_node element);
 
@@ -2903,6 +3062,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLang(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLang(pugi::xml_node element);
 
@@ -2958,6 +3120,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLayerLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLayerLog(pugi::xml_node element);
 
@@ -3007,6 +3172,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLayerIdent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLayerIdent(pugi::xml_node element);
 
@@ -3056,6 +3224,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLineLoc(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLineLoc(pugi::xml_node element);
 
@@ -3109,6 +3280,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLineRend(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLineRend(pugi::xml_node element);
 
@@ -3176,6 +3350,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLineRendBase(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLineRendBase(pugi::xml_node element);
 
@@ -3245,6 +3422,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLinking(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLinking(pugi::xml_node element);
 
@@ -3348,6 +3528,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLyricStyle(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLyricStyle(pugi::xml_node element);
 
@@ -3429,6 +3612,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMeasureNumbers(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMeasureNumbers(pugi::xml_node element);
 
@@ -3478,6 +3664,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMeasurement(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMeasurement(pugi::xml_node element);
 
@@ -3527,6 +3716,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMediaBounds(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMediaBounds(pugi::xml_node element);
 
@@ -3601,6 +3793,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMedium(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMedium(pugi::xml_node element);
 
@@ -3650,6 +3845,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMeiVersion(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMeiVersion(pugi::xml_node element);
 
@@ -3699,6 +3897,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMensurLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMensurLog(pugi::xml_node element);
 
@@ -3748,6 +3949,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMetadataPointing(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMetadataPointing(pugi::xml_node element);
 
@@ -3801,6 +4005,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMeterConformance(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMeterConformance(pugi::xml_node element);
 
@@ -3853,6 +4060,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMeterConformanceBar(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMeterConformanceBar(pugi::xml_node element);
 
@@ -3917,6 +4127,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMeterSigLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMeterSigLog(pugi::xml_node element);
 
@@ -3981,6 +4194,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMeterSigDefaultLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMeterSigDefaultLog(pugi::xml_node element);
 
@@ -4053,6 +4269,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMmTempo(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMmTempo(pugi::xml_node element);
 
@@ -4120,6 +4339,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMultinumMeasures(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMultinumMeasures(pugi::xml_node element);
 
@@ -4172,6 +4394,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadNInteger(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteNInteger(pugi::xml_node element);
 
@@ -4225,6 +4450,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadNNumberLike(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteNNumberLike(pugi::xml_node element);
 
@@ -4278,6 +4506,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadName(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteName(pugi::xml_node element);
 
@@ -4339,6 +4570,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadNotationStyle(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteNotationStyle(pugi::xml_node element);
 
@@ -4396,6 +4630,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadNoteHeads(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteNoteHeads(pugi::xml_node element);
 
@@ -4507,6 +4744,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOctave(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOctave(pugi::xml_node element);
 
@@ -4556,6 +4796,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOctaveDefault(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOctaveDefault(pugi::xml_node element);
 
@@ -4609,6 +4852,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOctaveDisplacement(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOctaveDisplacement(pugi::xml_node element);
 
@@ -4664,6 +4910,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOneLineStaff(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOneLineStaff(pugi::xml_node element);
 
@@ -4717,6 +4966,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOptimization(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOptimization(pugi::xml_node element);
 
@@ -4769,6 +5021,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOriginLayerIdent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOriginLayerIdent(pugi::xml_node element);
 
@@ -4818,6 +5073,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOriginStaffIdent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOriginStaffIdent(pugi::xml_node element);
 
@@ -4870,6 +5128,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOriginStartEndId(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOriginStartEndId(pugi::xml_node element);
 
@@ -4925,6 +5186,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadOriginTimestampLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteOriginTimestampLog(pugi::xml_node element);
 
@@ -4987,6 +5251,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPages(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePages(pugi::xml_node element);
 
@@ -5084,6 +5351,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPartIdent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePartIdent(pugi::xml_node element);
 
@@ -5145,6 +5415,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPitch(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePitch(pugi::xml_node element);
 
@@ -5194,6 +5467,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPlacementOnStaff(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePlacementOnStaff(pugi::xml_node element);
 
@@ -5246,6 +5522,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPlacementRelEvent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePlacementRelEvent(pugi::xml_node element);
 
@@ -5295,6 +5574,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPlacementRelStaff(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePlacementRelStaff(pugi::xml_node element);
 
@@ -5344,6 +5626,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPlist(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePlist(pugi::xml_node element);
 
@@ -5399,6 +5684,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPointing(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePointing(pugi::xml_node element);
 
@@ -5478,6 +5766,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadQuantity(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteQuantity(pugi::xml_node element);
 
@@ -5530,6 +5821,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadRanging(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteRanging(pugi::xml_node element);
 
@@ -5613,6 +5907,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadRepeatMarkLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteRepeatMarkLog(pugi::xml_node element);
 
@@ -5662,6 +5959,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadResponsibility(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteResponsibility(pugi::xml_node element);
 
@@ -5715,6 +6015,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadRestdurationLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteRestdurationLog(pugi::xml_node element);
 
@@ -5767,6 +6070,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadScalable(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteScalable(pugi::xml_node element);
 
@@ -5816,6 +6122,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSequence(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSequence(pugi::xml_node element);
 
@@ -5868,6 +6177,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSlashCount(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSlashCount(pugi::xml_node element);
 
@@ -5917,6 +6229,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSlurPresent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSlurPresent(pugi::xml_node element);
 
@@ -5970,6 +6285,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSource(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSource(pugi::xml_node element);
 
@@ -6024,6 +6342,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSpacing(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSpacing(pugi::xml_node element);
 
@@ -6100,6 +6421,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStaffLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStaffLog(pugi::xml_node element);
 
@@ -6149,6 +6473,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStaffDefLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStaffDefLog(pugi::xml_node element);
 
@@ -6198,6 +6525,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStaffGroupingSym(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStaffGroupingSym(pugi::xml_node element);
 
@@ -6247,6 +6577,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStaffIdent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStaffIdent(pugi::xml_node element);
 
@@ -6300,6 +6633,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStaffItems(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStaffItems(pugi::xml_node element);
 
@@ -6367,6 +6703,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStaffLoc(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStaffLoc(pugi::xml_node element);
 
@@ -6416,6 +6755,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStaffLocPitched(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStaffLocPitched(pugi::xml_node element);
 
@@ -6471,6 +6813,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStartEndId(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStartEndId(pugi::xml_node element);
 
@@ -6523,6 +6868,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStartId(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStartId(pugi::xml_node element);
 
@@ -6575,6 +6923,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStems(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStems(pugi::xml_node element);
 
@@ -6673,6 +7024,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSylLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSylLog(pugi::xml_node element);
 
@@ -6731,6 +7085,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSylText(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSylText(pugi::xml_node element);
 
@@ -6780,6 +7137,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSystems(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSystems(pugi::xml_node element);
 
@@ -6860,6 +7220,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTargetEval(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTargetEval(pugi::xml_node element);
 
@@ -6912,6 +7275,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTempoLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTempoLog(pugi::xml_node element);
 
@@ -6961,6 +7327,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTextRendition(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTextRendition(pugi::xml_node element);
 
@@ -7016,6 +7385,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTextStyle(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTextStyle(pugi::xml_node element);
 
@@ -7106,6 +7478,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTiePresent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTiePresent(pugi::xml_node element);
 
@@ -7159,6 +7534,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTimestampLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTimestampLog(pugi::xml_node element);
 
@@ -7211,6 +7589,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTimestamp2Log(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTimestamp2Log(pugi::xml_node element);
 
@@ -7263,6 +7644,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTransposition(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTransposition(pugi::xml_node element);
 
@@ -7324,6 +7708,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTuning(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTuning(pugi::xml_node element);
 
@@ -7388,6 +7775,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTupletPresent(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTupletPresent(pugi::xml_node element);
 
@@ -7441,6 +7831,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTyped(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTyped(pugi::xml_node element);
 
@@ -7493,6 +7886,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTypography(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTypography(pugi::xml_node element);
 
@@ -7587,6 +7983,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadVerticalAlign(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteVerticalAlign(pugi::xml_node element);
 
@@ -7636,6 +8035,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadVerticalGroup(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteVerticalGroup(pugi::xml_node element);
 
@@ -7685,6 +8087,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadVisibility(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteVisibility(pugi::xml_node element);
 
@@ -7737,6 +8142,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadVisualOffsetHo(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteVisualOffsetHo(pugi::xml_node element);
 
@@ -7790,6 +8198,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadVisualOffsetTo(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteVisualOffsetTo(pugi::xml_node element);
 
@@ -7842,6 +8253,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadVisualOffsetVo(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteVisualOffsetVo(pugi::xml_node element);
 
@@ -7895,6 +8309,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadVisualOffset2Ho(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteVisualOffset2Ho(pugi::xml_node element);
 
@@ -7956,6 +8373,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadVisualOffset2To(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteVisualOffset2To(pugi::xml_node element);
 
@@ -8017,6 +8437,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadVisualOffset2Vo(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteVisualOffset2Vo(pugi::xml_node element);
 
@@ -8078,6 +8501,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadVoltaGroupingSym(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteVoltaGroupingSym(pugi::xml_node element);
 
@@ -8127,6 +8553,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadWhitespace(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteWhitespace(pugi::xml_node element);
 
@@ -8176,6 +8605,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadWidth(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteWidth(pugi::xml_node element);
 
@@ -8225,6 +8657,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadXy(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteXy(pugi::xml_node element);
 
@@ -8288,6 +8723,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadXy2(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteXy2(pugi::xml_node element);
 
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttAltSym::ResetAltSym()
 bool AttAltSym::ReadAltSym(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("altsym")) {
-        this->SetAltsym(StrToStr(element.attribute("altsym").value()));
-        if (removeAttr) element.remove_attribute("altsym");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAltSym::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("altsym"):
+            if (std::strcmp(name, "altsym") != 0) break;
+            this->SetAltsym(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAltSym::WriteAltSym(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -79,14 +94,28 @@ void AttAnchoredTextLog::ResetAnchoredTextLog()
 bool AttAnchoredTextLog::ReadAnchoredTextLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAnchoredTextLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("func"):
+            if (std::strcmp(name, "func") != 0) break;
+            this->SetFunc(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAnchoredTextLog::WriteAnchoredTextLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -119,14 +148,28 @@ void AttCurveLog::ResetCurveLog()
 bool AttCurveLog::ReadCurveLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCurveLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("func"):
+            if (std::strcmp(name, "func") != 0) break;
+            this->SetFunc(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCurveLog::WriteCurveLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -159,14 +202,28 @@ void AttLineLog::ResetLineLog()
 bool AttLineLog::ReadLineLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLineLog::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("func"):
+            if (std::strcmp(name, "func") != 0) break;
+            this->SetFunc(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLineLog::WriteLineLog(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAltSym(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAltSym(pugi::xml_node element);
 
@@ -94,6 +97,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAnchoredTextLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAnchoredTextLog(pugi::xml_node element);
 
@@ -143,6 +149,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCurveLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCurveLog(pugi::xml_node element);
 
@@ -192,6 +201,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLineLog(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLineLog(pugi::xml_node element);
 
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,14 +40,28 @@ void AttAnnotVis::ResetAnnotVis()
 bool AttAnnotVis::ReadAnnotVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToPlacement(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttAnnotVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("place"):
+            if (std::strcmp(name, "place") != 0) break;
+            this->SetPlace(StrToPlacement(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttAnnotVis::WriteAnnotVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -83,34 +98,44 @@ void AttArpegVis::ResetArpegVis()
 bool AttArpegVis::ReadArpegVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("arrow")) {
-        this->SetArrow(StrToBoolean(element.attribute("arrow").value()));
-        if (removeAttr) element.remove_attribute("arrow");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.shape")) {
-        this->SetArrowShape(StrToLinestartendsymbol(element.attribute("arrow.shape").value()));
-        if (removeAttr) element.remove_attribute("arrow.shape");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.size")) {
-        this->SetArrowSize(StrToInt(element.attribute("arrow.size").value()));
-        if (removeAttr) element.remove_attribute("arrow.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.color")) {
-        this->SetArrowColor(StrToStr(element.attribute("arrow.color").value()));
-        if (removeAttr) element.remove_attribute("arrow.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.fillcolor")) {
-        this->SetArrowFillcolor(StrToStr(element.attribute("arrow.fillcolor").value()));
-        if (removeAttr) element.remove_attribute("arrow.fillcolor");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttArpegVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("arrow"):
+            if (std::strcmp(name, "arrow") != 0) break;
+            this->SetArrow(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("arrow.shape"):
+            if (std::strcmp(name, "arrow.shape") != 0) break;
+            this->SetArrowShape(StrToLinestartendsymbol(attr.value()));
+            return true;
+        case StrHash("arrow.size"):
+            if (std::strcmp(name, "arrow.size") != 0) break;
+            this->SetArrowSize(StrToInt(attr.value()));
+            return true;
+        case StrHash("arrow.color"):
+            if (std::strcmp(name, "arrow.color") != 0) break;
+            this->SetArrowColor(StrToStr(attr.value()));
+            return true;
+        case StrHash("arrow.fillcolor"):
+            if (std::strcmp(name, "arrow.fillcolor") != 0) break;
+            this->SetArrowFillcolor(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttArpegVis::WriteArpegVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -181,24 +206,36 @@ void AttBarLineVis::ResetBarLineVis()
 bool AttBarLineVis::ReadBarLineVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("len")) {
-        this->SetLen(StrToDbl(element.attribute("len").value()));
-        if (removeAttr) element.remove_attribute("len");
-        hasAttribute = true;
-    }
-    if (element.attribute("method")) {
-        this->SetMethod(StrToBarmethod(element.attribute("method").value()));
-        if (removeAttr) element.remove_attribute("method");
-        hasAttribute = true;
-    }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToInt(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBarLineVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("len"):
+            if (std::strcmp(name, "len") != 0) break;
+            this->SetLen(StrToDbl(attr.value()));
+            return true;
+        case StrHash("method"):
+            if (std::strcmp(name, "method") != 0) break;
+            this->SetMethod(StrToBarmethod(attr.value()));
+            return true;
+        case StrHash("place"):
+            if (std::strcmp(name, "place") != 0) break;
+            this->SetPlace(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBarLineVis::WriteBarLineVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -251,24 +288,36 @@ void AttBeamingVis::ResetBeamingVis()
 bool AttBeamingVis::ReadBeamingVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.color")) {
-        this->SetBeamColor(StrToStr(element.attribute("beam.color").value()));
-        if (removeAttr) element.remove_attribute("beam.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("beam.rend")) {
-        this->SetBeamRend(StrToBeamingVisBeamrend(element.attribute("beam.rend").value()));
-        if (removeAttr) element.remove_attribute("beam.rend");
-        hasAttribute = true;
-    }
-    if (element.attribute("beam.slope")) {
-        this->SetBeamSlope(StrToDbl(element.attribute("beam.slope").value()));
-        if (removeAttr) element.remove_attribute("beam.slope");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBeamingVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("beam.color"):
+            if (std::strcmp(name, "beam.color") != 0) break;
+            this->SetBeamColor(StrToStr(attr.value()));
+            return true;
+        case StrHash("beam.rend"):
+            if (std::strcmp(name, "beam.rend") != 0) break;
+            this->SetBeamRend(StrToBeamingVisBeamrend(attr.value()));
+            return true;
+        case StrHash("beam.slope"):
+            if (std::strcmp(name, "beam.slope") != 0) break;
+            this->SetBeamSlope(StrToDbl(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBeamingVis::WriteBeamingVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -319,14 +368,28 @@ void AttBeatRptVis::ResetBeatRptVis()
 bool AttBeatRptVis::ReadBeatRptVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToBeatrptRend(element.attribute("slash").value()));
-        if (removeAttr) element.remove_attribute("slash");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttBeatRptVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("slash"):
+            if (std::strcmp(name, "slash") != 0) break;
+            this->SetSlash(StrToBeatrptRend(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttBeatRptVis::WriteBeatRptVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -359,14 +422,28 @@ void AttChordVis::ResetChordVis()
 bool AttChordVis::ReadChordVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cluster")) {
-        this->SetCluster(StrToCluster(element.attribute("cluster").value()));
-        if (removeAttr) element.remove_attribute("cluster");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttChordVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("cluster"):
+            if (std::strcmp(name, "cluster") != 0) break;
+            this->SetCluster(StrToCluster(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttChordVis::WriteChordVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -400,19 +477,32 @@ void AttCleffingVis::ResetCleffingVis()
 bool AttCleffingVis::ReadCleffingVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.color")) {
-        this->SetClefColor(StrToStr(element.attribute("clef.color").value()));
-        if (removeAttr) element.remove_attribute("clef.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.visible")) {
-        this->SetClefVisible(StrToBoolean(element.attribute("clef.visible").value()));
-        if (removeAttr) element.remove_attribute("clef.visible");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCleffingVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("clef.color"):
+            if (std::strcmp(name, "clef.color") != 0) break;
+            this->SetClefColor(StrToStr(attr.value()));
+            return true;
+        case StrHash("clef.visible"):
+            if (std::strcmp(name, "clef.visible") != 0) break;
+            this->SetClefVisible(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCleffingVis::WriteCleffingVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -454,14 +544,28 @@ void AttCurvatureDirection::ResetCurvatureDirection()
 bool AttCurvatureDirection::ReadCurvatureDirection(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("curve")) {
-        this->SetCurve(StrToCurvatureDirectionCurve(element.attribute("curve").value()));
-        if (removeAttr) element.remove_attribute("curve");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttCurvatureDirection::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("curve"):
+            if (std::strcmp(name, "curve") != 0) break;
+            this->SetCurve(StrToCurvatureDirectionCurve(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttCurvatureDirection::WriteCurvatureDirection(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -495,19 +599,32 @@ void AttEpisemaVis::ResetEpisemaVis()
 bool AttEpisemaVis::ReadEpisemaVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToEpisemaVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttEpisemaVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToEpisemaVisForm(attr.value()));
+            return true;
+        case StrHash("place"):
+            if (std::strcmp(name, "place") != 0) break;
+            this->SetPlace(StrToEventrel(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttEpisemaVis::WriteEpisemaVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -551,24 +668,36 @@ void AttFTremVis::ResetFTremVis()
 bool AttFTremVis::ReadFTremVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beams")) {
-        this->SetBeams(StrToInt(element.attribute("beams").value()));
-        if (removeAttr) element.remove_attribute("beams");
-        hasAttribute = true;
-    }
-    if (element.attribute("beams.float")) {
-        this->SetBeamsFloat(StrToInt(element.attribute("beams.float").value()));
-        if (removeAttr) element.remove_attribute("beams.float");
-        hasAttribute = true;
-    }
-    if (element.attribute("float.gap")) {
-        this->SetFloatGap(StrToMeasurementunsigned(element.attribute("float.gap").value()));
-        if (removeAttr) element.remove_attribute("float.gap");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttFTremVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("beams"):
+            if (std::strcmp(name, "beams") != 0) break;
+            this->SetBeams(StrToInt(attr.value()));
+            return true;
+        case StrHash("beams.float"):
+            if (std::strcmp(name, "beams.float") != 0) break;
+            this->SetBeamsFloat(StrToInt(attr.value()));
+            return true;
+        case StrHash("float.gap"):
+            if (std::strcmp(name, "float.gap") != 0) break;
+            this->SetFloatGap(StrToMeasurementunsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttFTremVis::WriteFTremVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -620,19 +749,32 @@ void AttFermataVis::ResetFermataVis()
 bool AttFermataVis::ReadFermataVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFermataVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("shape")) {
-        this->SetShape(StrToFermataVisShape(element.attribute("shape").value()));
-        if (removeAttr) element.remove_attribute("shape");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttFermataVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToFermataVisForm(attr.value()));
+            return true;
+        case StrHash("shape"):
+            if (std::strcmp(name, "shape") != 0) break;
+            this->SetShape(StrToFermataVisShape(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttFermataVis::WriteFermataVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -674,14 +816,28 @@ void AttFingGrpVis::ResetFingGrpVis()
 bool AttFingGrpVis::ReadFingGrpVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToFingGrpVisOrient(element.attribute("orient").value()));
-        if (removeAttr) element.remove_attribute("orient");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttFingGrpVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("orient"):
+            if (std::strcmp(name, "orient") != 0) break;
+            this->SetOrient(StrToFingGrpVisOrient(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttFingGrpVis::WriteFingGrpVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -714,14 +870,28 @@ void AttGuitarGridVis::ResetGuitarGridVis()
 bool AttGuitarGridVis::ReadGuitarGridVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        if (removeAttr) element.remove_attribute("grid.show");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttGuitarGridVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("grid.show"):
+            if (std::strcmp(name, "grid.show") != 0) break;
+            this->SetGridShow(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttGuitarGridVis::WriteGuitarGridVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -757,29 +927,40 @@ void AttHairpinVis::ResetHairpinVis()
 bool AttHairpinVis::ReadHairpinVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("opening")) {
-        this->SetOpening(StrToMeasurementunsigned(element.attribute("opening").value()));
-        if (removeAttr) element.remove_attribute("opening");
-        hasAttribute = true;
-    }
-    if (element.attribute("closed")) {
-        this->SetClosed(StrToBoolean(element.attribute("closed").value()));
-        if (removeAttr) element.remove_attribute("closed");
-        hasAttribute = true;
-    }
-    if (element.attribute("opening.vertical")) {
-        this->SetOpeningVertical(StrToBoolean(element.attribute("opening.vertical").value()));
-        if (removeAttr) element.remove_attribute("opening.vertical");
-        hasAttribute = true;
-    }
-    if (element.attribute("angle.optimize")) {
-        this->SetAngleOptimize(StrToBoolean(element.attribute("angle.optimize").value()));
-        if (removeAttr) element.remove_attribute("angle.optimize");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttHairpinVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("opening"):
+            if (std::strcmp(name, "opening") != 0) break;
+            this->SetOpening(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("closed"):
+            if (std::strcmp(name, "closed") != 0) break;
+            this->SetClosed(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("opening.vertical"):
+            if (std::strcmp(name, "opening.vertical") != 0) break;
+            this->SetOpeningVertical(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("angle.optimize"):
+            if (std::strcmp(name, "angle.optimize") != 0) break;
+            this->SetAngleOptimize(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttHairpinVis::WriteHairpinVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -839,14 +1020,28 @@ void AttHarmVis::ResetHarmVis()
 bool AttHarmVis::ReadHarmVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("rendgrid")) {
-        this->SetRendgrid(StrToHarmVisRendgrid(element.attribute("rendgrid").value()));
-        if (removeAttr) element.remove_attribute("rendgrid");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttHarmVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("rendgrid"):
+            if (std::strcmp(name, "rendgrid") != 0) break;
+            this->SetRendgrid(StrToHarmVisRendgrid(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttHarmVis::WriteHarmVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -880,19 +1075,32 @@ void AttHispanTickVis::ResetHispanTickVis()
 bool AttHispanTickVis::ReadHispanTickVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
-        hasAttribute = true;
-    }
-    if (element.attribute("tilt")) {
-        this->SetTilt(StrToCompassdirection(element.attribute("tilt").value()));
-        if (removeAttr) element.remove_attribute("tilt");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttHispanTickVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("place"):
+            if (std::strcmp(name, "place") != 0) break;
+            this->SetPlace(StrToEventrel(attr.value()));
+            return true;
+        case StrHash("tilt"):
+            if (std::strcmp(name, "tilt") != 0) break;
+            this->SetTilt(StrToCompassdirection(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttHispanTickVis::WriteHispanTickVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -934,14 +1142,28 @@ void AttKeySigVis::ResetKeySigVis()
 bool AttKeySigVis::ReadKeySigVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cancelaccid")) {
-        this->SetCancelaccid(StrToCancelaccid(element.attribute("cancelaccid").value()));
-        if (removeAttr) element.remove_attribute("cancelaccid");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttKeySigVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("cancelaccid"):
+            if (std::strcmp(name, "cancelaccid") != 0) break;
+            this->SetCancelaccid(StrToCancelaccid(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttKeySigVis::WriteKeySigVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -975,19 +1197,32 @@ void AttKeySigDefaultVis::ResetKeySigDefaultVis()
 bool AttKeySigDefaultVis::ReadKeySigDefaultVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("keysig.cancelaccid")) {
-        this->SetKeysigCancelaccid(StrToCancelaccid(element.attribute("keysig.cancelaccid").value()));
-        if (removeAttr) element.remove_attribute("keysig.cancelaccid");
-        hasAttribute = true;
-    }
-    if (element.attribute("keysig.visible")) {
-        this->SetKeysigVisible(StrToBoolean(element.attribute("keysig.visible").value()));
-        if (removeAttr) element.remove_attribute("keysig.visible");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttKeySigDefaultVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("keysig.cancelaccid"):
+            if (std::strcmp(name, "keysig.cancelaccid") != 0) break;
+            this->SetKeysigCancelaccid(StrToCancelaccid(attr.value()));
+            return true;
+        case StrHash("keysig.visible"):
+            if (std::strcmp(name, "keysig.visible") != 0) break;
+            this->SetKeysigVisible(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttKeySigDefaultVis::WriteKeySigDefaultVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1029,14 +1264,28 @@ void AttLigatureVis::ResetLigatureVis()
 bool AttLigatureVis::ReadLigatureVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLigatureform(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLigatureVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToLigatureform(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLigatureVis::WriteLigatureVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1074,39 +1323,48 @@ void AttLineVis::ResetLineVis()
 bool AttLineVis::ReadLineVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLineform(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("width")) {
-        this->SetWidth(StrToLinewidth(element.attribute("width").value()));
-        if (removeAttr) element.remove_attribute("width");
-        hasAttribute = true;
-    }
-    if (element.attribute("endsym")) {
-        this->SetEndsym(StrToLinestartendsymbol(element.attribute("endsym").value()));
-        if (removeAttr) element.remove_attribute("endsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("endsym.size")) {
-        this->SetEndsymSize(StrToInt(element.attribute("endsym.size").value()));
-        if (removeAttr) element.remove_attribute("endsym.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("startsym")) {
-        this->SetStartsym(StrToLinestartendsymbol(element.attribute("startsym").value()));
-        if (removeAttr) element.remove_attribute("startsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("startsym.size")) {
-        this->SetStartsymSize(StrToInt(element.attribute("startsym.size").value()));
-        if (removeAttr) element.remove_attribute("startsym.size");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLineVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToLineform(attr.value()));
+            return true;
+        case StrHash("width"):
+            if (std::strcmp(name, "width") != 0) break;
+            this->SetWidth(StrToLinewidth(attr.value()));
+            return true;
+        case StrHash("endsym"):
+            if (std::strcmp(name, "endsym") != 0) break;
+            this->SetEndsym(StrToLinestartendsymbol(attr.value()));
+            return true;
+        case StrHash("endsym.size"):
+            if (std::strcmp(name, "endsym.size") != 0) break;
+            this->SetEndsymSize(StrToInt(attr.value()));
+            return true;
+        case StrHash("startsym"):
+            if (std::strcmp(name, "startsym") != 0) break;
+            this->SetStartsym(StrToLinestartendsymbol(attr.value()));
+            return true;
+        case StrHash("startsym.size"):
+            if (std::strcmp(name, "startsym.size") != 0) break;
+            this->SetStartsymSize(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLineVis::WriteLineVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1184,14 +1442,28 @@ void AttLiquescentVis::ResetLiquescentVis()
 bool AttLiquescentVis::ReadLiquescentVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("looped")) {
-        this->SetLooped(StrToBoolean(element.attribute("looped").value()));
-        if (removeAttr) element.remove_attribute("looped");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttLiquescentVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("looped"):
+            if (std::strcmp(name, "looped") != 0) break;
+            this->SetLooped(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttLiquescentVis::WriteLiquescentVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1227,29 +1499,40 @@ void AttMensurVis::ResetMensurVis()
 bool AttMensurVis::ReadMensurVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dot")) {
-        this->SetDot(StrToBoolean(element.attribute("dot").value()));
-        if (removeAttr) element.remove_attribute("dot");
-        hasAttribute = true;
-    }
-    if (element.attribute("form")) {
-        this->SetForm(StrToMensurVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToOrientation(element.attribute("orient").value()));
-        if (removeAttr) element.remove_attribute("orient");
-        hasAttribute = true;
-    }
-    if (element.attribute("sign")) {
-        this->SetSign(StrToMensurationsign(element.attribute("sign").value()));
-        if (removeAttr) element.remove_attribute("sign");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMensurVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dot"):
+            if (std::strcmp(name, "dot") != 0) break;
+            this->SetDot(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToMensurVisForm(attr.value()));
+            return true;
+        case StrHash("orient"):
+            if (std::strcmp(name, "orient") != 0) break;
+            this->SetOrient(StrToOrientation(attr.value()));
+            return true;
+        case StrHash("sign"):
+            if (std::strcmp(name, "sign") != 0) break;
+            this->SetSign(StrToMensurationsign(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMensurVis::WriteMensurVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1316,49 +1599,56 @@ void AttMensuralVis::ResetMensuralVis()
 bool AttMensuralVis::ReadMensuralVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mensur.color")) {
-        this->SetMensurColor(StrToStr(element.attribute("mensur.color").value()));
-        if (removeAttr) element.remove_attribute("mensur.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.dot")) {
-        this->SetMensurDot(StrToBoolean(element.attribute("mensur.dot").value()));
-        if (removeAttr) element.remove_attribute("mensur.dot");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.form")) {
-        this->SetMensurForm(StrToMensuralVisMensurform(element.attribute("mensur.form").value()));
-        if (removeAttr) element.remove_attribute("mensur.form");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.loc")) {
-        this->SetMensurLoc(StrToInt(element.attribute("mensur.loc").value()));
-        if (removeAttr) element.remove_attribute("mensur.loc");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.orient")) {
-        this->SetMensurOrient(StrToOrientation(element.attribute("mensur.orient").value()));
-        if (removeAttr) element.remove_attribute("mensur.orient");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.sign")) {
-        this->SetMensurSign(StrToMensurationsign(element.attribute("mensur.sign").value()));
-        if (removeAttr) element.remove_attribute("mensur.sign");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.size")) {
-        this->SetMensurSize(StrToFontsize(element.attribute("mensur.size").value()));
-        if (removeAttr) element.remove_attribute("mensur.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.slash")) {
-        this->SetMensurSlash(StrToInt(element.attribute("mensur.slash").value()));
-        if (removeAttr) element.remove_attribute("mensur.slash");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMensuralVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("mensur.color"):
+            if (std::strcmp(name, "mensur.color") != 0) break;
+            this->SetMensurColor(StrToStr(attr.value()));
+            return true;
+        case StrHash("mensur.dot"):
+            if (std::strcmp(name, "mensur.dot") != 0) break;
+            this->SetMensurDot(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("mensur.form"):
+            if (std::strcmp(name, "mensur.form") != 0) break;
+            this->SetMensurForm(StrToMensuralVisMensurform(attr.value()));
+            return true;
+        case StrHash("mensur.loc"):
+            if (std::strcmp(name, "mensur.loc") != 0) break;
+            this->SetMensurLoc(StrToInt(attr.value()));
+            return true;
+        case StrHash("mensur.orient"):
+            if (std::strcmp(name, "mensur.orient") != 0) break;
+            this->SetMensurOrient(StrToOrientation(attr.value()));
+            return true;
+        case StrHash("mensur.sign"):
+            if (std::strcmp(name, "mensur.sign") != 0) break;
+            this->SetMensurSign(StrToMensurationsign(attr.value()));
+            return true;
+        case StrHash("mensur.size"):
+            if (std::strcmp(name, "mensur.size") != 0) break;
+            this->SetMensurSize(StrToFontsize(attr.value()));
+            return true;
+        case StrHash("mensur.slash"):
+            if (std::strcmp(name, "mensur.slash") != 0) break;
+            this->SetMensurSlash(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMensuralVis::WriteMensuralVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1454,14 +1744,28 @@ void AttMeterSigVis::ResetMeterSigVis()
 bool AttMeterSigVis::ReadMeterSigVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMeterform(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMeterSigVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToMeterform(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMeterSigVis::WriteMeterSigVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1496,24 +1800,36 @@ void AttMeterSigDefaultVis::ResetMeterSigDefaultVis()
 bool AttMeterSigDefaultVis::ReadMeterSigDefaultVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.form")) {
-        this->SetMeterForm(StrToMeterform(element.attribute("meter.form").value()));
-        if (removeAttr) element.remove_attribute("meter.form");
-        hasAttribute = true;
-    }
-    if (element.attribute("meter.showchange")) {
-        this->SetMeterShowchange(StrToBoolean(element.attribute("meter.showchange").value()));
-        if (removeAttr) element.remove_attribute("meter.showchange");
-        hasAttribute = true;
-    }
-    if (element.attribute("meter.visible")) {
-        this->SetMeterVisible(StrToBoolean(element.attribute("meter.visible").value()));
-        if (removeAttr) element.remove_attribute("meter.visible");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMeterSigDefaultVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("meter.form"):
+            if (std::strcmp(name, "meter.form") != 0) break;
+            this->SetMeterForm(StrToMeterform(attr.value()));
+            return true;
+        case StrHash("meter.showchange"):
+            if (std::strcmp(name, "meter.showchange") != 0) break;
+            this->SetMeterShowchange(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("meter.visible"):
+            if (std::strcmp(name, "meter.visible") != 0) break;
+            this->SetMeterVisible(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMeterSigDefaultVis::WriteMeterSigDefaultVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1564,14 +1880,28 @@ void AttMultiRestVis::ResetMultiRestVis()
 bool AttMultiRestVis::ReadMultiRestVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("block")) {
-        this->SetBlock(StrToBoolean(element.attribute("block").value()));
-        if (removeAttr) element.remove_attribute("block");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttMultiRestVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("block"):
+            if (std::strcmp(name, "block") != 0) break;
+            this->SetBlock(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttMultiRestVis::WriteMultiRestVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1604,14 +1934,28 @@ void AttPbVis::ResetPbVis()
 bool AttPbVis::ReadPbVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("folium")) {
-        this->SetFolium(StrToPbVisFolium(element.attribute("folium").value()));
-        if (removeAttr) element.remove_attribute("folium");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPbVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("folium"):
+            if (std::strcmp(name, "folium") != 0) break;
+            this->SetFolium(StrToPbVisFolium(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPbVis::WritePbVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1644,14 +1988,28 @@ void AttPedalVis::ResetPedalVis()
 bool AttPedalVis::ReadPedalVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToPedalstyle(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPedalVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToPedalstyle(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPedalVis::WritePedalVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1685,19 +2043,32 @@ void AttPlicaVis::ResetPlicaVis()
 bool AttPlicaVis::ReadPlicaVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir")) {
-        this->SetDir(StrToStemdirectionBasic(element.attribute("dir").value()));
-        if (removeAttr) element.remove_attribute("dir");
-        hasAttribute = true;
-    }
-    if (element.attribute("len")) {
-        this->SetLen(StrToMeasurementunsigned(element.attribute("len").value()));
-        if (removeAttr) element.remove_attribute("len");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttPlicaVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("dir"):
+            if (std::strcmp(name, "dir") != 0) break;
+            this->SetDir(StrToStemdirectionBasic(attr.value()));
+            return true;
+        case StrHash("len"):
+            if (std::strcmp(name, "len") != 0) break;
+            this->SetLen(StrToMeasurementunsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttPlicaVis::WritePlicaVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1739,14 +2110,28 @@ void AttQuilismaVis::ResetQuilismaVis()
 bool AttQuilismaVis::ReadQuilismaVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("waves")) {
-        this->SetWaves(StrToInt(element.attribute("waves").value()));
-        if (removeAttr) element.remove_attribute("waves");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttQuilismaVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("waves"):
+            if (std::strcmp(name, "waves") != 0) break;
+            this->SetWaves(StrToInt(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttQuilismaVis::WriteQuilismaVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1779,14 +2164,28 @@ void AttSbVis::ResetSbVis()
 bool AttSbVis::ReadSbVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToSbVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSbVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToSbVisForm(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSbVis::WriteSbVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1819,14 +2218,28 @@ void AttScoreDefVis::ResetScoreDefVis()
 bool AttScoreDefVis::ReadScoreDefVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vu.height")) {
-        this->SetVuHeight(StrToStr(element.attribute("vu.height").value()));
-        if (removeAttr) element.remove_attribute("vu.height");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttScoreDefVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("vu.height"):
+            if (std::strcmp(name, "vu.height") != 0) break;
+            this->SetVuHeight(StrToStr(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttScoreDefVis::WriteScoreDefVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1859,14 +2272,28 @@ void AttSectionVis::ResetSectionVis()
 bool AttSectionVis::ReadSectionVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("restart")) {
-        this->SetRestart(StrToBoolean(element.attribute("restart").value()));
-        if (removeAttr) element.remove_attribute("restart");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSectionVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("restart"):
+            if (std::strcmp(name, "restart") != 0) break;
+            this->SetRestart(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSectionVis::WriteSectionVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1899,14 +2326,28 @@ void AttSignifLetVis::ResetSignifLetVis()
 bool AttSignifLetVis::ReadSignifLetVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSignifLetVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("place"):
+            if (std::strcmp(name, "place") != 0) break;
+            this->SetPlace(StrToEventrel(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSignifLetVis::WriteSignifLetVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1939,14 +2380,28 @@ void AttSpaceVis::ResetSpaceVis()
 bool AttSpaceVis::ReadSpaceVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("compressable")) {
-        this->SetCompressable(StrToBoolean(element.attribute("compressable").value()));
-        if (removeAttr) element.remove_attribute("compressable");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttSpaceVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("compressable"):
+            if (std::strcmp(name, "compressable") != 0) break;
+            this->SetCompressable(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttSpaceVis::WriteSpaceVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -1982,29 +2437,40 @@ void AttStaffDefVis::ResetStaffDefVis()
 bool AttStaffDefVis::ReadStaffDefVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("layerscheme")) {
-        this->SetLayerscheme(StrToLayerscheme(element.attribute("layerscheme").value()));
-        if (removeAttr) element.remove_attribute("layerscheme");
-        hasAttribute = true;
-    }
-    if (element.attribute("lines.color")) {
-        this->SetLinesColor(StrToStr(element.attribute("lines.color").value()));
-        if (removeAttr) element.remove_attribute("lines.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("lines.visible")) {
-        this->SetLinesVisible(StrToBoolean(element.attribute("lines.visible").value()));
-        if (removeAttr) element.remove_attribute("lines.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing")) {
-        this->SetSpacing(StrToMeasurementsigned(element.attribute("spacing").value()));
-        if (removeAttr) element.remove_attribute("spacing");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStaffDefVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("layerscheme"):
+            if (std::strcmp(name, "layerscheme") != 0) break;
+            this->SetLayerscheme(StrToLayerscheme(attr.value()));
+            return true;
+        case StrHash("lines.color"):
+            if (std::strcmp(name, "lines.color") != 0) break;
+            this->SetLinesColor(StrToStr(attr.value()));
+            return true;
+        case StrHash("lines.visible"):
+            if (std::strcmp(name, "lines.visible") != 0) break;
+            this->SetLinesVisible(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("spacing"):
+            if (std::strcmp(name, "spacing") != 0) break;
+            this->SetSpacing(StrToMeasurementsigned(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStaffDefVis::WriteStaffDefVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2064,14 +2530,28 @@ void AttStaffGrpVis::ResetStaffGrpVis()
 bool AttStaffGrpVis::ReadStaffGrpVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bar.thru")) {
-        this->SetBarThru(StrToBoolean(element.attribute("bar.thru").value()));
-        if (removeAttr) element.remove_attribute("bar.thru");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStaffGrpVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("bar.thru"):
+            if (std::strcmp(name, "bar.thru") != 0) break;
+            this->SetBarThru(StrToBoolean(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStaffGrpVis::WriteStaffGrpVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2109,39 +2589,48 @@ void AttStemVis::ResetStemVis()
 bool AttStemVis::ReadStemVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pos")) {
-        this->SetPos(StrToStemposition(element.attribute("pos").value()));
-        if (removeAttr) element.remove_attribute("pos");
-        hasAttribute = true;
-    }
-    if (element.attribute("len")) {
-        this->SetLen(StrToMeasurementunsigned(element.attribute("len").value()));
-        if (removeAttr) element.remove_attribute("len");
-        hasAttribute = true;
-    }
-    if (element.attribute("form")) {
-        this->SetForm(StrToStemformMensural(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("dir")) {
-        this->SetDir(StrToStemdirection(element.attribute("dir").value()));
-        if (removeAttr) element.remove_attribute("dir");
-        hasAttribute = true;
-    }
-    if (element.attribute("flag.pos")) {
-        this->SetFlagPos(StrToFlagposMensural(element.attribute("flag.pos").value()));
-        if (removeAttr) element.remove_attribute("flag.pos");
-        hasAttribute = true;
-    }
-    if (element.attribute("flag.form")) {
-        this->SetFlagForm(StrToFlagformMensural(element.attribute("flag.form").value()));
-        if (removeAttr) element.remove_attribute("flag.form");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttStemVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("pos"):
+            if (std::strcmp(name, "pos") != 0) break;
+            this->SetPos(StrToStemposition(attr.value()));
+            return true;
+        case StrHash("len"):
+            if (std::strcmp(name, "len") != 0) break;
+            this->SetLen(StrToMeasurementunsigned(attr.value()));
+            return true;
+        case StrHash("form"):
+            if (std::strcmp(name, "form") != 0) break;
+            this->SetForm(StrToStemformMensural(attr.value()));
+            return true;
+        case StrHash("dir"):
+            if (std::strcmp(name, "dir") != 0) break;
+            this->SetDir(StrToStemdirection(attr.value()));
+            return true;
+        case StrHash("flag.pos"):
+            if (std::strcmp(name, "flag.pos") != 0) break;
+            this->SetFlagPos(StrToFlagposMensural(attr.value()));
+            return true;
+        case StrHash("flag.form"):
+            if (std::strcmp(name, "flag.form") != 0) break;
+            this->SetFlagForm(StrToFlagformMensural(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttStemVis::WriteStemVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
@@ -2222,29 +2711,40 @@ void AttTupletVis::ResetTupletVis()
 bool AttTupletVis::ReadTupletVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bracket.place")) {
-        this->SetBracketPlace(StrToStaffrelBasic(element.attribute("bracket.place").value()));
-        if (removeAttr) element.remove_attribute("bracket.place");
-        hasAttribute = true;
-    }
-    if (element.attribute("bracket.visible")) {
-        this->SetBracketVisible(StrToBoolean(element.attribute("bracket.visible").value()));
-        if (removeAttr) element.remove_attribute("bracket.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.visible")) {
-        this->SetDurVisible(StrToBoolean(element.attribute("dur.visible").value()));
-        if (removeAttr) element.remove_attribute("dur.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("num.format")) {
-        this->SetNumFormat(StrToTupletVisNumformat(element.attribute("num.format").value()));
-        if (removeAttr) element.remove_attribute("num.format");
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
 }
 
+bool AttTupletVis::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{
+    const char *name = attr.name();
+    switch (hash) {
+        case StrHash("bracket.place"):
+            if (std::strcmp(name, "bracket.place") != 0) break;
+            this->SetBracketPlace(StrToStaffrelBasic(attr.value()));
+            return true;
+        case StrHash("bracket.visible"):
+            if (std::strcmp(name, "bracket.visible") != 0) break;
+            this->SetBracketVisible(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("dur.visible"):
+            if (std::strcmp(name, "dur.visible") != 0) break;
+            this->SetDurVisible(StrToBoolean(attr.value()));
+            return true;
+        case StrHash("num.format"):
+            if (std::strcmp(name, "num.format") != 0) break;
+            this->SetNumFormat(StrToTupletVisNumformat(attr.value()));
+            return true;
+        default: break;
+    }
+    return false;
+}
+
 bool AttTupletVis::WriteTupletVis(pugi::xml_node element)
 {
     bool wroteAttribute = false;
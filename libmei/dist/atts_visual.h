@@ -41,6 +41,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadAnnotVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteAnnotVis(pugi::xml_node element);
 
@@ -92,6 +95,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadArpegVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteArpegVis(pugi::xml_node element);
 
@@ -165,6 +171,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBarLineVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBarLineVis(pugi::xml_node element);
 
@@ -230,6 +239,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBeamingVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBeamingVis(pugi::xml_node element);
 
@@ -291,6 +303,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadBeatRptVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteBeatRptVis(pugi::xml_node element);
 
@@ -340,6 +355,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadChordVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteChordVis(pugi::xml_node element);
 
@@ -394,6 +412,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCleffingVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCleffingVis(pugi::xml_node element);
 
@@ -449,6 +470,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadCurvatureDirection(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteCurvatureDirection(pugi::xml_node element);
 
@@ -498,6 +522,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadEpisemaVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteEpisemaVis(pugi::xml_node element);
 
@@ -553,6 +580,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadFTremVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteFTremVis(pugi::xml_node element);
 
@@ -614,6 +644,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadFermataVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteFermataVis(pugi::xml_node element);
 
@@ -669,6 +702,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadFingGrpVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteFingGrpVis(pugi::xml_node element);
 
@@ -718,6 +754,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadGuitarGridVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteGuitarGridVis(pugi::xml_node element);
 
@@ -767,6 +806,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadHairpinVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteHairpinVis(pugi::xml_node element);
 
@@ -848,6 +890,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadHarmVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteHarmVis(pugi::xml_node element);
 
@@ -897,6 +942,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadHispanTickVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteHispanTickVis(pugi::xml_node element);
 
@@ -952,6 +1000,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadKeySigVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteKeySigVis(pugi::xml_node element);
 
@@ -1001,6 +1052,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadKeySigDefaultVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteKeySigDefaultVis(pugi::xml_node element);
 
@@ -1056,6 +1110,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLigatureVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLigatureVis(pugi::xml_node element);
 
@@ -1105,6 +1162,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLineVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLineVis(pugi::xml_node element);
 
@@ -1186,6 +1246,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadLiquescentVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteLiquescentVis(pugi::xml_node element);
 
@@ -1235,6 +1298,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMensurVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMensurVis(pugi::xml_node element);
 
@@ -1302,6 +1368,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMensuralVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMensuralVis(pugi::xml_node element);
 
@@ -1401,6 +1470,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMeterSigVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMeterSigVis(pugi::xml_node element);
 
@@ -1450,6 +1522,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMeterSigDefaultVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMeterSigDefaultVis(pugi::xml_node element);
 
@@ -1514,6 +1589,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadMultiRestVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteMultiRestVis(pugi::xml_node element);
 
@@ -1567,6 +1645,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPbVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePbVis(pugi::xml_node element);
 
@@ -1619,6 +1700,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPedalVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePedalVis(pugi::xml_node element);
 
@@ -1668,6 +1752,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadPlicaVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WritePlicaVis(pugi::xml_node element);
 
@@ -1727,6 +1814,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadQuilismaVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteQuilismaVis(pugi::xml_node element);
 
@@ -1776,6 +1866,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSbVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSbVis(pugi::xml_node element);
 
@@ -1825,6 +1918,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadScoreDefVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteScoreDefVis(pugi::xml_node element);
 
@@ -1878,6 +1974,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSectionVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSectionVis(pugi::xml_node element);
 
@@ -1927,6 +2026,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSignifLetVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSignifLetVis(pugi::xml_node element);
 
@@ -1976,6 +2078,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadSpaceVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteSpaceVis(pugi::xml_node element);
 
@@ -2028,6 +2133,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStaffDefVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStaffDefVis(pugi::xml_node element);
 
@@ -2100,6 +2208,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStaffGrpVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStaffGrpVis(pugi::xml_node element);
 
@@ -2152,6 +2263,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadStemVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteStemVis(pugi::xml_node element);
 
@@ -2241,6 +2355,9 @@ public:
     /** Read the values for the attribute class **/
     bool ReadTupletVis(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool WriteTupletVis(pugi::xml_node element);
 
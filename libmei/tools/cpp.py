@@ -79,6 +79,9 @@ public:
     /** Read the values for the attribute class **/
     bool Read{attGroupNameUpper}(pugi::xml_node element, bool removeAttr = true);
 
+    /** Read an attribute if it belongs to the attribute class, with the StrHash of its name **/
+    bool ReadAttribute(pugi::xml_attribute attr, uint32_t hash);
+
     /** Write the values for the attribute class **/
     bool Write{attGroupNameUpper}(pugi::xml_node element);
 
@@ -128,6 +131,7 @@ ATTCLASS_FILE_CPP = """{license}
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -155,10 +159,25 @@ void Att{attGroupNameUpper}::Reset{attGroupNameUpper}()
 bool Att{attGroupNameUpper}::Read{attGroupNameUpper}(pugi::xml_node element, bool removeAttr)
 {{
     bool hasAttribute = false;
-    {reads}
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {{
+        next = attr.next_attribute();
+        if (!this->ReadAttribute(attr, StrHash(attr.name()))) continue;
+        if (removeAttr) element.remove_attribute(attr);
+        hasAttribute = true;
+    }}
     return hasAttribute;
 }}
 
+bool Att{attGroupNameUpper}::ReadAttribute(pugi::xml_attribute attr, uint32_t hash)
+{{
+    const char *name = attr.name();
+    switch (hash) {{
+        {reads}
+        default: break;
+    }}
+    return false;
+}}
+
 bool Att{attGroupNameUpper}::Write{attGroupNameUpper}(pugi::xml_node element)
 {{
     bool wroteAttribute = false;
@@ -171,11 +190,10 @@ bool Att{attGroupNameUpper}::Write{attGroupNameUpper}(pugi::xml_node element)
 
 ATTCLASS_MEMBERS_DEFAULT_CPP = """m_{attNameLowerJoined} = {attDefault};"""
 
-ATTCLASS_READ_CPP = """if (element.attribute("{attNameLower}")) {{
-        this->Set{attNameUpper}({converterRead}(element.attribute("{attNameLower}").value()));
-        if (removeAttr) element.remove_attribute("{attNameLower}");
-        hasAttribute = true;
-    }}"""
+ATTCLASS_READ_CPP = """case StrHash("{attNameLower}"):
+            if (std::strcmp(name, "{attNameLower}") != 0) break;
+            this->Set{attNameUpper}({converterRead}(attr.value()));
+            return true;"""
 
 ATTCLASS_WRITE_CPP = """if (this->Has{attNameUpper}()) {{
         element.append_attribute("{attNameLower}") = {converterWrite}(this->Get{attNameUpper}()).c_str();
@@ -328,7 +346,9 @@ CONVERTER_H = """
 #ifndef __LIBMEI_ATT_CONVERTER_H__
 #define __LIBMEI_ATT_CONVERTER_H__
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 //----------------------------------------------------------------------------
 
@@ -345,11 +365,22 @@ protected:
     AttConverterBase() = default;
     ~AttConverterBase() = default;
 
-public:"""
+public:
+    /**
+     * Return the 32-bit FNV-1a hash of a string.
+     * Used by the generated code for dispatching attribute names and values with a switch.
+     */
+    static constexpr uint32_t StrHash(std::string_view str)
+    {{
+        uint32_t hash = 2166136261u;
+        for (const char c : str) hash = (hash ^ (unsigned char)c) * 16777619u;
+        return hash;
+    }}
+"""
 
 CONVERTER_METHODS_H = """
     std::string {fname}ToStr({type} data) const;
-    {type} StrTo{fname}(const std::string &value, bool logWarning = true) const;
+    {type} StrTo{fname}(std::string_view value, bool logWarning = true) const;
 """
 
 CONVERTER_END_H = """}};
@@ -395,32 +426,32 @@ namespace {ns} {{
 CONVERTER_METHOD1_START_CPP = """
 std::string AttConverterBase::{fname}ToStr({type} data) const
 {{
-    std::string value;
     switch (data) {{"""
 
 CONVERTER_METHOD2_START_CPP = """
-{type} AttConverterBase::StrTo{fname}(const std::string &value, bool logWarning) const
-{{"""
+{type} AttConverterBase::StrTo{fname}(std::string_view value, bool logWarning) const
+{{
+    switch (StrHash(value)) {{"""
 
 CONVERTER_METHOD1_CPP = """
-        case {val_prefix}_{value}: value = "{string}"; break;"""
+        case {val_prefix}_{value}: return "{string}";"""
 
 CONVERTER_METHOD2_CPP = """
-    if (value == "{string}") return {val_prefix}_{value};"""
+        case StrHash("{string}"):
+            if (value == "{string}") return {val_prefix}_{value};
+            break;"""
 
 CONVERTER_METHOD1_END_CPP = """
-        default:
-            LogWarning("Unknown value '%d' for {type}", data);
-            value = "";
-            break;
+        default: LogWarning("Unknown value '%d' for {type}", data); return "";
     }}
-    return value;
 }}
 """
 
 CONVERTER_METHOD2_END_CPP = """
+        default: break;
+    }}
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for {type}", value.c_str());
+        LogWarning("Unsupported value '%s' for {type}", std::string(value).c_str());
     return {prefix}_NONE;
 }}
 """
@@ -579,6 +610,24 @@ def vrv_converter_cc(name: str) -> str:
     return left[0].upper() + left[1:] + rest
 
 
+def vrv_str_hash(name: str) -> int:
+    """Same 32-bit FNV-1a hash as AttConverterBase::StrHash"""
+    h: int = 2166136261
+    for c in name.encode("utf-8"):
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def vrv_check_hash_collisions(values: list, datatype: str):
+    """The values of a data type are dispatched with a switch on their hash"""
+    hashes: dict = {}
+    for v in values:
+        h: int = vrv_str_hash(v)
+        if h in hashes:
+            raise ValueError(f"Hash collision between {v} and {hashes[h]} in {datatype}")
+        hashes[h] = v
+
+
 def vrv_get_att_config(module, gp, att) -> Optional[dict]:
     if module not in DATATYPES["modules"] or gp not in DATATYPES["modules"][module]:
         return None
@@ -761,6 +810,7 @@ def create_att_classes(cpp_ns: str, schema, outdir: Path):
             reads: list = []
             writes: list = []
             checkers: list = []
+            att_hashes: dict = {}
 
             for att in atts:
                 if "|" in att:
@@ -798,9 +848,15 @@ def create_att_classes(cpp_ns: str, schema, outdir: Path):
 
                 if len(defaults) > 0:
                     defaults.append("\n    ")
-                    reads.append("\n    ")
+                    reads.append("\n        ")
                     writes.append("\n    ")
 
+                # The attributes are dispatched in Read with a switch on the name hash
+                att_hash: int = vrv_str_hash(att_lower_name)
+                if att_hash in att_hashes:
+                    raise ValueError(f"Hash collision between {att_lower_name} and {att_hashes[att_hash]} in {gp}")
+                att_hashes[att_hash] = att_lower_name
+
                 defaults.append(ATTCLASS_MEMBERS_DEFAULT_CPP.format_map(substrings))
                 reads.append(ATTCLASS_READ_CPP.format_map(substrings))
                 writes.append(ATTCLASS_WRITE_CPP.format_map(substrings))
@@ -888,6 +944,7 @@ def create_att_datatypes(cpp_ns: str, schema, outdir: Path):
         att_converter_impl_from_converters.append(CONVERTER_METHOD1_START_CPP.format_map(converter_start_fmt))
         att_converter_impl_to_converters.append(CONVERTER_METHOD2_START_CPP.format_map(converter_start_fmt))
 
+        vrv_check_hash_collisions(values, data_type)
         for v in values:
             val: str = re.sub(r"[\.\-\,]", "_", v)
             val = re.sub(r"\+", "plus", val)
@@ -943,6 +1000,7 @@ def create_att_datatypes(cpp_ns: str, schema, outdir: Path):
         att_converter_impl_from_converters.append(CONVERTER_METHOD1_START_CPP.format_map(converter_start_fmt))
         att_converter_impl_to_converters.append(CONVERTER_METHOD2_START_CPP.format_map(converter_start_fmt))
 
+        vrv_check_hash_collisions(values, list_type)
         for v in values:
             val: str = re.sub(r"[\.\-\,]", "_", v)
             val = re.sub(r"\+", "plus", val)
@@ -32,6 +32,8 @@ CalcArticFunctor::CalcArticFunctor(Doc *doc) : DocFunctor(doc)
     m_layerBelow = NULL;
     m_crossStaffAbove = false;
     m_crossStaffBelow = false;
+
+    this->SetVisitedClassIds({ ARTIC, CHORD, NOTE });
 }
 
 FunctorCode CalcArticFunctor::VisitArtic(Artic *artic)
@@ -24,6 +24,8 @@ CalcChordNoteHeadsFunctor::CalcChordNoteHeadsFunctor(Doc *doc) : DocFunctor(doc)
 {
     m_diameter = 0;
     m_alignmentType = 0;
+
+    this->SetVisitedClassIds({ CHORD, NOTE });
 }
 
 FunctorCode CalcChordNoteHeadsFunctor::VisitChord(Chord *chord)
@@ -28,6 +28,8 @@ CalcDotsFunctor::CalcDotsFunctor(Doc *doc) : DocFunctor(doc)
     m_chordDots = NULL;
     m_chordDrawingX = 0;
     m_chordStemDir = STEMDIRECTION_NONE;
+
+    this->SetVisitedClassIds({ CHORD, NOTE, REST });
 }
 
 FunctorCode CalcDotsFunctor::VisitChord(Chord *chord)
@@ -19,7 +19,10 @@ namespace vrv {
 // CalcLedgerLinesFunctor
 //----------------------------------------------------------------------------
 
-CalcLedgerLinesFunctor::CalcLedgerLinesFunctor(Doc *doc) : DocFunctor(doc) {}
+CalcLedgerLinesFunctor::CalcLedgerLinesFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetVisitedClassIds({ NOTE, STAFF });
+}
 
 FunctorCode CalcLedgerLinesFunctor::VisitNote(Note *note)
 {
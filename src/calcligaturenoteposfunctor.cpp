@@ -21,7 +21,10 @@ namespace vrv {
 // CalcLigatureNotePosFunctor
 //----------------------------------------------------------------------------
 
-CalcLigatureNotePosFunctor::CalcLigatureNotePosFunctor(Doc *doc) : DocFunctor(doc) {}
+CalcLigatureNotePosFunctor::CalcLigatureNotePosFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetVisitedClassIds({ LIGATURE });
+}
 
 FunctorCode CalcLigatureNotePosFunctor::VisitLigature(Ligature *ligature)
 {
@@ -19,7 +19,10 @@ namespace vrv {
 // CalcSpanningBeamSpansFunctor
 //----------------------------------------------------------------------------
 
-CalcSpanningBeamSpansFunctor::CalcSpanningBeamSpansFunctor(Doc *doc) : DocFunctor(doc) {}
+CalcSpanningBeamSpansFunctor::CalcSpanningBeamSpansFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetVisitedClassIds({ BEAMSPAN });
+}
 
 FunctorCode CalcSpanningBeamSpansFunctor::VisitBeamSpan(BeamSpan *beamSpan)
 {
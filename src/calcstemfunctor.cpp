@@ -39,6 +39,8 @@ CalcStemFunctor::CalcStemFunctor(Doc *doc) : DocFunctor(doc)
     m_staff = NULL;
     m_layer = NULL;
     m_interface = NULL;
+
+    this->SetVisitedClassIds({ BEAM, BEAMSPAN, CHORD, FTREM, NOTE, STAFF, STEM, TABDURSYM, TABGRP });
 }
 
 FunctorCode CalcStemFunctor::VisitBeam(Beam *beam)
@@ -217,6 +217,9 @@ FunctorCode CastOffSystemsFunctor::VisitSystem(System *system)
     m_currentSystem = targetSystem;
 
     m_shift = -system->GetDrawingLabelsWidth();
+    // With an excerpt, the system starts with a measure that is not at the beginning of the cached layout
+    Object *firstChild = system->GetChild(0);
+    if (firstChild && firstChild->Is(MEASURE)) m_shift += vrv_cast<Measure *>(firstChild)->GetDrawingXRel();
     m_currentScoreDefWidth = m_page->m_drawingScoreDef.GetDrawingWidth() + system->GetDrawingAbbrLabelsWidth();
 
     return FUNCTOR_CONTINUE;
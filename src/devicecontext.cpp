@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <math.h>
 
 //----------------------------------------------------------------------------
@@ -241,8 +242,23 @@ void DeviceContext::GetTextExtent(const std::u32string &string, TextExtend *exte
     const Resources *resources = this->GetResources();
     assert(resources);
 
+    // The ascent and the descent of the cached extent are the maximum values of the glyphs only
+    const int pointSize = m_fontStack.top()->GetPointSize();
+    TextExtend cached;
+    if (resources->GetCachedTextExtent(string, pointSize, typeSize, cached)) {
+        extend->m_width = cached.m_width;
+        extend->m_height = cached.m_height;
+        extend->m_ascent = std::max(cached.m_ascent, extend->m_ascent);
+        extend->m_descent = std::max(cached.m_descent, extend->m_descent);
+        return;
+    }
+
+    const int ascent = extend->m_ascent;
+    const int descent = extend->m_descent;
     extend->m_width = 0;
     extend->m_height = 0;
+    extend->m_ascent = std::numeric_limits<int>::min();
+    extend->m_descent = std::numeric_limits<int>::min();
 
     if (typeSize) {
         AddGlyphToTextExtend(resources->GetTextGlyph(L'p'), extend);
@@ -270,6 +286,10 @@ void DeviceContext::GetTextExtent(const std::u32string &string, TextExtend *exte
         }
         AddGlyphToTextExtend(glyph, extend);
     }
+
+    resources->SetCachedTextExtent(string, pointSize, typeSize, *extend);
+    extend->m_ascent = std::max(ascent, extend->m_ascent);
+    extend->m_descent = std::max(descent, extend->m_descent);
 }
 
 void DeviceContext::GetSmuflTextExtent(const std::u32string &string, TextExtend *extend)
@@ -9,8 +9,10 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 #include <math.h>
+#include <tuple>
 
 //----------------------------------------------------------------------------
 
@@ -45,6 +47,7 @@
 #include "multirpt.h"
 #include "note.h"
 #include "page.h"
+#include "pagemilestone.h"
 #include "pages.h"
 #include "pgfoot.h"
 #include "pghead.h"
@@ -63,6 +66,7 @@
 #include "system.h"
 #include "tempo.h"
 #include "text.h"
+#include "threadpool.h"
 #include "timemap.h"
 #include "timestamp.h"
 #include "transposefunctor.h"
@@ -89,6 +93,7 @@ Doc::Doc() : Object(DOC, "doc-")
     // owned pointers need to be set to NULL;
     m_selectionPreceding = NULL;
     m_selectionFollowing = NULL;
+    m_threadPool = NULL;
 
     this->Reset();
 }
@@ -98,6 +103,7 @@ Doc::~Doc()
     this->ClearSelectionPages();
 
     delete m_options;
+    delete m_threadPool;
 }
 
 void Doc::Reset()
@@ -132,6 +138,7 @@ void Doc::Reset()
     m_markup = MARKUP_DEFAULT;
     m_isMensuralMusicOnly = false;
     m_isCastOff = false;
+    m_excerptIsCastOff = false;
 
     m_facsimile = NULL;
 
@@ -332,6 +339,8 @@ void Doc::CalculateTimemap()
         return;
     }
 
+    ProfileScope profileScope(m_profiler, "calculateTimemap");
+
     m_timemapTempo = 0.0;
 
     // This happens if the document was never cast off (breaks none option in the toolkit)
@@ -357,15 +366,18 @@ void Doc::CalculateTimemap()
     initMaxMeasureDuration.SetCurrentTempo(tempo);
     initMaxMeasureDuration.SetTempoAdjustment(m_options->m_midiTempoAdjustment.GetValue());
     this->Process(initMaxMeasureDuration);
+    profileScope.Lap("initMaxMeasureDuration");
 
     // Then calculate the onset and offset times (w.r.t. the measure) for every note
     InitOnsetOffsetFunctor initOnsetOffset;
     this->Process(initOnsetOffset);
+    profileScope.Lap("initOnsetOffset");
 
     // Adjust the duration of tied notes
     InitTimemapTiesFunctor initTimemapTies;
     initTimemapTies.SetDirection(BACKWARD);
     this->Process(initTimemapTies);
+    profileScope.Lap("initTimemapTies");
 
     m_timemapTempo = m_options->m_midiTempoAdjustment.GetValue();
 }
@@ -530,6 +542,27 @@ bool Doc::ExportTimemap(std::string &output, bool includeRests, bool includeMeas
     return true;
 }
 
+bool Doc::ExportTimemapBuffer(std::vector<unsigned char> &output, bool includeRests, bool includeMeasures)
+{
+    if (!this->HasTimemap()) {
+        // generate MIDI timemap before progressing
+        CalculateTimemap();
+    }
+    if (!this->HasTimemap()) {
+        LogWarning("Calculation of the timemap failed, the timemap cannot be exported.");
+        output.clear();
+        return false;
+    }
+    Timemap timemap;
+    GenerateTimemapFunctor generateTimemap(&timemap);
+    generateTimemap.SetCueExclusion(this->GetOptions()->m_midiNoCue.GetValue());
+    this->Process(generateTimemap);
+
+    timemap.ToBuffer(output, includeRests, includeMeasures);
+
+    return true;
+}
+
 bool Doc::ExportExpansionMap(std::string &output)
 {
     if (m_expansionMap.HasExpansionMap()) {
@@ -559,71 +592,205 @@ bool Doc::ExportFeatures(std::string &output, const std::string &options)
     return true;
 }
 
+std::vector<ArrayOfObjects> Doc::GetObjectsByScore()
+{
+    std::vector<ArrayOfObjects> objectsByScore;
+
+    // Only for page-based documents
+    Pages *pages = this->GetPages();
+    if (!pages || (this->GetChildCount() != 1)) return objectsByScore;
+
+    int scoreCount = 0;
+    for (Object *page : pages->GetChildren()) {
+        for (Object *child : page->GetChildren()) {
+            if (child->Is(SCORE)) {
+                objectsByScore.push_back(child->GetChildren());
+                ++scoreCount;
+            }
+            else {
+                // Score milestone ends are left out since processing them backward sets the current score
+                if (child->Is(PAGE_MILESTONE_END)) {
+                    PageMilestoneEnd *milestoneEnd = vrv_cast<PageMilestoneEnd *>(child);
+                    assert(milestoneEnd);
+                    if (milestoneEnd->GetStart() && milestoneEnd->GetStart()->Is(SCORE)) continue;
+                }
+                // Objects before the first score (e.g., an mdiv milestone)
+                if (objectsByScore.empty()) objectsByScore.push_back({});
+                objectsByScore.back().push_back(child);
+            }
+        }
+    }
+
+    if (scoreCount < 2) objectsByScore.clear();
+
+    return objectsByScore;
+}
+
+ThreadPool *Doc::GetThreadPool()
+{
+    if (!m_threadPool) m_threadPool = new ThreadPool();
+    return m_threadPool;
+}
+
+void Doc::ProcessObjects(const ArrayOfObjects &objects, Functor &functor)
+{
+    if (functor.GetDirection() == FORWARD) {
+        for (Object *object : objects) {
+            object->Process(functor);
+            if (functor.GetCode() == FUNCTOR_STOP) break;
+        }
+    }
+    else {
+        for (auto iter = objects.rbegin(); iter != objects.rend(); ++iter) {
+            (*iter)->Process(functor);
+            if (functor.GetCode() == FUNCTOR_STOP) break;
+        }
+    }
+}
+
 void Doc::PrepareData()
 {
+    ProfileScope profileScope(m_profiler, "prepareData");
+
     /************ Reset and initialization ************/
 
     if (m_dataPreparationDone) {
         ResetDataFunctor resetData;
         this->Process(resetData);
+        profileScope.Lap("resetData");
     }
     PrepareDataInitializationFunctor prepareDataInitialization(this);
     this->Process(prepareDataInitialization);
+    profileScope.Lap("prepareDataInitialization");
 
     /************ Generate measure indices ************/
 
     this->PrepareMeasureIndices();
+    profileScope.Lap("prepareMeasureIndices");
 
-    /************ Store default durations ************/
+    /************ Store default durations and resolve <reh> position ************/
 
+    // Both are independent and are processed in a single traversal
+    // Resolve <reh> elements early, since they can be encoded without @startid or @tstamp, but we need one internally
+    // for placement
     PrepareDurationFunctor prepareDuration;
-    this->Process(prepareDuration);
+    PrepareRehPositionFunctor prepareRehPosition;
+    CompositeFunctor prepareDurationAndRehPosition({ &prepareDuration, &prepareRehPosition });
+    this->Process(prepareDurationAndRehPosition);
+    profileScope.Lap("prepareDurationAndRehPosition");
+
+    /************ Prepare the scores separately ************/
+
+    // With several scores, the passes that do not cross score boundaries are processed for each score in parallel.
+    // The elements left unmatched within a score are passed to a serial pass on the whole document. When there is a
+    // single score (or none in a score-based document), the whole document is processed in the same way as one group.
+    std::vector<ArrayOfObjects> objectsByScore = this->GetObjectsByScore();
+    if (objectsByScore.empty()) objectsByScore.push_back({ this });
+    const int groupCount = (int)objectsByScore.size();
+    const bool separateScores = (groupCount > 1);
+
+    // A single group is processed in the calling thread
+    ThreadPool serialPool(1);
+    ThreadPool &threadPool = (separateScores) ? *this->GetThreadPool() : serialPool;
+    // The serial passes on the whole document change the current score
+    Score *currentScore = m_currentScore;
+    // The classes of the descendants used for skipping subtrees are cached lazily by the traversals. They are cached
+    // before each parallel section since the serial passes in between can modify the tree, and the parallel passes
+    // do not modify it.
+    auto cacheDescendantClassIds = [this, separateScores]() {
+        if (separateScores) this->GetDescendantClassIds();
+    };
 
     /************ Resolve @startid / @endid ************/
 
     // Try to match all spanning elements (slur, tie, etc) by processing backwards
+    std::vector<PrepareTimeSpanningFunctor> prepareTimeSpanningByScore(groupCount);
+    // Try to match all time pointing elements (tempo, fermata, etc) by processing backwards
+    std::vector<PrepareTimePointingFunctor> prepareTimePointingByScore(groupCount);
+    cacheDescendantClassIds();
+    for (int i = 0; i < groupCount; ++i) {
+        threadPool.Enqueue([&, i]() {
+            PrepareTimeSpanningFunctor &prepareTimeSpanning = prepareTimeSpanningByScore.at(i);
+            prepareTimeSpanning.SetDirection(BACKWARD);
+            Doc::ProcessObjects(objectsByScore.at(i), prepareTimeSpanning);
+            prepareTimeSpanning.SetDataCollectionCompleted();
+
+            // First we try backwards because normally the spanning elements are at the end of
+            // the measure. However, in some case, one (or both) end points will appear afterwards
+            // in the encoding. For these, the previous iteration will not have resolved the link and
+            // the spanning elements will remain in the timeSpanningElements array. We try again forwards
+            // but this time without filling the list (that is only will the remaining elements)
+            if (!prepareTimeSpanning.GetInterfaceOwnerPairs().empty()) {
+                prepareTimeSpanning.SetDirection(FORWARD);
+                Doc::ProcessObjects(objectsByScore.at(i), prepareTimeSpanning);
+            }
+
+            PrepareTimePointingFunctor &prepareTimePointing = prepareTimePointingByScore.at(i);
+            prepareTimePointing.SetDirection(BACKWARD);
+            Doc::ProcessObjects(objectsByScore.at(i), prepareTimePointing);
+        });
+    }
+    threadPool.Wait();
+    profileScope.Lap("prepareTimeSpanningAndTimePointingByScore");
+
+    // Elements with startid and endid not matched within their score are looked for in the whole document
     PrepareTimeSpanningFunctor prepareTimeSpanning;
-    prepareTimeSpanning.SetDirection(BACKWARD);
-    this->Process(prepareTimeSpanning);
-    prepareTimeSpanning.SetDataCollectionCompleted();
-
-    // First we try backwards because normally the spanning elements are at the end of
-    // the measure. However, in some case, one (or both) end points will appear afterwards
-    // in the encoding. For these, the previous iteration will not have resolved the link and
-    // the spanning elements will remain in the timeSpanningElements array. We try again forwards
-    // but this time without filling the list (that is only will the remaining elements)
+    for (const PrepareTimeSpanningFunctor &scoreTimeSpanning : prepareTimeSpanningByScore) {
+        for (const auto &[interface, owner] : scoreTimeSpanning.GetInterfaceOwnerPairs()) {
+            if (interface->HasStartid() && interface->HasEndid()) {
+                prepareTimeSpanning.InsertInterfaceOwnerPair(owner, interface);
+            }
+        }
+    }
     const ListOfSpanningInterOwnerPairs &interfaceOwnerPairs = prepareTimeSpanning.GetInterfaceOwnerPairs();
-    if (!interfaceOwnerPairs.empty()) {
-        prepareTimeSpanning.SetDirection(FORWARD);
+    // Set when elements are linked across scores
+    bool crossScoreLinks = false;
+    if (separateScores && !interfaceOwnerPairs.empty()) {
+        const int unmatchedElements = (int)interfaceOwnerPairs.size();
+        prepareTimeSpanning.SetDataCollectionCompleted();
         this->Process(prepareTimeSpanning);
+        crossScoreLinks = ((int)interfaceOwnerPairs.size() != unmatchedElements);
     }
+    profileScope.Lap("prepareTimeSpanning");
 
     // Display warning if some elements were not matched
-    const int unmatchedElements = (int)std::count_if(interfaceOwnerPairs.cbegin(), interfaceOwnerPairs.cend(),
-        [](const ListOfSpanningInterOwnerPairs::value_type &entry) {
-            return (entry.first->HasStartid() && entry.first->HasEndid());
-        });
-    if (unmatchedElements > 0) {
-        LogWarning("%d time spanning element(s) with startid and endid could not be matched.", unmatchedElements);
+    if (!interfaceOwnerPairs.empty()) {
+        LogWarning("%d time spanning element(s) with startid and endid could not be matched.",
+            (int)interfaceOwnerPairs.size());
     }
 
-    /************ Resolve @startid (only) ************/
-
-    // Resolve <reh> elements first, since they can be encoded without @startid or @tstamp, but we need one internally
-    // for placement
-    PrepareRehPositionFunctor prepareRehPosition;
-    this->Process(prepareRehPosition);
-
-    // Try to match all time pointing elements (tempo, fermata, etc) by processing backwards
-    PrepareTimePointingFunctor prepareTimePointing;
-    prepareTimePointing.SetDirection(BACKWARD);
-    this->Process(prepareTimePointing);
-
     /************ Resolve @tstamp / tstamp2 ************/
 
     // Now try to match the @tstamp and @tstamp2 attributes.
+    // The scores are processed serially because the pass adds TimestampAttr objects to the measures, which modifies
+    // the ancestors shared by the scores and takes IDs from the counter of the thread
+    std::vector<PrepareTimestampsFunctor> prepareTimestampsByScore(groupCount);
+    for (int i = 0; i < groupCount; ++i) {
+        Doc::ProcessObjects(objectsByScore.at(i), prepareTimestampsByScore.at(i));
+    }
+    profileScope.Lap("prepareTimestampsByScore");
+
+    // The @tstamp2 still waiting for their measure at the end of a score are looked for in the next scores
     PrepareTimestampsFunctor prepareTimestamps;
-    this->Process(prepareTimestamps);
+    for (int i = 0; i < groupCount; ++i) {
+        if (!prepareTimestamps.GetObjectBeatPairs().empty()) {
+            for (Object *object : objectsByScore.at(i)) {
+                for (Object *measure : object->FindAllDescendantsByType(MEASURE)) {
+                    prepareTimestamps.VisitMeasureEnd(vrv_cast<Measure *>(measure));
+                }
+            }
+        }
+        const PrepareTimestampsFunctor &scoreTimestamps = prepareTimestampsByScore.at(i);
+        for (const auto &[object, beat] : scoreTimestamps.GetObjectBeatPairs()) {
+            prepareTimestamps.InsertObjectBeatPair(object, beat);
+        }
+        for (const auto &[interface, classID] : scoreTimestamps.GetInterfaceIDPairs()) {
+            prepareTimestamps.InsertInterfaceIDPair(classID, interface);
+        }
+    }
+    // The document end was not reached by processing the scores separately
+    if (separateScores) prepareTimestamps.VisitDocEnd(this);
+    profileScope.Lap("prepareTimestamps");
 
     // If some are still there, then it is probably an issue in the encoding
     if (!prepareTimestamps.GetInterfaceIDPairs().empty()) {
@@ -631,18 +798,76 @@ void Doc::PrepareData()
             prepareTimestamps.GetInterfaceIDPairs().size());
     }
 
-    /************ Resolve linking (@next) ************/
+    /************ Resolve linking (@next), @plist, cross staff, beamspan elements and pedal lines ************/
 
-    // Try to match all pointing elements using @next, @sameas and @stem.sameas
-    PrepareLinkingFunctor prepareLinking;
-    this->Process(prepareLinking);
-    prepareLinking.SetDataCollectionCompleted();
+    std::vector<PrepareLinkingFunctor> prepareLinkingByScore(groupCount);
+    std::vector<PreparePlistFunctor> preparePlistByScore(groupCount);
+    cacheDescendantClassIds();
+    for (int i = 0; i < groupCount; ++i) {
+        threadPool.Enqueue([&, i]() {
+            // Try to match all pointing elements using @next, @sameas and @stem.sameas
+            PrepareLinkingFunctor &prepareLinking = prepareLinkingByScore.at(i);
+            Doc::ProcessObjects(objectsByScore.at(i), prepareLinking);
+            prepareLinking.SetDataCollectionCompleted();
 
-    // If we have some left process again backward
-    if (!prepareLinking.GetSameasIDPairs().empty() || !prepareLinking.GetStemSameasIDPairs().empty()) {
-        prepareLinking.SetDirection(BACKWARD);
+            // If we have some left process again backward
+            if (!prepareLinking.GetSameasIDPairs().empty() || !prepareLinking.GetStemSameasIDPairs().empty()) {
+                prepareLinking.SetDirection(BACKWARD);
+                Doc::ProcessObjects(objectsByScore.at(i), prepareLinking);
+            }
+
+            // Try to match all pointing elements using @plist
+            PreparePlistFunctor &preparePlist = preparePlistByScore.at(i);
+            Doc::ProcessObjects(objectsByScore.at(i), preparePlist);
+            preparePlist.SetDataCollectionCompleted();
+
+            // Process plist after all pairs have been collected
+            if (!preparePlist.GetInterfaceIDPairs().empty()) {
+                Doc::ProcessObjects(objectsByScore.at(i), preparePlist);
+            }
+
+            // Prepare the cross-staff pointers
+            PrepareCrossStaffFunctor prepareCrossStaff;
+            Doc::ProcessObjects(objectsByScore.at(i), prepareCrossStaff);
+
+            PrepareBeamSpanElementsFunctor prepareBeamSpanElements;
+            Doc::ProcessObjects(objectsByScore.at(i), prepareBeamSpanElements);
+
+            PreparePedalsFunctor preparePedals(this);
+            Doc::ProcessObjects(objectsByScore.at(i), preparePedals);
+        });
+    }
+    threadPool.Wait();
+    profileScope.Lap("prepareLinkingAndPointersByScore");
+
+    // Links not matched within their score are looked for in the whole document
+    PrepareLinkingFunctor prepareLinking;
+    PreparePlistFunctor preparePlist;
+    int unmatchedStemSameas = 0;
+    for (int i = 0; i < groupCount; ++i) {
+        for (const auto &[nextID, interface] : prepareLinkingByScore.at(i).GetNextIDPairs()) {
+            prepareLinking.InsertNextIDPair(nextID, interface);
+        }
+        for (const auto &[sameasID, interface] : prepareLinkingByScore.at(i).GetSameasIDPairs()) {
+            prepareLinking.InsertSameasIDPair(sameasID, interface);
+        }
+        unmatchedStemSameas += (int)prepareLinkingByScore.at(i).GetStemSameasIDPairs().size();
+        for (const auto &[interface, elementID] : preparePlistByScore.at(i).GetInterfaceIDPairs()) {
+            preparePlist.InsertInterfaceIDPair(elementID, interface);
+        }
+    }
+    if (separateScores && (!prepareLinking.GetNextIDPairs().empty() || !prepareLinking.GetSameasIDPairs().empty())) {
+        const size_t unmatchedLinks = prepareLinking.GetNextIDPairs().size() + prepareLinking.GetSameasIDPairs().size();
+        prepareLinking.SetDataCollectionCompleted();
         this->Process(prepareLinking);
+        crossScoreLinks = crossScoreLinks
+            || (prepareLinking.GetNextIDPairs().size() + prepareLinking.GetSameasIDPairs().size() != unmatchedLinks);
+    }
+    if (separateScores && !preparePlist.GetInterfaceIDPairs().empty()) {
+        preparePlist.SetDataCollectionCompleted();
+        this->Process(preparePlist);
     }
+    profileScope.Lap("prepareLinkingAndPlist");
 
     // If some are still there, then it is probably an issue in the encoding
     if (!prepareLinking.GetNextIDPairs().empty()) {
@@ -651,44 +876,13 @@ void Doc::PrepareData()
     if (!prepareLinking.GetSameasIDPairs().empty()) {
         LogWarning("%d element(s) with a @sameas could not match the target", prepareLinking.GetSameasIDPairs().size());
     }
-    if (!prepareLinking.GetStemSameasIDPairs().empty()) {
-        LogWarning("%d element(s) with a @stem.sameas could not match the target",
-            prepareLinking.GetStemSameasIDPairs().size());
-    }
-
-    /************ Resolve @plist ************/
-
-    // Try to match all pointing elements using @plist
-    PreparePlistFunctor preparePlist;
-    this->Process(preparePlist);
-    preparePlist.SetDataCollectionCompleted();
-
-    // Process plist after all pairs have been collected
-    if (!preparePlist.GetInterfaceIDPairs().empty()) {
-        this->Process(preparePlist);
+    if (unmatchedStemSameas > 0) {
+        LogWarning("%d element(s) with a @stem.sameas could not match the target", unmatchedStemSameas);
     }
-
-    // If some are still there, then it is probably an issue in the encoding
     if (!preparePlist.GetInterfaceIDPairs().empty()) {
         LogWarning("%d element(s) with a @plist could not match the target", preparePlist.GetInterfaceIDPairs().size());
     }
 
-    /************ Resolve cross staff ************/
-
-    // Prepare the cross-staff pointers
-    PrepareCrossStaffFunctor prepareCrossStaff;
-    this->Process(prepareCrossStaff);
-
-    /************ Resolve beamspan elements ***********/
-
-    PrepareBeamSpanElementsFunctor prepareBeamSpanElements;
-    this->Process(prepareBeamSpanElements);
-
-    /************ Match pedal lines ***********/
-
-    PreparePedalsFunctor preparePedals(this);
-    this->Process(preparePedals);
-
     /************ Prepare processing by staff/layer/verse ************/
 
     // We need to populate processing lists for processing the document by Layer (for matching @tie) and
@@ -696,8 +890,8 @@ void Doc::PrepareData()
     InitProcessingListsFunctor initProcessingLists;
 
     // We first fill a tree of ints with [staff/layer] and [staff/layer/verse] numbers (@n) to be processed
-    // LogElapsedTimeStart();
     this->Process(initProcessingLists);
+    profileScope.Lap("initProcessingLists");
     const IntTree &layerTree = initProcessingLists.GetLayerTree();
     const IntTree &verseTree = initProcessingLists.GetVerseTree();
 
@@ -709,84 +903,160 @@ void Doc::PrepareData()
     IntTree_t::const_iterator layers;
     IntTree_t::const_iterator verses;
 
-    /************ Resolve some pointers by layer ************/
-
     Filters filters;
-    for (staves = layerTree.child.begin(); staves != layerTree.child.end(); ++staves) {
-        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.Clear();
-            // Create ad comparison object for each type / @n
-            AttNIntegerComparison matchStaff(STAFF, staves->first);
-            AttNIntegerComparison matchLayer(LAYER, layers->first);
-            filters.Add(&matchStaff);
-            filters.Add(&matchLayer);
 
-            PreparePointersByLayerFunctor preparePointersByLayer;
-            preparePointersByLayer.SetFilters(&filters);
-            this->Process(preparePointersByLayer);
-        }
-    }
-
-    /************ Resolve delayed turns ************/
-
-    PrepareDelayedTurnsFunctor prepareDelayedTurns;
-    this->Process(prepareDelayedTurns);
-    prepareDelayedTurns.SetDataCollectionCompleted();
-
-    if (!prepareDelayedTurns.GetDelayedTurns().empty()) {
-        for (staves = layerTree.child.begin(); staves != layerTree.child.end(); ++staves) {
-            for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-                filters.Clear();
-                // Create ad comparison object for each type / @n
-                AttNIntegerComparison matchStaff(STAFF, staves->first);
-                AttNIntegerComparison matchLayer(LAYER, layers->first);
-                filters.Add(&matchStaff);
-                filters.Add(&matchLayer);
+    /************ Resolve some pointers by layer and delayed turns ************/
+
+    cacheDescendantClassIds();
+    for (int i = 0; i < groupCount; ++i) {
+        threadPool.Enqueue([&, i]() {
+            Filters scoreFilters;
+            for (auto scoreStaves = layerTree.child.begin(); scoreStaves != layerTree.child.end(); ++scoreStaves) {
+                for (auto scoreLayers = scoreStaves->second.child.begin();
+                     scoreLayers != scoreStaves->second.child.end(); ++scoreLayers) {
+                    scoreFilters.Clear();
+                    // Create ad comparison object for each type / @n
+                    AttNIntegerComparison matchStaff(STAFF, scoreStaves->first);
+                    AttNIntegerComparison matchLayer(LAYER, scoreLayers->first);
+                    scoreFilters.Add(&matchStaff);
+                    scoreFilters.Add(&matchLayer);
+
+                    PreparePointersByLayerFunctor preparePointersByLayer;
+                    preparePointersByLayer.SetFilters(&scoreFilters);
+                    Doc::ProcessObjects(objectsByScore.at(i), preparePointersByLayer);
+                }
+            }
 
-                prepareDelayedTurns.SetFilters(&filters);
-                prepareDelayedTurns.ResetCurrent();
-                this->Process(prepareDelayedTurns);
+            PrepareDelayedTurnsFunctor prepareDelayedTurns;
+            Doc::ProcessObjects(objectsByScore.at(i), prepareDelayedTurns);
+            prepareDelayedTurns.SetDataCollectionCompleted();
+
+            if (prepareDelayedTurns.GetDelayedTurns().empty()) return;
+
+            for (auto scoreStaves = layerTree.child.begin(); scoreStaves != layerTree.child.end(); ++scoreStaves) {
+                for (auto scoreLayers = scoreStaves->second.child.begin();
+                     scoreLayers != scoreStaves->second.child.end(); ++scoreLayers) {
+                    scoreFilters.Clear();
+                    // Create ad comparison object for each type / @n
+                    AttNIntegerComparison matchStaff(STAFF, scoreStaves->first);
+                    AttNIntegerComparison matchLayer(LAYER, scoreLayers->first);
+                    scoreFilters.Add(&matchStaff);
+                    scoreFilters.Add(&matchLayer);
+
+                    prepareDelayedTurns.SetFilters(&scoreFilters);
+                    prepareDelayedTurns.ResetCurrent();
+                    Doc::ProcessObjects(objectsByScore.at(i), prepareDelayedTurns);
+                }
             }
-        }
+        });
     }
+    threadPool.Wait();
+    profileScope.Lap("preparePointersByLayerAndDelayedTurns");
 
     /************ Resolve lyric connectors ************/
 
     // Same for the lyrics, but Verse by Verse since Syl are TimeSpanningInterface elements for handling connectors
+    std::vector<std::tuple<int, int, int>> verseNumbers;
     for (staves = verseTree.child.begin(); staves != verseTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
             for (verses = layers->second.child.begin(); verses != layers->second.child.end(); ++verses) {
-                // std::cout << staves->first << " => " << layers->first << " => " << verses->first << '\n';
-                filters.Clear();
-                // Create ad comparison object for each type / @n
-                AttNIntegerComparison matchStaff(STAFF, staves->first);
-                AttNIntegerComparison matchLayer(LAYER, layers->first);
-                AttNIntegerComparison matchVerse(VERSE, verses->first);
-                filters.Add(&matchStaff);
-                filters.Add(&matchLayer);
-                filters.Add(&matchVerse);
+                verseNumbers.push_back({ staves->first, layers->first, verses->first });
+            }
+        }
+    }
 
-                // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
-                // m_drawingLastNote is set only if the syl has a forward connector
-                PrepareLyricsFunctor prepareLyrics;
-                prepareLyrics.SetFilters(&filters);
-                this->Process(prepareLyrics);
+    // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
+    // m_drawingLastNote is set only if the syl has a forward connector
+    std::vector<std::vector<PrepareLyricsFunctor>> prepareLyricsByScore(groupCount);
+    cacheDescendantClassIds();
+    for (int i = 0; i < groupCount; ++i) {
+        threadPool.Enqueue([&, i]() {
+            Filters scoreFilters;
+            prepareLyricsByScore.at(i).resize(verseNumbers.size());
+            for (int j = 0; j < (int)verseNumbers.size(); ++j) {
+                scoreFilters.Clear();
+                // Create ad comparison object for each type / @n
+                AttNIntegerComparison matchStaff(STAFF, std::get<0>(verseNumbers.at(j)));
+                AttNIntegerComparison matchLayer(LAYER, std::get<1>(verseNumbers.at(j)));
+                AttNIntegerComparison matchVerse(VERSE, std::get<2>(verseNumbers.at(j)));
+                scoreFilters.Add(&matchStaff);
+                scoreFilters.Add(&matchLayer);
+                scoreFilters.Add(&matchVerse);
+
+                PrepareLyricsFunctor &prepareLyrics = prepareLyricsByScore.at(i).at(j);
+                prepareLyrics.SetFilters(&scoreFilters);
+                Doc::ProcessObjects(objectsByScore.at(i), prepareLyrics);
+                prepareLyrics.SetFilters(NULL);
+            }
+        });
+    }
+    threadPool.Wait();
+    profileScope.Lap("prepareLyricsByScore");
+
+    // A syl with a connector still open at the end of a score is ended in the next scores
+    for (int j = 0; j < (int)verseNumbers.size(); ++j) {
+        filters.Clear();
+        AttNIntegerComparison matchStaff(STAFF, std::get<0>(verseNumbers.at(j)));
+        AttNIntegerComparison matchLayer(LAYER, std::get<1>(verseNumbers.at(j)));
+        AttNIntegerComparison matchVerse(VERSE, std::get<2>(verseNumbers.at(j)));
+        filters.Add(&matchStaff);
+        filters.Add(&matchLayer);
+        filters.Add(&matchVerse);
+
+        PrepareLyricsFunctor prepareLyrics;
+        prepareLyrics.SetFilters(&filters);
+        bool continuing = false;
+        for (int i = 0; i < groupCount; ++i) {
+            if (continuing) {
+                Doc::ProcessObjects(objectsByScore.at(i), prepareLyrics);
+                continuing = (prepareLyrics.GetCode() != FUNCTOR_STOP);
+            }
+            if (!continuing && (i < groupCount - 1) && prepareLyricsByScore.at(i).at(j).GetCurrentSyl()) {
+                prepareLyrics.ContinueFrom(prepareLyricsByScore.at(i).at(j));
+                continuing = true;
+            }
+        }
+        // The document end was not reached by processing the scores separately
+        if (separateScores) {
+            if (continuing) {
+                prepareLyrics.VisitDocEnd(this);
+            }
+            else {
+                prepareLyricsByScore.back().at(j).VisitDocEnd(this);
             }
         }
     }
+    profileScope.Lap("prepareLyrics");
 
     /************ Fill control event spanning ************/
 
     // Once <slur>, <ties> and @ties are matched but also syl connectors, we need to set them as running
     // TimeSpanningInterface to each staff they are extended. This does not need to be done staff by staff because we
     // can just check the staff->GetN to see where we are (see PrepareStaffCurrentTimeSpanningFunctor::VisitStaff)
-    PrepareStaffCurrentTimeSpanningFunctor prepareStaffCurrentTimeSpanning;
-    this->Process(prepareStaffCurrentTimeSpanning);
+    // Elements linked across scores need the whole document to be processed at once
+    if (crossScoreLinks) {
+        objectsByScore = { { this } };
+    }
+    std::vector<PrepareStaffCurrentTimeSpanningFunctor> prepareStaffCurrentTimeSpanningByScore(objectsByScore.size());
+    cacheDescendantClassIds();
+    for (int i = 0; i < (int)objectsByScore.size(); ++i) {
+        threadPool.Enqueue([&, i]() {
+            Doc::ProcessObjects(objectsByScore.at(i), prepareStaffCurrentTimeSpanningByScore.at(i));
+        });
+    }
+    threadPool.Wait();
+    profileScope.Lap("prepareStaffCurrentTimeSpanning");
+
+    this->SetCurrentScore(currentScore);
 
     // Something must be wrong in the encoding because a TimeSpanningInterface was left open
-    if (!prepareStaffCurrentTimeSpanning.GetTimeSpanningElements().empty()) {
-        LogDebug("%d time spanning elements could not be set as running",
-            prepareStaffCurrentTimeSpanning.GetTimeSpanningElements().size());
+    int openTimeSpanningElements = 0;
+    for (const PrepareStaffCurrentTimeSpanningFunctor &scoreStaffCurrentTimeSpanning :
+        prepareStaffCurrentTimeSpanningByScore) {
+        openTimeSpanningElements += (int)scoreStaffCurrentTimeSpanning.GetTimeSpanningElements().size();
+    }
+    if (openTimeSpanningElements > 0) {
+        LogDebug("%d time spanning elements could not be set as running", openTimeSpanningElements);
     }
 
     /************ Resolve mRpt ************/
@@ -807,35 +1077,25 @@ void Doc::PrepareData()
             this->Process(prepareRpt);
         }
     }
+    profileScope.Lap("prepareRpt");
 
-    /************ Resolve endings ************/
+    /************ Resolve endings, floating groups, cue size, @altsym and LayerElement parts ************/
 
-    // Prepare the endings (pointers to the measure after and before the boundaries)
+    // These are independent from each other and are processed in a single traversal
+    // - the endings (pointers to the measure after and before the boundaries)
+    // - the floating drawing groups for vertical alignment
+    // - the drawing cue size
+    // - the pointing elements using @altsym
+    // - the LayerElement parts (stem, flag, dots, etc) - this one (re)processes the cue size of the parts it creates
     PrepareMilestonesFunctor prepareMilestones;
-    this->Process(prepareMilestones);
-
-    /************ Resolve floating groups for vertical alignment ************/
-
-    // Prepare the floating drawing groups
     PrepareFloatingGrpsFunctor prepareFloatingGrps;
-    this->Process(prepareFloatingGrps);
-
-    /************ Resolve cue size ************/
-
-    // Prepare the drawing cue size
     PrepareCueSizeFunctor prepareCueSize;
-    this->Process(prepareCueSize);
-
-    /************ Resolve @altsym ************/
-
-    // Try to match all pointing elements using @next, @sameas and @stem.sameas
     PrepareAltSymFunctor prepareAltSym;
-    this->Process(prepareAltSym);
-
-    /************ Instanciate LayerElement parts (stem, flag, dots, etc) ************/
-
     PrepareLayerElementPartsFunctor prepareLayerElementParts;
-    this->Process(prepareLayerElementParts);
+    CompositeFunctor prepareDrawing(
+        { &prepareMilestones, &prepareFloatingGrps, &prepareCueSize, &prepareAltSym, &prepareLayerElementParts });
+    this->Process(prepareDrawing);
+    profileScope.Lap("prepareDrawing");
 
     /************ Add default syl for syllables (if applicable) ************/
     ListOfObjects syllables = this->FindAllDescendantsByType(SYLLABLE);
@@ -843,6 +1103,7 @@ void Doc::PrepareData()
         Syllable *syllable = dynamic_cast<Syllable *>(object);
         syllable->MarkupAddSyl();
     }
+    profileScope.Lap("markupAddSyl");
 
     /************ Resolve @facs ************/
     if (this->GetType() == Facs) {
@@ -856,12 +1117,12 @@ void Doc::PrepareData()
             assert(syl);
             syl->CreateDefaultZone(this);
         }
+        profileScope.Lap("prepareFacsimile");
     }
 
     ScoreDefSetGrpSymFunctor scoreDefSetGrpSym;
     this->GetCurrentScoreDef()->Process(scoreDefSetGrpSym);
-
-    // LogElapsedTimeEnd ("Preparing drawing");
+    profileScope.Lap("scoreDefSetGrpSym");
 
     m_dataPreparationDone = true;
 }
@@ -936,6 +1197,8 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
         return;
     }
 
+    ProfileScope profileScope(m_profiler, "castOff");
+
     std::list<Score *> scores = this->GetScores();
     assert(!scores.empty());
 
@@ -969,6 +1232,7 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
         unCastOffPage->Process(castOffSystems);
         leftoverSystem = castOffSystems.GetLeftoverSystem();
     }
+    profileScope.Lap("castOffSystems");
     // We can now detach and delete the old content page
     pages->DetachChild(0);
     assert(unCastOffPage && !unCastOffPage->GetParent());
@@ -1000,6 +1264,8 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
         this->ScoreDefOptimizeDoc();
     }
 
+    profileScope.Lap("scoreDefOptimize");
+
     // Here we redo the alignment because of the new scoreDefs
     // Because of the new scoreDef, we need to reset cached drawingX
     castOffSinglePage->ResetCachedDrawingX();
@@ -1022,6 +1288,7 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     pages->AddChild(castOffFirstPage);
     castOffSinglePage->Process(castOffPages);
     delete castOffSinglePage;
+    profileScope.Lap("castOffPages");
 
     this->ScoreDefSetCurrentDoc(true);
     if (optimize) {
@@ -1041,6 +1308,8 @@ void Doc::UnCastOffDoc(bool resetCache)
     Pages *pages = this->GetPages();
     assert(pages);
 
+    ProfileScope profileScope(m_profiler, "unCastOff");
+
     Page *unCastOffPage = new Page();
     UnCastOffFunctor unCastOff(unCastOffPage);
     unCastOff.SetResetCache(resetCache);
@@ -1067,6 +1336,8 @@ void Doc::CastOffEncodingDoc()
         return;
     }
 
+    ProfileScope profileScope(m_profiler, "castOffEncoding");
+
     this->ScoreDefSetCurrentDoc();
 
     Pages *pages = this->GetPages();
@@ -1239,6 +1510,139 @@ void Doc::ReactivateSelection(bool resetAligners)
     this->m_drawingPage = NULL;
 }
 
+bool Doc::InitExcerptDoc(const std::string &start, const std::string &end)
+{
+    assert(!this->HasExcerpt() && !this->HasSelection());
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    this->ScoreDefSetCurrentDoc();
+
+    // Look for the content of the systems from the start to the end measure, and for the scoreDef at the start
+    ScoreDef *drawingScoreDef = NULL;
+    bool isExcerpt = false;
+    bool isComplete = false;
+    bool isInterrupted = false;
+    for (Object *page : pages->GetChildren()) {
+        for (Object *child : page->GetChildren()) {
+            if (!child->Is(SYSTEM)) {
+                // The excerpt cannot go over the beginning or the end of a score
+                isInterrupted = isExcerpt;
+                if (isInterrupted) break;
+                continue;
+            }
+            System *system = vrv_cast<System *>(child);
+            if (!isExcerpt) drawingScoreDef = system->GetDrawingScoreDef();
+            for (Object *object : system->GetChildren()) {
+                if (!isExcerpt && object->Is(MEASURE)) {
+                    Measure *measure = vrv_cast<Measure *>(object);
+                    if (measure->GetDrawingScoreDef()) drawingScoreDef = measure->GetDrawingScoreDef();
+                    isExcerpt = (measure->GetID() == start);
+                }
+                if (!isExcerpt) continue;
+                m_excerptContent.push_back({ object, system });
+                if (object->Is(MEASURE) && (object->GetID() == end)) {
+                    isComplete = true;
+                    break;
+                }
+            }
+            if (isComplete) break;
+        }
+        if (isComplete || isInterrupted) break;
+    }
+
+    if (!isComplete) {
+        LogWarning("Excerpt from '%s' to '%s' could not be made within a score", start.c_str(), end.c_str());
+        m_excerptContent.clear();
+        return false;
+    }
+    assert(drawingScoreDef);
+
+    // Add an excerpt scoreDef based on the drawing scoreDef at the start
+    Score *excerptScore = new Score();
+    excerptScore->SetLabel("[excerptScore]");
+    *excerptScore->GetScoreDef() = *drawingScoreDef;
+    // Use the drawing values as actual scoreDef
+    excerptScore->GetScoreDef()->ResetFromDrawingValues();
+
+    while (pages->GetChildCount() > 0) {
+        m_excerptPages.push_back(pages->DetachChild(0));
+    }
+
+    Page *excerptPage = new Page();
+    excerptPage->AddChild(excerptScore);
+    System *excerptSystem = new System();
+    excerptPage->AddChild(excerptSystem);
+    // The content remains in the children of its system, which does not own it anymore
+    for (const auto &[object, system] : m_excerptContent) {
+        system->Relinquish(object->GetIdx());
+        excerptSystem->AddChild(object);
+    }
+    PageMilestoneEnd *excerptScoreEnd = new PageMilestoneEnd(excerptScore);
+    excerptScore->SetEnd(excerptScoreEnd);
+    excerptPage->AddChild(excerptScoreEnd);
+    pages->AddChild(excerptPage);
+
+    m_excerptIsCastOff = m_isCastOff;
+    m_isCastOff = false;
+
+    this->SetCurrentScore(NULL);
+    this->ResetDataPage();
+    this->ScoreDefSetCurrentDoc(true);
+
+    return true;
+}
+
+void Doc::ResetExcerptDoc()
+{
+    assert(this->HasExcerpt());
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    // Move the content back to its system
+    for (const auto &[object, system] : m_excerptContent) {
+        Object *parent = object->GetParent();
+        assert(parent);
+        parent->Relinquish(object->GetIdx());
+        object->SetParent(system);
+        system->Modify();
+    }
+    m_excerptContent.clear();
+
+    pages->ClearChildren();
+    for (Object *page : m_excerptPages) {
+        pages->AddChild(page);
+    }
+    m_excerptPages.clear();
+
+    m_isCastOff = m_excerptIsCastOff;
+
+    this->SetCurrentScore(NULL);
+    this->ResetDataPage();
+
+    // Staff alignments and floating positioners of the excerpt have been deleted with it
+    ResetVerticalAlignmentFunctor resetVerticalAlignment;
+    pages->Process(resetVerticalAlignment);
+
+    this->ScoreDefSetCurrentDoc(true);
+    if (this->IsCastOff()) {
+        // Optimize the doc if one of the score requires optimization
+        for (Score *score : this->GetScores()) {
+            if (score->ScoreDefNeedsOptimization(m_options->m_condense.GetValue())) {
+                this->ScoreDefOptimizeDoc();
+                break;
+            }
+        }
+    }
+
+    // Unsetting the scoreDefs also cleared them from the aligners
+    for (Object *page : pages->GetChildren()) {
+        vrv_cast<Page *>(page)->ResetLayoutDone();
+    }
+}
+
 void Doc::ConvertToPageBasedDoc()
 {
     Pages *pages = new Pages();
@@ -1476,6 +1880,9 @@ int Doc::GetPageCount() const
 
 int Doc::GetGlyphHeight(char32_t code, int staffSize, bool graceSize) const
 {
+    const GlyphMetrics *metrics = this->GetGlyphMetrics(code, graceSize);
+    if (metrics) return metrics->m_height * staffSize / 100;
+
     int x, y, w, h;
     const Resources &resources = this->GetResources();
     const Glyph *glyph = resources.GetGlyph(code);
@@ -1489,6 +1896,9 @@ int Doc::GetGlyphHeight(char32_t code, int staffSize, bool graceSize) const
 
 int Doc::GetGlyphWidth(char32_t code, int staffSize, bool graceSize) const
 {
+    const GlyphMetrics *metrics = this->GetGlyphMetrics(code, graceSize);
+    if (metrics) return metrics->m_width * staffSize / 100;
+
     int x, y, w, h;
     const Resources &resources = this->GetResources();
     const Glyph *glyph = resources.GetGlyph(code);
@@ -1502,6 +1912,9 @@ int Doc::GetGlyphWidth(char32_t code, int staffSize, bool graceSize) const
 
 int Doc::GetGlyphAdvX(char32_t code, int staffSize, bool graceSize) const
 {
+    const GlyphMetrics *metrics = this->GetGlyphMetrics(code, graceSize);
+    if (metrics) return metrics->m_advX * staffSize / 100;
+
     const Resources &resources = this->GetResources();
     const Glyph *glyph = resources.GetGlyph(code);
     assert(glyph);
@@ -1512,6 +1925,15 @@ int Doc::GetGlyphAdvX(char32_t code, int staffSize, bool graceSize) const
     return advX;
 }
 
+const GlyphMetrics *Doc::GetGlyphMetrics(char32_t code, bool graceSize) const
+{
+    const double graceFactor = m_options->m_graceFactor.GetValue();
+    if (!m_glyphMetricTable.IsUpToDate(m_resources, m_drawingSmuflFontSize, graceFactor)) {
+        m_glyphMetricTable.Build(m_resources, m_drawingSmuflFontSize, graceFactor);
+    }
+    return m_glyphMetricTable.GetMetrics(code, graceSize);
+}
+
 Point Doc::ConvertFontPoint(const Glyph *glyph, const Point &fontPoint, int staffSize, bool graceSize) const
 {
     assert(glyph);
@@ -1532,6 +1954,9 @@ Point Doc::ConvertFontPoint(const Glyph *glyph, const Point &fontPoint, int staf
 
 int Doc::GetGlyphLeft(char32_t code, int staffSize, bool graceSize) const
 {
+    const GlyphMetrics *metrics = this->GetGlyphMetrics(code, graceSize);
+    if (metrics) return metrics->m_x * staffSize / 100;
+
     int x, y, w, h;
     const Resources &resources = this->GetResources();
     const Glyph *glyph = resources.GetGlyph(code);
@@ -1550,6 +1975,9 @@ int Doc::GetGlyphRight(char32_t code, int staffSize, bool graceSize) const
 
 int Doc::GetGlyphBottom(char32_t code, int staffSize, bool graceSize) const
 {
+    const GlyphMetrics *metrics = this->GetGlyphMetrics(code, graceSize);
+    if (metrics) return metrics->m_y * staffSize / 100;
+
     int x, y, w, h;
     const Resources &resources = this->GetResources();
     const Glyph *glyph = resources.GetGlyph(code);
@@ -119,49 +119,61 @@ void DocSelection::Set(Doc *doc)
     doc->m_selectionStart = "";
     doc->m_selectionEnd = "";
 
-    if (m_selectionRangeStart != VRV_UNSET) {
-        std::string selectionStartId = "";
-        std::string selectionEndId = "";
+    ListOfObjects measures;
+    if (m_selectionRangeStart != VRV_UNSET) measures = doc->FindAllDescendantsByType(MEASURE, false);
 
-        ListOfObjects measures = doc->FindAllDescendantsByType(MEASURE, false);
+    std::string selectionStartId;
+    std::string selectionEndId;
+    if (!this->GetRangeIds(measures, selectionStartId, selectionEndId)) return;
 
-        if (measures.empty()) {
-            LogWarning("No measure found for selection '%s'.", m_measureRange.c_str());
-            return;
-        }
+    doc->m_selectionStart = selectionStartId;
+    doc->m_selectionEnd = selectionEndId;
+}
 
-        if (m_selectionRangeStart == -1) {
-            selectionStartId = measures.front()->GetID();
-        }
-        else if (m_selectionRangeStart > 0 && m_selectionRangeStart <= (int)measures.size()) {
-            ListOfObjects::const_iterator it = measures.begin();
-            std::advance(it, m_selectionRangeStart - 1);
-            selectionStartId = (*it)->GetID();
-        }
-        else {
-            LogWarning("Measure range start for selection '%s' could not be found.", m_measureRange.c_str());
-            return;
-        }
+bool DocSelection::GetRangeIds(const ListOfObjects &measures, std::string &startId, std::string &endId) const
+{
+    startId = "";
+    endId = "";
 
-        if (m_selectionRangeEnd == -1) {
-            selectionEndId = measures.back()->GetID();
-        }
-        else if (m_selectionRangeEnd > 0 && m_selectionRangeEnd <= (int)measures.size()) {
-            ListOfObjects::const_iterator it = measures.begin();
-            std::advance(it, m_selectionRangeEnd - 1);
-            selectionEndId = (*it)->GetID();
-        }
-        else {
-            LogWarning("Measure range end for selection '%s' could not be found.", m_measureRange.c_str());
-            return;
-        }
-        doc->m_selectionStart = selectionStartId;
-        doc->m_selectionEnd = selectionEndId;
+    if (m_selectionRangeStart == VRV_UNSET) {
+        startId = m_selectionStart;
+        endId = m_selectionEnd;
+        return (!startId.empty() && !endId.empty());
+    }
+
+    if (measures.empty()) {
+        LogWarning("No measure found for selection '%s'.", m_measureRange.c_str());
+        return false;
+    }
+
+    if (m_selectionRangeStart == -1) {
+        startId = measures.front()->GetID();
+    }
+    else if (m_selectionRangeStart > 0 && m_selectionRangeStart <= (int)measures.size()) {
+        ListOfObjects::const_iterator it = measures.begin();
+        std::advance(it, m_selectionRangeStart - 1);
+        startId = (*it)->GetID();
+    }
+    else {
+        LogWarning("Measure range start for selection '%s' could not be found.", m_measureRange.c_str());
+        return false;
+    }
+
+    if (m_selectionRangeEnd == -1) {
+        endId = measures.back()->GetID();
+    }
+    else if (m_selectionRangeEnd > 0 && m_selectionRangeEnd <= (int)measures.size()) {
+        ListOfObjects::const_iterator it = measures.begin();
+        std::advance(it, m_selectionRangeEnd - 1);
+        endId = (*it)->GetID();
     }
     else {
-        doc->m_selectionStart = m_selectionStart;
-        doc->m_selectionEnd = m_selectionEnd;
+        LogWarning("Measure range end for selection '%s' could not be found.", m_measureRange.c_str());
+        startId = "";
+        return false;
     }
+
+    return true;
 }
 
 } // namespace vrv
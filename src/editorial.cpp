@@ -73,6 +73,14 @@ void EditorialElement::Reset()
 
 EditorialElement::~EditorialElement() {}
 
+void EditorialElement::SetVisibility(VisibilityType visibility)
+{
+    if (m_visibility == visibility) return;
+
+    m_visibility = visibility;
+    this->Modify();
+}
+
 bool EditorialElement::IsSupportedChild(Object *child)
 {
     if (child->IsEditorialElement()) {
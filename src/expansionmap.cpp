@@ -16,6 +16,7 @@
 
 #include "editorial.h"
 #include "expansion.h"
+#include "jsonwriter.h"
 #include "linkinginterface.h"
 #include "plistinterface.h"
 #include "timeinterface.h"
@@ -115,11 +116,11 @@ void ExpansionMap::Expand(const xsdAnyURI_List &expansionList, xsdAnyURI_List &e
         assert(currSect);
         if (currSect->Is(ENDING) || currSect->Is(SECTION)) {
             SystemElement *tmp = dynamic_cast<SystemElement *>(currSect);
-            tmp->m_visibility = Hidden;
+            tmp->SetVisibility(Hidden);
         }
         else if (currSect->Is(LEM) || currSect->Is(RDG)) {
             EditorialElement *tmp = dynamic_cast<EditorialElement *>(currSect);
-            tmp->m_visibility = Hidden;
+            tmp->SetVisibility(Hidden);
         }
     }
 }
@@ -265,14 +266,12 @@ void ExpansionMap::GeneratePredictableIDs(Object *source, Object *target)
 
 void ExpansionMap::ToJson(std::string &output)
 {
-    jsonxx::Object expansionmap;
-    for (auto &[id, ids] : m_map) {
-        jsonxx::Array expandedIds;
-        for (auto i : ids) expandedIds << i;
-        expansionmap << id << expandedIds;
-        ;
+    JsonWriter writer(output);
+    writer.StartObject();
+    for (const auto &[id, ids] : m_map) {
+        writer.AddStringArray(id, ids);
     }
-    output = expansionmap.json();
+    writer.EndObject();
 }
 
 } // namespace vrv
@@ -17,6 +17,7 @@
 #include "chord.h"
 #include "doc.h"
 #include "gracegrp.h"
+#include "jsonwriter.h"
 #include "layer.h"
 #include "mdiv.h"
 #include "measure.h"
@@ -60,11 +61,9 @@ void FeatureExtractor::Extract(const Object *object)
         // Check if the note is tied to a previous one and skip it if yes
         if (note->GetScoreTimeTiedDuration() == -1.0) {
             // Check if we need to add it to the previous interval ids
-            const int intervalsIdsSize = (int)m_intervalsIds.size();
-            if (intervalsIdsSize > 0) m_intervalsIds.get<jsonxx::Array>(intervalsIdsSize - 1) << note->GetID();
+            if (!m_intervalsIds.empty()) m_intervalsIds.back().push_back(note->GetID());
             // Same for pitch ids
-            const int pitchesIdsSize = (int)m_pitchesIds.size();
-            if (pitchesIdsSize > 0) m_pitchesIds.get<jsonxx::Array>(pitchesIdsSize - 1) << note->GetID();
+            if (!m_pitchesIds.empty()) m_pitchesIds.back().push_back(note->GetID());
             m_previousNotes.push_back(note);
             return;
         }
@@ -104,37 +103,35 @@ void FeatureExtractor::Extract(const Object *object)
         std::transform(pname.begin(), pname.end(), pname.begin(), ::toupper);
         pitch << pname;
 
-        m_pitchesChromatic << pitch.str();
-        m_pitchesDiatonic << pname;
-        jsonxx::Array pitchesIds;
-        pitchesIds << note->GetID();
-        m_pitchesIds << jsonxx::Value(pitchesIds);
+        m_pitchesChromatic.push_back(pitch.str());
+        m_pitchesDiatonic.push_back(pname);
+        m_pitchesIds.push_back({ note->GetID() });
 
         // We have a previous note (or more with tied notes), so we can calculate an interval
         if (!m_previousNotes.empty()) {
             const int intervalChromatic = note->GetMIDIPitch() - m_previousNotes.front()->GetMIDIPitch();
             if (intervalChromatic == 0) {
-                m_intervalGrossContour << "s";
-                m_intervalRefinedContour << "s";
+                m_intervalGrossContour.push_back("s");
+                m_intervalRefinedContour.push_back("s");
             }
             else if (intervalChromatic < 0) {
-                m_intervalGrossContour << "D";
-                m_intervalRefinedContour << ((intervalChromatic < -2) ? "D" : "d");
+                m_intervalGrossContour.push_back("D");
+                m_intervalRefinedContour.push_back((intervalChromatic < -2) ? "D" : "d");
             }
             else {
-                m_intervalGrossContour << "U";
-                m_intervalRefinedContour << ((intervalChromatic > 2) ? "U" : "u");
+                m_intervalGrossContour.push_back("U");
+                m_intervalRefinedContour.push_back((intervalChromatic > 2) ? "U" : "u");
             }
-            m_intervalsChromatic << StringFormat("%d", intervalChromatic);
+            m_intervalsChromatic.push_back(StringFormat("%d", intervalChromatic));
             std::string intervalDiatonicStr
                 = StringFormat("%d", note->GetDiatonicPitch() - m_previousNotes.front()->GetDiatonicPitch());
-            m_intervalsDiatonic << intervalDiatonicStr;
-            jsonxx::Array intervalsIds;
+            m_intervalsDiatonic.push_back(intervalDiatonicStr);
+            std::vector<std::string> intervalsIds;
             for (const Note *previousNote : m_previousNotes) {
-                intervalsIds << previousNote->GetID();
+                intervalsIds.push_back(previousNote->GetID());
             }
-            intervalsIds << note->GetID();
-            m_intervalsIds << jsonxx::Value(intervalsIds);
+            intervalsIds.push_back(note->GetID());
+            m_intervalsIds.push_back(intervalsIds);
         }
         m_previousNotes.clear();
         m_previousNotes.push_back(note);
@@ -143,19 +140,33 @@ void FeatureExtractor::Extract(const Object *object)
 
 void FeatureExtractor::ToJson(std::string &output)
 {
-    jsonxx::Object o;
-
-    o << "pitchesChromatic" << m_pitchesChromatic;
-    o << "pitchesDiatonic" << m_pitchesDiatonic;
-    o << "pitchesIds" << m_pitchesIds;
-
-    o << "intervalsChromatic" << m_intervalsChromatic;
-    o << "intervalsDiatonic" << m_intervalsDiatonic;
-    o << "intervalGrossContour" << m_intervalGrossContour;
-    o << "intervalRefinedContour" << m_intervalRefinedContour;
-    o << "intervalsIds" << m_intervalsIds;
+    // Keys are written in alphabetical order (same order as with jsonxx)
+    JsonWriter writer(output);
+    writer.StartObject();
+
+    writer.AddStringArray("intervalGrossContour", m_intervalGrossContour);
+    writer.AddStringArray("intervalRefinedContour", m_intervalRefinedContour);
+    writer.AddStringArray("intervalsChromatic", m_intervalsChromatic);
+    writer.AddStringArray("intervalsDiatonic", m_intervalsDiatonic);
+    writer.StartArray("intervalsIds");
+    for (const std::vector<std::string> &ids : m_intervalsIds) {
+        writer.StartArray();
+        for (const std::string &id : ids) writer.AddString(id);
+        writer.EndArray();
+    }
+    writer.EndArray();
+
+    writer.AddStringArray("pitchesChromatic", m_pitchesChromatic);
+    writer.AddStringArray("pitchesDiatonic", m_pitchesDiatonic);
+    writer.StartArray("pitchesIds");
+    for (const std::vector<std::string> &ids : m_pitchesIds) {
+        writer.StartArray();
+        for (const std::string &id : ids) writer.AddString(id);
+        writer.EndArray();
+    }
+    writer.EndArray();
 
-    output = o.json();
+    writer.EndObject();
     LogDebug("%s", output.c_str());
 }
 
@@ -0,0 +1,78 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        glyphmetrictable.cpp
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "glyphmetrictable.h"
+
+//----------------------------------------------------------------------------
+
+#include <cassert>
+
+//----------------------------------------------------------------------------
+
+#include "glyph.h"
+#include "resources.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// GlyphMetricTable
+//----------------------------------------------------------------------------
+
+GlyphMetricTable::GlyphMetricTable()
+{
+    m_codeCount = 0;
+    m_fontGeneration = -1;
+    m_fontSize = 0;
+    m_graceFactor = 0.0;
+}
+
+void GlyphMetricTable::Build(const Resources &resources, int fontSize, double graceFactor)
+{
+    m_fontGeneration = resources.GetFontGeneration();
+    m_fontSize = fontSize;
+    m_graceFactor = graceFactor;
+
+    // Only keep the codes up to the last glyph of the font
+    m_codeCount = 0;
+    for (char32_t code = k_lastCode; code >= k_firstCode; --code) {
+        if (resources.GetGlyph(code)) {
+            m_codeCount = code - k_firstCode + 1;
+            break;
+        }
+    }
+
+    m_metrics.assign(2 * m_codeCount, GlyphMetrics());
+
+    for (uint32_t idx = 0; idx < m_codeCount; ++idx) {
+        const Glyph *glyph = resources.GetGlyph(k_firstCode + idx);
+        if (!glyph) continue;
+
+        int x, y, w, h;
+        glyph->GetBoundingBox(x, y, w, h);
+        const int unitsPerEm = glyph->GetUnitsPerEm();
+        assert(unitsPerEm);
+
+        // The values are rounded at the same steps as in Doc::GetGlyphWidth and similar
+        GlyphMetrics &metrics = m_metrics[2 * idx];
+        metrics.m_x = x * fontSize / unitsPerEm;
+        metrics.m_y = y * fontSize / unitsPerEm;
+        metrics.m_width = w * fontSize / unitsPerEm;
+        metrics.m_height = h * fontSize / unitsPerEm;
+        metrics.m_advX = glyph->GetHorizAdvX() * fontSize / unitsPerEm;
+        metrics.m_isSet = true;
+
+        GlyphMetrics &graceMetrics = m_metrics[2 * idx + 1];
+        graceMetrics.m_x = metrics.m_x * graceFactor;
+        graceMetrics.m_y = metrics.m_y * graceFactor;
+        graceMetrics.m_width = metrics.m_width * graceFactor;
+        graceMetrics.m_height = metrics.m_height * graceFactor;
+        graceMetrics.m_advX = metrics.m_advX * graceFactor;
+        graceMetrics.m_isSet = true;
+    }
+}
+
+} // namespace vrv
@@ -66,16 +66,16 @@ namespace vrv {
 
 #ifndef NO_ABC_SUPPORT
 
-// Global variables:
-std::string abcLine;
+// Global variables (thread local for converting collections on several threads):
+thread_local std::string abcLine;
 #define MAX_DATA_LEN 1024 // One line of the abc file would not be that long!
-char dataKey[MAX_DATA_LEN];
-char dataValue[MAX_DATA_LEN]; // ditto as above
+thread_local char dataKey[MAX_DATA_LEN];
+thread_local char dataValue[MAX_DATA_LEN]; // ditto as above
 
 const std::string pitch = "FCGDAEB";
 const std::string shorthandDecoration = ".~HLMOPSTuv";
-std::string keyPitchAlter = "";
-int keyPitchAlterAmount = 0;
+thread_local std::string keyPitchAlter = "";
+thread_local int keyPitchAlterAmount = 0;
 
 //----------------------------------------------------------------------------
 // ABCInput
@@ -809,7 +809,7 @@ void ABCInput::parseReferenceNumber(const std::string &referenceNumberString)
 {
     // The X: field is also used to indicate the start of the tune
     m_mdiv = new Mdiv();
-    m_mdiv->m_visibility = Visible;
+    m_mdiv->SetVisibility(Visible);
     if (!referenceNumberString.empty()) {
         const int mdivNum = atoi(referenceNumberString.c_str());
         if (mdivNum < 1) {
@@ -27246,7 +27246,7 @@ void HumdrumInput::setupMeiDocument()
     m_doc->SetType(Raw);
     // The mdiv
     Mdiv *mdiv = new Mdiv();
-    mdiv->m_visibility = Visible;
+    mdiv->SetVisibility(Visible);
     m_doc->AddChild(mdiv);
     // The score
     m_score = new Score();
@@ -27444,7 +27444,7 @@ static const EntityNameEntry StaticEntityNames[] = {
 
 typedef std::map<std::string, unsigned int> EntityNameMap;
 typedef std::pair<std::string, unsigned int> EntityNamePair;
-static EntityNameMap EntityNames;
+static thread_local EntityNameMap EntityNames;
 
 //////////////////////////////
 //
@@ -10,6 +10,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cctype>
 #include <iostream>
 
 //----------------------------------------------------------------------------
@@ -153,6 +154,9 @@
 #include "vrv.h"
 #include "zone.h"
 
+// The attribute of the measures split from a stream pointing to their content
+#define MEASURE_CHUNK_ATTR "vrv-chunk"
+
 namespace vrv {
 
 const std::vector<std::string> MEIInput::s_editorialElementNames = { "abbr", "add", "app", "annot", "choice", "corr",
@@ -169,6 +173,8 @@ MEIOutput::MEIOutput(Doc *doc) : Output(doc)
     m_basic = false;
     m_ignoreHeader = false;
     m_removeIds = false;
+    m_streamWriter = NULL;
+    m_streamFlags = pugi::format_default;
 
     this->Reset();
     this->ResetFilter();
@@ -176,9 +182,36 @@ MEIOutput::MEIOutput(Doc *doc) : Output(doc)
 
 MEIOutput::~MEIOutput() {}
 
-bool MEIOutput::Export()
+bool MEIOutput::Export(pugi::xml_writer &writer)
 {
+    pugi::xml_document meiDoc;
+
+    unsigned int output_flags = pugi::format_default;
+    if (m_doc->GetOptions()->m_outputSmuflXmlEntities.GetValue()) {
+        output_flags |= pugi::format_no_escapes;
+    }
+    if (m_doc->GetOptions()->m_outputFormatRaw.GetValue()) {
+        output_flags |= pugi::format_raw;
+    }
+
+    // The nodes are written by SaveFunctor as soon as they are complete
+    m_streamWriter = &writer;
+    m_streamIndent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
+    m_streamFlags = output_flags;
+    m_streamedNodes = { meiDoc.root() };
+
+    const bool success = this->ExportDocument(meiDoc);
+    // Write the nodes left, which is the whole document if nothing was streamed
+    if (success) this->StreamChildren(0, pugi::xml_node());
+
+    m_streamWriter = NULL;
+    m_streamedNodes.clear();
+
+    return success;
+}
 
+bool MEIOutput::ExportDocument(pugi::xml_document &meiDoc)
+{
     if (m_removeIds) {
         FindAllReferencedObjectsFunctor findAllReferencedObjects(&m_referredObjects);
         // When saving page-based MEI we also want to keep IDs for milestone elements
@@ -188,8 +221,6 @@ bool MEIOutput::Export()
     }
 
     try {
-        pugi::xml_document meiDoc;
-
         if (this->HasFilter()) {
             if (!this->IsScoreBasedMEI()) {
                 LogError("MEI output with filter is not possible in page-based MEI");
@@ -258,20 +289,11 @@ bool MEIOutput::Export()
 
         // Redo the mensural segment cast of if necessary
         m_doc->ConvertToCastOffMensuralDoc(true);
-        unsigned int output_flags = pugi::format_default;
-        if (m_doc->GetOptions()->m_outputSmuflXmlEntities.GetValue()) {
-            output_flags |= pugi::format_no_escapes;
-        }
-        if (m_doc->GetOptions()->m_outputFormatRaw.GetValue()) {
-            output_flags |= pugi::format_raw;
-        }
 
-        if (this->GetBasic()) {
+        // When streaming, the nodes are pruned when they are written
+        if (this->GetBasic() && !m_streamWriter) {
             this->PruneAttributes(m_mei.child("music"));
         }
-
-        std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
-        meiDoc.save(m_streamStringOutput, indent.c_str(), output_flags);
     }
     catch (char *str) {
         LogError("%s", str);
@@ -283,9 +305,9 @@ bool MEIOutput::Export()
 
 std::string MEIOutput::GetOutput()
 {
-    this->Export();
-
-    std::string output = m_streamStringOutput.str();
+    std::string output;
+    MEIStringWriter writer(output);
+    if (!this->Export(writer)) output.clear();
 
     this->Reset();
 
@@ -990,9 +1012,101 @@ bool MEIOutput::WriteObjectInternalEnd(Object *object)
     m_nodeStack.pop_back();
     m_currentNode = m_nodeStack.back();
 
+    // The children of the current node are all complete
+    if (m_streamWriter && this->IsStreamableNode(m_currentNode)) this->StreamNode(m_currentNode);
+
     return true;
 }
 
+bool MEIOutput::IsStreamableNode(pugi::xml_node node) const
+{
+    // Containers that never have text content and are not modified once they have children
+    static const std::set<std::string> containers = { "mei", "music", "body", "mdiv", "mdivb", "score", "section",
+        "secb", "ending", "expansion", "pages", "page", "system", "measure", "staff", "layer" };
+
+    if (!containers.count(node.name())) return false;
+    // With MEI basic, the attributes of the descendants of unsupported elements are not pruned
+    if (this->GetBasic() && !MEIBasic::map.count(node.name())) return false;
+    return true;
+}
+
+void MEIOutput::StreamNode(pugi::xml_node node)
+{
+    std::vector<pugi::xml_node> ancestors;
+    for (pugi::xml_node ancestor = node; ancestor; ancestor = ancestor.parent()) {
+        // The document node is not an element
+        if (ancestor.parent() && !this->IsStreamableNode(ancestor)) return;
+        ancestors.insert(ancestors.begin(), ancestor);
+    }
+
+    int level = 1;
+    while ((level < (int)ancestors.size()) && (level < (int)m_streamedNodes.size())
+        && (ancestors.at(level) == m_streamedNodes.at(level))) {
+        ++level;
+    }
+
+    // Write the start tag of the ancestors not streamed yet, after the nodes preceding them
+    for (; level < (int)ancestors.size(); ++level) {
+        this->StreamChildren(level - 1, ancestors.at(level));
+        assert((int)m_streamedNodes.size() == level);
+        pugi::xml_node ancestor = ancestors.at(level);
+
+        // Write a copy without children as an empty element and turn it into a start tag
+        pugi::xml_document copyDoc;
+        pugi::xml_node copy = copyDoc.append_child(ancestor.name());
+        for (pugi::xml_attribute attribute : ancestor.attributes()) copy.append_copy(attribute);
+        // With MEI basic, <music> (level 2) and its descendants are pruned
+        if (this->GetBasic() && (level >= 2)) this->PruneAttributes(copy);
+
+        std::string startTag;
+        MEIStringWriter startTagWriter(startTag);
+        copy.print(startTagWriter, m_streamIndent.c_str(), m_streamFlags, pugi::encoding_auto, level - 1);
+        const bool raw = (m_streamFlags & pugi::format_raw);
+        // Remove "/>" or " />\n"
+        startTag.resize(startTag.size() - ((raw) ? 2 : 4));
+        startTag += (raw) ? ">" : ">\n";
+        m_streamWriter->write(startTag.data(), startTag.size());
+
+        m_streamedNodes.push_back(ancestor);
+    }
+
+    this->StreamChildren((int)ancestors.size() - 1, pugi::xml_node());
+}
+
+void MEIOutput::StreamChildren(int level, pugi::xml_node until)
+{
+    pugi::xml_node node = m_streamedNodes.at(level);
+    const bool raw = (m_streamFlags & pugi::format_raw);
+
+    pugi::xml_node child = node.first_child();
+    while (child && (child != until)) {
+        pugi::xml_node next = child.next_sibling();
+        // A node with its start tag written is closed
+        if ((level + 1 < (int)m_streamedNodes.size()) && (child == m_streamedNodes.at(level + 1))) {
+            this->StreamChildren(level + 1, pugi::xml_node());
+            this->StreamIndent(level);
+            const std::string endTag = "</" + std::string(child.name()) + ((raw) ? ">" : ">\n");
+            m_streamWriter->write(endTag.data(), endTag.size());
+            m_streamedNodes.resize(level + 1);
+        }
+        else {
+            // With MEI basic, <music> (level 2) and its descendants are pruned
+            if (this->GetBasic() && ((level >= 2) || (std::string(child.name()) == "music"))) {
+                this->PruneAttributes(child);
+            }
+            child.print(*m_streamWriter, m_streamIndent.c_str(), m_streamFlags, pugi::encoding_auto, level);
+        }
+        node.remove_child(child);
+        child = next;
+    }
+}
+
+void MEIOutput::StreamIndent(int depth)
+{
+    if (m_streamFlags & pugi::format_raw) return;
+    for (int i = 0; i < depth; ++i) m_streamWriter->write(m_streamIndent.data(), m_streamIndent.size());
+}
+
 bool MEIOutput::HasFilter() const
 {
     return m_hasFilter;
@@ -1045,9 +1159,6 @@ void MEIOutput::Reset()
     m_currentPage = 0;
     m_measureFilterMatchLocation = RangeMatchLocation::BeforeStart;
     m_mdivFilterMatchLocation = MatchLocation::Before;
-
-    m_streamStringOutput.str("");
-    m_streamStringOutput.clear();
 }
 
 bool MEIOutput::IsTreeObject(Object *object) const
@@ -3349,18 +3460,39 @@ MEIInput::MEIInput(Doc *doc) : Input(doc)
     m_hasScoreDef = false;
     m_readingScoreBased = false;
     m_meiversion = meiVersion_MEIVERSION_NONE;
+    m_releaseNodes = false;
+    m_stream = NULL;
 }
 
 MEIInput::~MEIInput() {}
 
 bool MEIInput::Import(const std::string &mei)
+{
+    pugi::xml_document doc;
+    doc.load_string(mei.c_str(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
+    m_releaseNodes = true;
+    const bool success = this->ImportDocument(doc);
+    m_releaseNodes = false;
+    return success;
+}
+
+bool MEIInput::ImportBuffer(char *data, size_t length)
+{
+    pugi::xml_document doc;
+    // The strings of the tree point to the buffer, which is modified (unescaped and null-terminated) in place
+    doc.load_buffer_inplace(data, length, (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
+    m_releaseNodes = true;
+    const bool success = this->ImportDocument(doc);
+    m_releaseNodes = false;
+    return success;
+}
+
+bool MEIInput::ImportDocument(const pugi::xml_document &document)
 {
     try {
         m_doc->Reset();
         m_doc->SetType(Raw);
-        pugi::xml_document doc;
-        doc.load_string(mei.c_str(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
-        pugi::xml_node root = doc.first_child();
+        pugi::xml_node root = document.first_child();
         return this->ReadDoc(root);
     }
     catch (char *str) {
@@ -3369,6 +3501,190 @@ bool MEIInput::Import(const std::string &mei)
     }
 }
 
+bool MEIInput::ImportStream(std::istream &stream)
+{
+    // The measures are read again from the stream when they are built
+    if (stream.tellg() == std::streampos(-1)) {
+        LogError("The MEI stream has to be seekable");
+        return false;
+    }
+
+    std::string skeleton;
+    m_measureChunks.clear();
+    m_streamDeclaration.clear();
+    bool success = this->SplitStream(stream, skeleton);
+
+    if (success) {
+        pugi::xml_document doc;
+        doc.load_buffer_inplace(
+            skeleton.data(), skeleton.size(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
+        stream.clear();
+        m_stream = &stream;
+        m_releaseNodes = true;
+        success = this->ImportDocument(doc);
+        m_releaseNodes = false;
+        m_stream = NULL;
+    }
+
+    m_measureChunks.clear();
+    m_streamDeclaration.clear();
+    return success;
+}
+
+bool MEIInput::SplitStream(std::istream &stream, std::string &skeleton)
+{
+    const std::streamsize blockSize = 1 << 16;
+    std::vector<char> block(blockSize);
+    // The data read and not processed yet starts at pos, and the pending data at offset in the stream
+    std::string pending;
+    size_t pos = 0;
+    std::streamoff offset = stream.tellg();
+
+    auto readBlock = [&]() {
+        if (!stream.good()) return false;
+        pending.erase(0, pos);
+        offset += pos;
+        pos = 0;
+        stream.read(block.data(), blockSize);
+        pending.append(block.data(), (size_t)stream.gcount());
+        return (stream.gcount() > 0);
+    };
+
+    while (true) {
+        const size_t markupStart = pending.find('<', pos);
+        if (markupStart == std::string::npos) {
+            skeleton.append(pending, pos, std::string::npos);
+            pos = pending.size();
+            if (!readBlock()) break;
+            continue;
+        }
+        skeleton.append(pending, pos, markupStart - pos);
+        pos = markupStart;
+
+        const size_t markupEnd = this->FindMarkupEnd(pending, pos);
+        // A measure start tag (not empty) for which we also need the end tag
+        const bool isMeasure
+            = (markupEnd != std::string::npos) && this->IsMeasureStart(pending, pos) && (pending[markupEnd - 2] != '/');
+        const size_t end = (isMeasure) ? this->FindMeasureEnd(pending, markupEnd) : markupEnd;
+
+        if (end == std::string::npos) {
+            if (readBlock()) continue;
+            // Incomplete markup at the end of the data - let the parser report it
+            skeleton.append(pending, pos, std::string::npos);
+            break;
+        }
+
+        if (isMeasure) {
+            // Replace the measure with an empty one pointing to its position in the stream
+            skeleton.append(pending, pos, markupEnd - 1 - pos);
+            skeleton += " " + std::string(MEASURE_CHUNK_ATTR) + "=\"" + StringFormat("%d", (int)m_measureChunks.size())
+                + "\"/>";
+            m_measureChunks.push_back({ offset + (std::streamoff)pos, end - pos });
+        }
+        else {
+            // Keep the XML declaration for parsing the measures with the same encoding
+            if (skeleton.find('<') == std::string::npos && pending.compare(pos, 5, "<?xml") == 0
+                && std::isspace((unsigned char)pending[pos + 5])) {
+                m_streamDeclaration = pending.substr(pos, end - pos);
+            }
+            skeleton.append(pending, pos, end - pos);
+        }
+        pos = end;
+    }
+
+    if (stream.bad()) {
+        LogError("Error reading the MEI stream");
+        return false;
+    }
+    return true;
+}
+
+size_t MEIInput::FindMarkupEnd(const std::string &data, size_t pos) const
+{
+    assert(data.at(pos) == '<');
+
+    size_t end = std::string::npos;
+    if (data.compare(pos, 4, "<!--") == 0) {
+        end = data.find("-->", pos + 4);
+        return (end == std::string::npos) ? end : end + 3;
+    }
+    else if (data.compare(pos, 9, "<![CDATA[") == 0) {
+        end = data.find("]]>", pos + 9);
+        return (end == std::string::npos) ? end : end + 3;
+    }
+    else if (data.compare(pos, 2, "<?") == 0) {
+        end = data.find("?>", pos + 2);
+        return (end == std::string::npos) ? end : end + 2;
+    }
+
+    // Tags and doctype declarations, where '>' can appear in quoted values or in the internal subset
+    char quote = 0;
+    int subsetDepth = 0;
+    for (size_t i = pos + 1; i < data.size(); ++i) {
+        const char c = data[i];
+        if (quote) {
+            if (c == quote) quote = 0;
+        }
+        else if ((c == '"') || (c == '\'')) {
+            quote = c;
+        }
+        else if (c == '[') {
+            ++subsetDepth;
+        }
+        else if ((c == ']') && (subsetDepth > 0)) {
+            --subsetDepth;
+        }
+        else if ((c == '>') && (subsetDepth == 0)) {
+            return i + 1;
+        }
+    }
+    return std::string::npos;
+}
+
+size_t MEIInput::FindMeasureEnd(const std::string &data, size_t pos) const
+{
+    // Measures are not nested, so we only need to skip comments and CDATA sections
+    while (true) {
+        pos = data.find('<', pos);
+        if (pos == std::string::npos) return pos;
+        if ((data.compare(pos, 4, "<!--") == 0) || (data.compare(pos, 9, "<![CDATA[") == 0)) {
+            pos = this->FindMarkupEnd(data, pos);
+            if (pos == std::string::npos) return pos;
+        }
+        else if (this->IsMeasureEnd(data, pos)) {
+            return this->FindMarkupEnd(data, pos);
+        }
+        else {
+            ++pos;
+        }
+    }
+}
+
+bool MEIInput::IsMeasureStart(const std::string &data, size_t pos) const
+{
+    if (data.compare(pos, 8, "<measure") != 0) return false;
+    if (pos + 8 >= data.size()) return false;
+    const char c = data[pos + 8];
+    return (std::isspace((unsigned char)c) || (c == '>') || (c == '/'));
+}
+
+bool MEIInput::IsMeasureEnd(const std::string &data, size_t pos) const
+{
+    // Check the whole tag name, since other elements (e.g., </measureSpan>) start the same way
+    if (data.compare(pos, 9, "</measure") != 0) return false;
+    if (pos + 9 >= data.size()) return false;
+    const char c = data[pos + 9];
+    return (std::isspace((unsigned char)c) || (c == '>'));
+}
+
+void MEIInput::ReleaseNode(pugi::xml_node node)
+{
+    if (!m_releaseNodes) return;
+
+    // Removing the node frees the memory pages of the tree once they are not used anymore
+    node.parent().remove_child(node);
+}
+
 bool MEIInput::IsAllowed(std::string element, Object *filterParent)
 {
     if (!filterParent || (element == "")) {
@@ -4080,8 +4396,7 @@ bool MEIInput::ReadPages(Object *parent, pugi::xml_node pages)
     Pages *vrvPages = new Pages();
     this->SetMeiID(pages, vrvPages);
 
-    vrvPages->ReadLabelled(pages);
-    vrvPages->ReadNNumberLike(pages);
+    this->ReadAttClasses<AttLabelled, AttNNumberLike>(pages, vrvPages);
 
     parent->AddChild(vrvPages);
 
@@ -4263,8 +4578,7 @@ bool MEIInput::ReadMdiv(Object *parent, pugi::xml_node mdiv, bool isVisible)
     Mdiv *vrvMdiv = new Mdiv();
     this->SetMeiID(mdiv, vrvMdiv);
 
-    vrvMdiv->ReadLabelled(mdiv);
-    vrvMdiv->ReadNNumberLike(mdiv);
+    this->ReadAttClasses<AttLabelled, AttNNumberLike>(mdiv, vrvMdiv);
 
     parent->AddChild(vrvMdiv);
 
@@ -4323,8 +4637,7 @@ bool MEIInput::ReadScore(Object *parent, pugi::xml_node score)
     Score *vrvScore = new Score();
     this->SetMeiID(score, vrvScore);
 
-    vrvScore->ReadLabelled(score);
-    vrvScore->ReadNNumberLike(score);
+    this->ReadAttClasses<AttLabelled, AttNNumberLike>(score, vrvScore);
 
     parent->AddChild(vrvScore);
 
@@ -4378,13 +4691,41 @@ bool MEIInput::ReadScore(Object *parent, pugi::xml_node score)
     return success;
 }
 
+bool MEIInput::ReadMeasureChunk(Object *parent, pugi::xml_node measure)
+{
+    const int idx = measure.attribute(MEASURE_CHUNK_ATTR).as_int(-1);
+    if (!m_stream || (idx < 0) || (idx >= (int)m_measureChunks.size())) {
+        LogError("Invalid measure content in the MEI stream");
+        return false;
+    }
+
+    // Read the measure back from the stream, preceded by the declaration of the document for its encoding
+    const auto [chunkOffset, chunkLength] = m_measureChunks.at(idx);
+    std::string chunk = m_streamDeclaration;
+    const size_t chunkStart = chunk.size();
+    chunk.resize(chunkStart + chunkLength);
+    m_stream->seekg(chunkOffset);
+    m_stream->read(&chunk[chunkStart], chunkLength);
+    if ((size_t)m_stream->gcount() != chunkLength) {
+        LogError("Error reading the MEI stream");
+        m_stream->clear();
+        return false;
+    }
+
+    pugi::xml_document chunkDoc;
+    chunkDoc.load_buffer_inplace(
+        chunk.data(), chunk.size(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
+    pugi::xml_node chunkMeasure = chunkDoc.child("measure");
+    this->NormalizeAttributes(chunkMeasure);
+    return this->ReadMeasure(parent, chunkMeasure);
+}
+
 bool MEIInput::ReadSection(Object *parent, pugi::xml_node section)
 {
     Section *vrvSection = new Section();
     this->SetMeiID(section, vrvSection);
 
-    vrvSection->ReadNNumberLike(section);
-    vrvSection->ReadSectionVis(section);
+    this->ReadAttClasses<AttNNumberLike, AttSectionVis>(section, vrvSection);
 
     parent->AddChild(vrvSection);
     this->ReadUnsupportedAttr(section, vrvSection);
@@ -4404,9 +4745,12 @@ bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
 
     bool success = true;
     pugi::xml_node current;
+    pugi::xml_node next;
     Measure *unmeasured = NULL;
-    for (current = parentNode.first_child(); current; current = current.next_sibling()) {
+    // The next sibling is kept since the current node can be released once read
+    for (current = parentNode.first_child(); current; current = next) {
         if (!success) break;
+        next = current.next_sibling();
         this->NormalizeAttributes(current);
         // editorial
         if (this->IsEditorialElementName(current.name())) {
@@ -4429,6 +4773,7 @@ bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
         }
         else if (std::string(current.name()) == "section") {
             success = this->ReadSection(parent, current);
+            this->ReleaseNode(current);
         }
         // pb and sb
         else if (std::string(current.name()) == "pb") {
@@ -4459,6 +4804,7 @@ bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
             //    m_hasMeasureWithinEditMarkup = true;
             //}
             success = this->ReadMeasure(parent, current);
+            this->ReleaseNode(current);
         }
         // xml comment
         else if (std::string(current.name()) == "") {
@@ -4484,10 +4830,7 @@ bool MEIInput::ReadEnding(Object *parent, pugi::xml_node ending)
     Ending *vrvEnding = new Ending();
     this->ReadSystemElement(ending, vrvEnding);
 
-    vrvEnding->ReadLabelled(ending);
-    vrvEnding->ReadLineRend(ending);
-    vrvEnding->ReadLineRendBase(ending);
-    vrvEnding->ReadNNumberLike(ending);
+    this->ReadAttClasses<AttLabelled, AttLineRend, AttLineRendBase, AttNNumberLike>(ending, vrvEnding);
 
     parent->AddChild(vrvEnding);
     this->ReadUnsupportedAttr(ending, vrvEnding);
@@ -4575,9 +4918,12 @@ bool MEIInput::ReadSystemChildren(Object *parent, pugi::xml_node parentNode)
 
     bool success = true;
     pugi::xml_node current;
+    pugi::xml_node next;
     Measure *unmeasured = NULL;
-    for (current = parentNode.first_child(); current; current = current.next_sibling()) {
+    // The next sibling is kept since the current node can be released once read
+    for (current = parentNode.first_child(); current; current = next) {
         if (!success) break;
+        next = current.next_sibling();
         this->NormalizeAttributes(current);
         // editorial
         if (this->IsEditorialElementName(current.name())) {
@@ -4624,6 +4970,7 @@ bool MEIInput::ReadSystemChildren(Object *parent, pugi::xml_node parentNode)
             // we should not mix measured and unmeasured music within a system...
             assert(!unmeasured);
             success = this->ReadMeasure(parent, current);
+            this->ReleaseNode(current);
         }
         // xml comment
         else if (std::string(current.name()) == "") {
@@ -4672,10 +5019,7 @@ bool MEIInput::ReadSystemMilestoneEnd(Object *parent, pugi::xml_node milestoneEn
 bool MEIInput::ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *object)
 {
     this->SetMeiID(element, object);
-    object->ReadMeasureNumbers(element);
-    object->ReadSpacing(element);
-    object->ReadSystems(element);
-    object->ReadTyped(element);
+    this->ReadAttClasses<AttMeasureNumbers, AttSpacing, AttSystems, AttTyped>(element, object);
 
     if (m_meiversion <= meiVersion_MEIVERSION_5_0_0_dev) {
         UpgradeScoreDefElementTo_5_0_0(element);
@@ -4800,11 +5144,7 @@ bool MEIInput::ReadScoreDef(Object *parent, pugi::xml_node scoreDef)
     }
 
     this->ReadScoreDefInterface(scoreDef, vrvScoreDef);
-    vrvScoreDef->ReadDistances(scoreDef);
-    vrvScoreDef->ReadEndings(scoreDef);
-    vrvScoreDef->ReadOptimization(scoreDef);
-    vrvScoreDef->ReadTimeBase(scoreDef);
-    vrvScoreDef->ReadTuning(scoreDef);
+    this->ReadAttClasses<AttDistances, AttEndings, AttOptimization, AttTimeBase, AttTuning>(scoreDef, vrvScoreDef);
 
     this->ReadUnsupportedAttr(scoreDef, vrvScoreDef);
     return this->ReadScoreDefChildren(vrvScoreDef, scoreDef);
@@ -4897,10 +5237,7 @@ bool MEIInput::ReadStaffGrp(Object *parent, pugi::xml_node staffGrp)
         UpgradeStaffGrpTo_4_0_0(staffGrp, vrvStaffGrp);
     }
 
-    vrvStaffGrp->ReadBarring(staffGrp);
-    vrvStaffGrp->ReadBasic(staffGrp);
-    vrvStaffGrp->ReadLabelled(staffGrp);
-    vrvStaffGrp->ReadNNumberLike(staffGrp);
+    this->ReadAttClasses<AttBarring, AttBasic, AttLabelled, AttNNumberLike>(staffGrp, vrvStaffGrp);
     InstStaffGroupingSym groupingSym;
     groupingSym.ReadStaffGroupingSym(staffGrp);
     if (groupingSym.HasSymbol()) {
@@ -4909,8 +5246,7 @@ bool MEIInput::ReadStaffGrp(Object *parent, pugi::xml_node staffGrp)
         vrvGrpSym->SetSymbol(groupingSym.GetSymbol());
         vrvStaffGrp->AddChild(vrvGrpSym);
     }
-    vrvStaffGrp->ReadStaffGrpVis(staffGrp);
-    vrvStaffGrp->ReadTyped(staffGrp);
+    this->ReadAttClasses<AttStaffGrpVis, AttTyped>(staffGrp, vrvStaffGrp);
 
     parent->AddChild(vrvStaffGrp);
     this->ReadUnsupportedAttr(staffGrp, vrvStaffGrp);
@@ -4991,11 +5327,7 @@ bool MEIInput::ReadGrpSym(Object *parent, pugi::xml_node grpSym)
     GrpSym *vrvGrpSym = new GrpSym();
     this->SetMeiID(grpSym, vrvGrpSym);
 
-    vrvGrpSym->ReadColor(grpSym);
-    vrvGrpSym->ReadGrpSymLog(grpSym);
-    vrvGrpSym->ReadStaffGroupingSym(grpSym);
-    vrvGrpSym->ReadStartId(grpSym);
-    vrvGrpSym->ReadStartEndId(grpSym);
+    this->ReadAttClasses<AttColor, AttGrpSymLog, AttStaffGroupingSym, AttStartId, AttStartEndId>(grpSym, vrvGrpSym);
 
     if (parent->Is(SCOREDEF)) {
         if (!vrvGrpSym->HasLevel() || !vrvGrpSym->HasStartid() || !vrvGrpSym->HasEndid()) {
@@ -5093,15 +5425,8 @@ bool MEIInput::ReadStaffDef(Object *parent, pugi::xml_node staffDef)
         UpgradeStaffDefTo_4_0_0(staffDef, vrvStaffDef);
     }
 
-    vrvStaffDef->ReadDistances(staffDef);
-    vrvStaffDef->ReadLabelled(staffDef);
-    vrvStaffDef->ReadNInteger(staffDef);
-    vrvStaffDef->ReadNotationType(staffDef);
-    vrvStaffDef->ReadScalable(staffDef);
-    vrvStaffDef->ReadStaffDefLog(staffDef);
-    vrvStaffDef->ReadStaffDefVis(staffDef);
-    vrvStaffDef->ReadTimeBase(staffDef);
-    vrvStaffDef->ReadTransposition(staffDef);
+    this->ReadAttClasses<AttDistances, AttLabelled, AttNInteger, AttNotationType, AttScalable, AttStaffDefLog,
+        AttStaffDefVis, AttTimeBase, AttTransposition>(staffDef, vrvStaffDef);
 
     if (!vrvStaffDef->HasN()) {
         LogWarning("No @n on <staffDef> might yield unpredictable results");
@@ -5208,10 +5533,7 @@ bool MEIInput::ReadCourse(Object *parent, pugi::xml_node course)
     this->SetMeiID(course, vrvCourse);
 
     parent->AddChild(vrvCourse);
-    vrvCourse->ReadAccidental(course);
-    vrvCourse->ReadNNumberLike(course);
-    vrvCourse->ReadOctave(course);
-    vrvCourse->ReadPitch(course);
+    this->ReadAttClasses<AttAccidental, AttNNumberLike, AttOctave, AttPitch>(course, vrvCourse);
 
     this->ReadUnsupportedAttr(course, vrvCourse);
 
@@ -5260,10 +5582,7 @@ bool MEIInput::ReadInstrDef(Object *parent, pugi::xml_node instrDef)
     }
 
     parent->AddChild(vrvInstrDef);
-    vrvInstrDef->ReadChannelized(instrDef);
-    vrvInstrDef->ReadLabelled(instrDef);
-    vrvInstrDef->ReadMidiInstrument(instrDef);
-    vrvInstrDef->ReadNNumberLike(instrDef);
+    this->ReadAttClasses<AttChannelized, AttLabelled, AttMidiInstrument, AttNNumberLike>(instrDef, vrvInstrDef);
 
     return true;
 }
@@ -5293,9 +5612,7 @@ bool MEIInput::ReadLayerDef(Object *parent, pugi::xml_node layerDef)
     LayerDef *vrvLayerDef = new LayerDef();
     this->SetMeiID(layerDef, vrvLayerDef);
 
-    vrvLayerDef->ReadLabelled(layerDef);
-    vrvLayerDef->ReadNInteger(layerDef);
-    vrvLayerDef->ReadTyped(layerDef);
+    this->ReadAttClasses<AttLabelled, AttNInteger, AttTyped>(layerDef, vrvLayerDef);
 
     parent->AddChild(vrvLayerDef);
     this->ReadUnsupportedAttr(layerDef, vrvLayerDef);
@@ -5333,6 +5650,11 @@ bool MEIInput::ReadLayerDefChildren(Object *parent, pugi::xml_node parentNode)
 
 bool MEIInput::ReadMeasure(Object *parent, pugi::xml_node measure)
 {
+    // Measures split from a stream are parsed only now
+    if (measure.attribute(MEASURE_CHUNK_ATTR)) {
+        return this->ReadMeasureChunk(parent, measure);
+    }
+
     Measure *vrvMeasure = new Measure();
     if (m_doc->IsMensuralMusicOnly()) {
         LogWarning("Mixing mensural and non mensural music is not supported. Trying to go ahead...");
@@ -5340,20 +5662,15 @@ bool MEIInput::ReadMeasure(Object *parent, pugi::xml_node measure)
     }
     this->SetMeiID(measure, vrvMeasure);
 
-    vrvMeasure->ReadBarring(measure);
-    vrvMeasure->ReadMeasureLog(measure);
-    vrvMeasure->ReadMeterConformanceBar(measure);
-    vrvMeasure->ReadNNumberLike(measure);
-    vrvMeasure->ReadPointing(measure);
-    vrvMeasure->ReadTyped(measure);
+    this->ReadAttClasses<AttBarring, AttMeasureLog, AttMeterConformanceBar, AttNNumberLike, AttPointing, AttTyped
+        >(measure, vrvMeasure);
 
     if ((m_doc->GetType() == Transcription) && (m_meiversion == meiVersion_MEIVERSION_2013)) {
         UpgradeMeasureTo_5_0_0(measure);
     }
 
     if (measure.attribute("coord.x1") && measure.attribute("coord.x2") && (m_doc->GetType() == Transcription)) {
-        vrvMeasure->ReadCoordX1(measure);
-        vrvMeasure->ReadCoordX2(measure);
+        this->ReadAttClasses<AttCoordX1, AttCoordX2>(measure, vrvMeasure);
         vrvMeasure->m_xAbs = vrvMeasure->GetCoordX1() * DEFINITION_FACTOR;
         vrvMeasure->m_xAbs2 = vrvMeasure->GetCoordX2() * DEFINITION_FACTOR;
     }
@@ -5488,8 +5805,7 @@ bool MEIInput::ReadMeterSigGrp(Object *parent, pugi::xml_node meterSigGrp)
     MeterSigGrp *vrvMeterSigGrp = new MeterSigGrp();
     this->SetMeiID(meterSigGrp, vrvMeterSigGrp);
     this->ReadLayerElement(meterSigGrp, vrvMeterSigGrp);
-    vrvMeterSigGrp->ReadBasic(meterSigGrp);
-    vrvMeterSigGrp->ReadMeterSigGrpLog(meterSigGrp);
+    this->ReadAttClasses<AttBasic, AttMeterSigGrpLog>(meterSigGrp, vrvMeterSigGrp);
 
     parent->AddChild(vrvMeterSigGrp);
     this->ReadUnsupportedAttr(meterSigGrp, vrvMeterSigGrp);
@@ -5524,8 +5840,7 @@ bool MEIInput::ReadControlElement(pugi::xml_node element, ControlElement *object
     this->SetMeiID(element, object);
     this->ReadAltSymInterface(element, object);
     this->ReadLinkingInterface(element, object);
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    this->ReadAttClasses<AttLabelled, AttTyped>(element, object);
 
     return true;
 }
@@ -5549,10 +5864,7 @@ bool MEIInput::ReadArpeg(Object *parent, pugi::xml_node arpeg)
 
     this->ReadPlistInterface(arpeg, vrvArpeg);
     this->ReadTimePointInterface(arpeg, vrvArpeg);
-    vrvArpeg->ReadArpegLog(arpeg);
-    vrvArpeg->ReadArpegVis(arpeg);
-    vrvArpeg->ReadColor(arpeg);
-    vrvArpeg->ReadEnclosingChars(arpeg);
+    this->ReadAttClasses<AttArpegLog, AttArpegVis, AttColor, AttEnclosingChars>(arpeg, vrvArpeg);
 
     parent->AddChild(vrvArpeg);
     this->ReadUnsupportedAttr(arpeg, vrvArpeg);
@@ -5566,9 +5878,7 @@ bool MEIInput::ReadBeamSpan(Object *parent, pugi::xml_node beamSpan)
 
     this->ReadPlistInterface(beamSpan, vrvBeamSpan);
     this->ReadTimeSpanningInterface(beamSpan, vrvBeamSpan);
-    vrvBeamSpan->ReadBeamedWith(beamSpan);
-    vrvBeamSpan->ReadBeamRend(beamSpan);
-    vrvBeamSpan->ReadColor(beamSpan);
+    this->ReadAttClasses<AttBeamedWith, AttBeamRend, AttColor>(beamSpan, vrvBeamSpan);
 
     parent->AddChild(vrvBeamSpan);
     this->ReadUnsupportedAttr(beamSpan, vrvBeamSpan);
@@ -5581,10 +5891,7 @@ bool MEIInput::ReadBracketSpan(Object *parent, pugi::xml_node bracketSpan)
     this->ReadControlElement(bracketSpan, vrvBracketSpan);
 
     this->ReadTimeSpanningInterface(bracketSpan, vrvBracketSpan);
-    vrvBracketSpan->ReadBracketSpanLog(bracketSpan);
-    vrvBracketSpan->ReadColor(bracketSpan);
-    vrvBracketSpan->ReadLineRend(bracketSpan);
-    vrvBracketSpan->ReadLineRendBase(bracketSpan);
+    this->ReadAttClasses<AttBracketSpanLog, AttColor, AttLineRend, AttLineRendBase>(bracketSpan, vrvBracketSpan);
 
     parent->AddChild(vrvBracketSpan);
     this->ReadUnsupportedAttr(bracketSpan, vrvBracketSpan);
@@ -5597,8 +5904,7 @@ bool MEIInput::ReadBreath(Object *parent, pugi::xml_node breath)
     this->ReadControlElement(breath, vrvBreath);
 
     this->ReadTimePointInterface(breath, vrvBreath);
-    vrvBreath->ReadColor(breath);
-    vrvBreath->ReadPlacementRelStaff(breath);
+    this->ReadAttClasses<AttColor, AttPlacementRelStaff>(breath, vrvBreath);
 
     parent->AddChild(vrvBreath);
     this->ReadUnsupportedAttr(breath, vrvBreath);
@@ -5611,10 +5917,7 @@ bool MEIInput::ReadCaesura(Object *parent, pugi::xml_node caesura)
     this->ReadControlElement(caesura, vrvCaesura);
 
     this->ReadTimePointInterface(caesura, vrvCaesura);
-    vrvCaesura->ReadColor(caesura);
-    vrvCaesura->ReadExtSymAuth(caesura);
-    vrvCaesura->ReadExtSymNames(caesura);
-    vrvCaesura->ReadPlacementRelStaff(caesura);
+    this->ReadAttClasses<AttColor, AttExtSymAuth, AttExtSymNames, AttPlacementRelStaff>(caesura, vrvCaesura);
 
     parent->AddChild(vrvCaesura);
     this->ReadUnsupportedAttr(caesura, vrvCaesura);
@@ -5628,10 +5931,7 @@ bool MEIInput::ReadDir(Object *parent, pugi::xml_node dir)
 
     this->ReadTextDirInterface(dir, vrvDir);
     this->ReadTimeSpanningInterface(dir, vrvDir);
-    vrvDir->ReadLang(dir);
-    vrvDir->ReadLineRendBase(dir);
-    vrvDir->ReadExtender(dir);
-    vrvDir->ReadVerticalGroup(dir);
+    this->ReadAttClasses<AttLang, AttLineRendBase, AttExtender, AttVerticalGroup>(dir, vrvDir);
 
     parent->AddChild(vrvDir);
     this->ReadUnsupportedAttr(dir, vrvDir);
@@ -5645,12 +5945,8 @@ bool MEIInput::ReadDynam(Object *parent, pugi::xml_node dynam)
 
     this->ReadTextDirInterface(dynam, vrvDynam);
     this->ReadTimeSpanningInterface(dynam, vrvDynam);
-    vrvDynam->ReadEnclosingChars(dynam);
-    vrvDynam->ReadExtender(dynam);
-    vrvDynam->ReadLineRendBase(dynam);
-    vrvDynam->ReadMidiValue(dynam);
-    vrvDynam->ReadMidiValue2(dynam);
-    vrvDynam->ReadVerticalGroup(dynam);
+    this->ReadAttClasses<AttEnclosingChars, AttExtender, AttLineRendBase, AttMidiValue, AttMidiValue2, AttVerticalGroup
+        >(dynam, vrvDynam);
 
     parent->AddChild(vrvDynam);
     this->ReadUnsupportedAttr(dynam, vrvDynam);
@@ -5663,12 +5959,8 @@ bool MEIInput::ReadFermata(Object *parent, pugi::xml_node fermata)
     this->ReadControlElement(fermata, vrvFermata);
 
     this->ReadTimePointInterface(fermata, vrvFermata);
-    vrvFermata->ReadColor(fermata);
-    vrvFermata->ReadEnclosingChars(fermata);
-    vrvFermata->ReadExtSymAuth(fermata);
-    vrvFermata->ReadExtSymNames(fermata);
-    vrvFermata->ReadFermataVis(fermata);
-    vrvFermata->ReadPlacementRelStaff(fermata);
+    this->ReadAttClasses<AttColor, AttEnclosingChars, AttExtSymAuth, AttExtSymNames, AttFermataVis, AttPlacementRelStaff
+        >(fermata, vrvFermata);
 
     parent->AddChild(vrvFermata);
     this->ReadUnsupportedAttr(fermata, vrvFermata);
@@ -5695,10 +5987,7 @@ bool MEIInput::ReadGliss(Object *parent, pugi::xml_node gliss)
     this->ReadControlElement(gliss, vrvGliss);
 
     this->ReadTimeSpanningInterface(gliss, vrvGliss);
-    vrvGliss->ReadColor(gliss);
-    vrvGliss->ReadLineRend(gliss);
-    vrvGliss->ReadLineRendBase(gliss);
-    vrvGliss->ReadNNumberLike(gliss);
+    this->ReadAttClasses<AttColor, AttLineRend, AttLineRendBase, AttNNumberLike>(gliss, vrvGliss);
 
     parent->AddChild(vrvGliss);
     this->ReadUnsupportedAttr(gliss, vrvGliss);
@@ -5711,12 +6000,8 @@ bool MEIInput::ReadHairpin(Object *parent, pugi::xml_node hairpin)
     this->ReadControlElement(hairpin, vrvHairpin);
 
     this->ReadTimeSpanningInterface(hairpin, vrvHairpin);
-    vrvHairpin->ReadColor(hairpin);
-    vrvHairpin->ReadHairpinLog(hairpin);
-    vrvHairpin->ReadHairpinVis(hairpin);
-    vrvHairpin->ReadLineRendBase(hairpin);
-    vrvHairpin->ReadPlacementRelStaff(hairpin);
-    vrvHairpin->ReadVerticalGroup(hairpin);
+    this->ReadAttClasses<AttColor, AttHairpinLog, AttHairpinVis, AttLineRendBase, AttPlacementRelStaff, AttVerticalGroup
+        >(hairpin, vrvHairpin);
 
     parent->AddChild(vrvHairpin);
     this->ReadUnsupportedAttr(hairpin, vrvHairpin);
@@ -5730,8 +6015,7 @@ bool MEIInput::ReadHarm(Object *parent, pugi::xml_node harm)
 
     this->ReadTextDirInterface(harm, vrvHarm);
     this->ReadTimeSpanningInterface(harm, vrvHarm);
-    vrvHarm->ReadLang(harm);
-    vrvHarm->ReadNNumberLike(harm);
+    this->ReadAttClasses<AttLang, AttNNumberLike>(harm, vrvHarm);
 
     parent->AddChild(vrvHarm);
     this->ReadUnsupportedAttr(harm, vrvHarm);
@@ -5744,9 +6028,7 @@ bool MEIInput::ReadLv(Object *parent, pugi::xml_node lv)
     this->ReadControlElement(lv, vrvLv);
 
     this->ReadTimeSpanningInterface(lv, vrvLv);
-    vrvLv->ReadColor(lv);
-    vrvLv->ReadCurvature(lv);
-    vrvLv->ReadLineRendBase(lv);
+    this->ReadAttClasses<AttColor, AttCurvature, AttLineRendBase>(lv, vrvLv);
 
     parent->AddChild(vrvLv);
     this->ReadUnsupportedAttr(lv, vrvLv);
@@ -5760,9 +6042,7 @@ bool MEIInput::ReadMNum(Object *parent, pugi::xml_node mNum)
 
     this->ReadTextDirInterface(mNum, vrvMNum);
     this->ReadTimePointInterface(mNum, vrvMNum);
-    vrvMNum->ReadColor(mNum);
-    vrvMNum->ReadLang(mNum);
-    vrvMNum->ReadTypography(mNum);
+    this->ReadAttClasses<AttColor, AttLang, AttTypography>(mNum, vrvMNum);
 
     parent->AddChild(vrvMNum);
     return this->ReadTextChildren(vrvMNum, mNum, vrvMNum);
@@ -5778,12 +6058,8 @@ bool MEIInput::ReadMordent(Object *parent, pugi::xml_node mordent)
     }
 
     this->ReadTimePointInterface(mordent, vrvMordent);
-    vrvMordent->ReadColor(mordent);
-    vrvMordent->ReadExtSymAuth(mordent);
-    vrvMordent->ReadExtSymNames(mordent);
-    vrvMordent->ReadOrnamentAccid(mordent);
-    vrvMordent->ReadPlacementRelStaff(mordent);
-    vrvMordent->ReadMordentLog(mordent);
+    this->ReadAttClasses<AttColor, AttExtSymAuth, AttExtSymNames, AttOrnamentAccid, AttPlacementRelStaff, AttMordentLog
+        >(mordent, vrvMordent);
 
     parent->AddChild(vrvMordent);
     this->ReadUnsupportedAttr(mordent, vrvMordent);
@@ -5796,12 +6072,8 @@ bool MEIInput::ReadOctave(Object *parent, pugi::xml_node octave)
     this->ReadControlElement(octave, vrvOctave);
 
     this->ReadTimeSpanningInterface(octave, vrvOctave);
-    vrvOctave->ReadColor(octave);
-    vrvOctave->ReadExtender(octave);
-    vrvOctave->ReadLineRend(octave);
-    vrvOctave->ReadLineRendBase(octave);
-    vrvOctave->ReadNNumberLike(octave);
-    vrvOctave->ReadOctaveDisplacement(octave);
+    this->ReadAttClasses<AttColor, AttExtender, AttLineRend, AttLineRendBase, AttNNumberLike, AttOctaveDisplacement
+        >(octave, vrvOctave);
 
     parent->AddChild(vrvOctave);
     this->ReadUnsupportedAttr(octave, vrvOctave);
@@ -5815,10 +6087,7 @@ bool MEIInput::ReadOrnam(Object *parent, pugi::xml_node ornam)
 
     this->ReadTextDirInterface(ornam, vrvOrnam);
     this->ReadTimePointInterface(ornam, vrvOrnam);
-    vrvOrnam->ReadColor(ornam);
-    vrvOrnam->ReadExtSymAuth(ornam);
-    vrvOrnam->ReadExtSymNames(ornam);
-    vrvOrnam->ReadOrnamentAccid(ornam);
+    this->ReadAttClasses<AttColor, AttExtSymAuth, AttExtSymNames, AttOrnamentAccid>(ornam, vrvOrnam);
 
     parent->AddChild(vrvOrnam);
     this->ReadUnsupportedAttr(ornam, vrvOrnam);
@@ -5831,13 +6100,8 @@ bool MEIInput::ReadPedal(Object *parent, pugi::xml_node pedal)
     this->ReadControlElement(pedal, vrvPedal);
 
     this->ReadTimeSpanningInterface(pedal, vrvPedal);
-    vrvPedal->ReadColor(pedal);
-    vrvPedal->ReadExtSymAuth(pedal);
-    vrvPedal->ReadExtSymNames(pedal);
-    vrvPedal->ReadPedalLog(pedal);
-    vrvPedal->ReadPedalVis(pedal);
-    vrvPedal->ReadPlacementRelStaff(pedal);
-    vrvPedal->ReadVerticalGroup(pedal);
+    this->ReadAttClasses<AttColor, AttExtSymAuth, AttExtSymNames, AttPedalLog, AttPedalVis, AttPlacementRelStaff,
+        AttVerticalGroup>(pedal, vrvPedal);
 
     parent->AddChild(vrvPedal);
     this->ReadUnsupportedAttr(pedal, vrvPedal);
@@ -5850,10 +6114,7 @@ bool MEIInput::ReadPhrase(Object *parent, pugi::xml_node phrase)
     this->ReadControlElement(phrase, vrvPhrase);
 
     this->ReadTimeSpanningInterface(phrase, vrvPhrase);
-    vrvPhrase->ReadColor(phrase);
-    vrvPhrase->ReadCurvature(phrase);
-    vrvPhrase->ReadLayerIdent(phrase);
-    vrvPhrase->ReadLineRendBase(phrase);
+    this->ReadAttClasses<AttColor, AttCurvature, AttLayerIdent, AttLineRendBase>(phrase, vrvPhrase);
 
     parent->AddChild(vrvPhrase);
     this->ReadUnsupportedAttr(phrase, vrvPhrase);
@@ -5879,9 +6140,7 @@ bool MEIInput::ReadReh(Object *parent, pugi::xml_node reh)
 
     this->ReadTextDirInterface(reh, vrvReh);
     this->ReadTimePointInterface(reh, vrvReh);
-    vrvReh->ReadColor(reh);
-    vrvReh->ReadLang(reh);
-    vrvReh->ReadVerticalGroup(reh);
+    this->ReadAttClasses<AttColor, AttLang, AttVerticalGroup>(reh, vrvReh);
 
     parent->AddChild(vrvReh);
     this->ReadUnsupportedAttr(reh, vrvReh);
@@ -5895,10 +6154,7 @@ bool MEIInput::ReadRepeatMark(Object *parent, pugi::xml_node repeatMark)
 
     this->ReadTextDirInterface(repeatMark, vrvRepeatMark);
     this->ReadTimePointInterface(repeatMark, vrvRepeatMark);
-    vrvRepeatMark->ReadColor(repeatMark);
-    vrvRepeatMark->ReadExtSymAuth(repeatMark);
-    vrvRepeatMark->ReadExtSymNames(repeatMark);
-    vrvRepeatMark->ReadRepeatMarkLog(repeatMark);
+    this->ReadAttClasses<AttColor, AttExtSymAuth, AttExtSymNames, AttRepeatMarkLog>(repeatMark, vrvRepeatMark);
 
     parent->AddChild(vrvRepeatMark);
     this->ReadUnsupportedAttr(repeatMark, vrvRepeatMark);
@@ -5911,10 +6167,7 @@ bool MEIInput::ReadSlur(Object *parent, pugi::xml_node slur)
     this->ReadControlElement(slur, vrvSlur);
 
     this->ReadTimeSpanningInterface(slur, vrvSlur);
-    vrvSlur->ReadColor(slur);
-    vrvSlur->ReadCurvature(slur);
-    vrvSlur->ReadLayerIdent(slur);
-    vrvSlur->ReadLineRendBase(slur);
+    this->ReadAttClasses<AttColor, AttCurvature, AttLayerIdent, AttLineRendBase>(slur, vrvSlur);
 
     parent->AddChild(vrvSlur);
     this->ReadUnsupportedAttr(slur, vrvSlur);
@@ -5928,10 +6181,7 @@ bool MEIInput::ReadTempo(Object *parent, pugi::xml_node tempo)
 
     this->ReadTextDirInterface(tempo, vrvTempo);
     this->ReadTimeSpanningInterface(tempo, vrvTempo);
-    vrvTempo->ReadExtender(tempo);
-    vrvTempo->ReadLang(tempo);
-    vrvTempo->ReadMidiTempo(tempo);
-    vrvTempo->ReadMmTempo(tempo);
+    this->ReadAttClasses<AttExtender, AttLang, AttMidiTempo, AttMmTempo>(tempo, vrvTempo);
 
     parent->AddChild(vrvTempo);
     this->ReadUnsupportedAttr(tempo, vrvTempo);
@@ -5944,9 +6194,7 @@ bool MEIInput::ReadTie(Object *parent, pugi::xml_node tie)
     this->ReadControlElement(tie, vrvTie);
 
     this->ReadTimeSpanningInterface(tie, vrvTie);
-    vrvTie->ReadColor(tie);
-    vrvTie->ReadCurvature(tie);
-    vrvTie->ReadLineRendBase(tie);
+    this->ReadAttClasses<AttColor, AttCurvature, AttLineRendBase>(tie, vrvTie);
 
     parent->AddChild(vrvTie);
     this->ReadUnsupportedAttr(tie, vrvTie);
@@ -5959,14 +6207,8 @@ bool MEIInput::ReadTrill(Object *parent, pugi::xml_node trill)
     this->ReadControlElement(trill, vrvTrill);
 
     this->ReadTimeSpanningInterface(trill, vrvTrill);
-    vrvTrill->ReadColor(trill);
-    vrvTrill->ReadExtender(trill);
-    vrvTrill->ReadExtSymAuth(trill);
-    vrvTrill->ReadExtSymNames(trill);
-    vrvTrill->ReadLineRend(trill);
-    vrvTrill->ReadNNumberLike(trill);
-    vrvTrill->ReadOrnamentAccid(trill);
-    vrvTrill->ReadPlacementRelStaff(trill);
+    this->ReadAttClasses<AttColor, AttExtender, AttExtSymAuth, AttExtSymNames, AttLineRend, AttNNumberLike,
+        AttOrnamentAccid, AttPlacementRelStaff>(trill, vrvTrill);
 
     parent->AddChild(vrvTrill);
     this->ReadUnsupportedAttr(trill, vrvTrill);
@@ -5983,12 +6225,8 @@ bool MEIInput::ReadTurn(Object *parent, pugi::xml_node turn)
     }
 
     this->ReadTimePointInterface(turn, vrvTurn);
-    vrvTurn->ReadColor(turn);
-    vrvTurn->ReadExtSymAuth(turn);
-    vrvTurn->ReadExtSymNames(turn);
-    vrvTurn->ReadOrnamentAccid(turn);
-    vrvTurn->ReadPlacementRelStaff(turn);
-    vrvTurn->ReadTurnLog(turn);
+    this->ReadAttClasses<AttColor, AttExtSymAuth, AttExtSymNames, AttOrnamentAccid, AttPlacementRelStaff, AttTurnLog
+        >(turn, vrvTurn);
 
     parent->AddChild(vrvTurn);
     this->ReadUnsupportedAttr(turn, vrvTurn);
@@ -6038,10 +6276,7 @@ bool MEIInput::ReadStaff(Object *parent, pugi::xml_node staff)
     Staff *vrvStaff = new Staff();
     this->SetMeiID(staff, vrvStaff);
 
-    vrvStaff->ReadFacsimile(staff);
-    vrvStaff->ReadNInteger(staff);
-    vrvStaff->ReadTyped(staff);
-    vrvStaff->ReadVisibility(staff);
+    this->ReadAttClasses<AttFacsimile, AttNInteger, AttTyped, AttVisibility>(staff, vrvStaff);
 
     if ((m_doc->GetType() == Transcription) && (m_meiversion == meiVersion_MEIVERSION_2013)) {
         UpgradeStaffTo_5_0_0(staff);
@@ -6094,10 +6329,7 @@ bool MEIInput::ReadLayer(Object *parent, pugi::xml_node layer)
     Layer *vrvLayer = new Layer();
     this->SetMeiID(layer, vrvLayer);
 
-    vrvLayer->ReadCue(layer);
-    vrvLayer->ReadNInteger(layer);
-    vrvLayer->ReadTyped(layer);
-    vrvLayer->ReadVisibility(layer);
+    this->ReadAttClasses<AttCue, AttNInteger, AttTyped, AttVisibility>(layer, vrvLayer);
 
     if (!vrvLayer->HasN()) {
         LogWarning("Missing @n on <layer>, filled by order");
@@ -6279,8 +6511,7 @@ bool MEIInput::ReadLayerElement(pugi::xml_node element, LayerElement *object)
 {
     this->SetMeiID(element, object);
     this->ReadLinkingInterface(element, object);
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    this->ReadAttClasses<AttLabelled, AttTyped>(element, object);
 
     if ((m_doc->GetType() == Transcription) && (m_meiversion == meiVersion_MEIVERSION_2013)) {
         UpgradeLayerElementTo_5_0_0(element);
@@ -6301,15 +6532,8 @@ bool MEIInput::ReadAccid(Object *parent, pugi::xml_node accid)
 
     ReadPositionInterface(accid, vrvAccid);
     ReadFacsimileInterface(accid, vrvAccid);
-    vrvAccid->ReadAccidental(accid);
-    vrvAccid->ReadAccidentalGes(accid);
-    vrvAccid->ReadAccidLog(accid);
-    vrvAccid->ReadColor(accid);
-    vrvAccid->ReadEnclosingChars(accid);
-    vrvAccid->ReadExtSymAuth(accid);
-    vrvAccid->ReadExtSymNames(accid);
-    vrvAccid->ReadPlacementOnStaff(accid);
-    vrvAccid->ReadPlacementRelEvent(accid);
+    this->ReadAttClasses<AttAccidental, AttAccidentalGes, AttAccidLog, AttColor, AttEnclosingChars, AttExtSymAuth,
+        AttExtSymNames, AttPlacementOnStaff, AttPlacementRelEvent>(accid, vrvAccid);
 
     parent->AddChild(vrvAccid);
     this->ReadUnsupportedAttr(accid, vrvAccid);
@@ -6321,13 +6545,8 @@ bool MEIInput::ReadArtic(Object *parent, pugi::xml_node artic)
     Artic *vrvArtic = new Artic();
     this->ReadLayerElement(artic, vrvArtic);
 
-    vrvArtic->ReadArticulation(artic);
-    vrvArtic->ReadArticulationGes(artic);
-    vrvArtic->ReadColor(artic);
-    vrvArtic->ReadEnclosingChars(artic);
-    vrvArtic->ReadExtSymAuth(artic);
-    vrvArtic->ReadExtSymNames(artic);
-    vrvArtic->ReadPlacementRelEvent(artic);
+    this->ReadAttClasses<AttArticulation, AttArticulationGes, AttColor, AttEnclosingChars, AttExtSymAuth,
+        AttExtSymNames, AttPlacementRelEvent>(artic, vrvArtic);
 
     if (vrvArtic->GetArtic().size() > 1) {
         m_doc->SetMarkup(MARKUP_ARTIC_MULTIVAL);
@@ -6343,10 +6562,7 @@ bool MEIInput::ReadBarLine(Object *parent, pugi::xml_node barLine)
     BarLine *vrvBarLine = new BarLine();
     this->ReadLayerElement(barLine, vrvBarLine);
 
-    vrvBarLine->ReadBarLineLog(barLine);
-    vrvBarLine->ReadColor(barLine);
-    vrvBarLine->ReadNNumberLike(barLine);
-    vrvBarLine->ReadVisibility(barLine);
+    this->ReadAttClasses<AttBarLineLog, AttColor, AttNNumberLike, AttVisibility>(barLine, vrvBarLine);
 
     parent->AddChild(vrvBarLine);
     this->ReadUnsupportedAttr(barLine, vrvBarLine);
@@ -6358,10 +6574,7 @@ bool MEIInput::ReadBeam(Object *parent, pugi::xml_node beam)
     Beam *vrvBeam = new Beam();
     this->ReadLayerElement(beam, vrvBeam);
 
-    vrvBeam->ReadBeamedWith(beam);
-    vrvBeam->ReadBeamRend(beam);
-    vrvBeam->ReadColor(beam);
-    vrvBeam->ReadCue(beam);
+    this->ReadAttClasses<AttBeamedWith, AttBeamRend, AttColor, AttCue>(beam, vrvBeam);
 
     parent->AddChild(vrvBeam);
     this->ReadUnsupportedAttr(beam, vrvBeam);
@@ -6373,9 +6586,7 @@ bool MEIInput::ReadBeatRpt(Object *parent, pugi::xml_node beatRpt)
     BeatRpt *vrvBeatRpt = new BeatRpt();
     this->ReadLayerElement(beatRpt, vrvBeatRpt);
 
-    vrvBeatRpt->ReadColor(beatRpt);
-    vrvBeatRpt->ReadBeatRptLog(beatRpt);
-    vrvBeatRpt->ReadBeatRptVis(beatRpt);
+    this->ReadAttClasses<AttColor, AttBeatRptLog, AttBeatRptVis>(beatRpt, vrvBeatRpt);
 
     if (m_meiversion < meiVersion_MEIVERSION_4_0_0) {
         UpgradeBeatRptTo_4_0_0(beatRpt, vrvBeatRpt);
@@ -6391,10 +6602,7 @@ bool MEIInput::ReadBTrem(Object *parent, pugi::xml_node bTrem)
     BTrem *vrvBTrem = new BTrem();
     this->ReadLayerElement(bTrem, vrvBTrem);
 
-    vrvBTrem->ReadTremForm(bTrem);
-    vrvBTrem->ReadNumbered(bTrem);
-    vrvBTrem->ReadNumberPlacement(bTrem);
-    vrvBTrem->ReadTremMeasured(bTrem);
+    this->ReadAttClasses<AttTremForm, AttNumbered, AttNumberPlacement, AttTremMeasured>(bTrem, vrvBTrem);
 
     parent->AddChild(vrvBTrem);
     this->ReadUnsupportedAttr(bTrem, vrvBTrem);
@@ -6414,14 +6622,8 @@ bool MEIInput::ReadChord(Object *parent, pugi::xml_node chord)
     }
 
     this->ReadDurationInterface(chord, vrvChord);
-    vrvChord->ReadChordVis(chord);
-    vrvChord->ReadColor(chord);
-    vrvChord->ReadCue(chord);
-    vrvChord->ReadGraced(chord);
-    vrvChord->ReadStems(chord);
-    vrvChord->ReadStemsCmn(chord);
-    vrvChord->ReadTiePresent(chord);
-    vrvChord->ReadVisibility(chord);
+    this->ReadAttClasses<AttChordVis, AttColor, AttCue, AttGraced, AttStems, AttStemsCmn, AttTiePresent, AttVisibility
+        >(chord, vrvChord);
 
     InstArticulation artic;
     artic.ReadArticulation(chord);
@@ -6447,17 +6649,8 @@ bool MEIInput::ReadClef(Object *parent, pugi::xml_node clef)
     this->ReadLayerElement(clef, vrvClef);
     this->ReadFacsimileInterface(clef, vrvClef);
 
-    vrvClef->ReadClefLog(clef);
-    vrvClef->ReadClefShape(clef);
-    vrvClef->ReadColor(clef);
-    vrvClef->ReadEnclosingChars(clef);
-    vrvClef->ReadExtSymAuth(clef);
-    vrvClef->ReadExtSymNames(clef);
-    vrvClef->ReadLineLoc(clef);
-    vrvClef->ReadOctave(clef);
-    vrvClef->ReadOctaveDisplacement(clef);
-    vrvClef->ReadStaffIdent(clef);
-    vrvClef->ReadVisibility(clef);
+    this->ReadAttClasses<AttClefLog, AttClefShape, AttColor, AttEnclosingChars, AttExtSymAuth, AttExtSymNames,
+        AttLineLoc, AttOctave, AttOctaveDisplacement, AttStaffIdent, AttVisibility>(clef, vrvClef);
 
     parent->AddChild(vrvClef);
     this->ReadUnsupportedAttr(clef, vrvClef);
@@ -6487,9 +6680,7 @@ bool MEIInput::ReadCustos(Object *parent, pugi::xml_node custos)
     this->ReadFacsimileInterface(custos, vrvCustos);
     this->ReadPitchInterface(custos, vrvCustos);
     this->ReadPositionInterface(custos, vrvCustos);
-    vrvCustos->ReadColor(custos);
-    vrvCustos->ReadExtSymAuth(custos);
-    vrvCustos->ReadExtSymNames(custos);
+    this->ReadAttClasses<AttColor, AttExtSymAuth, AttExtSymNames>(custos, vrvCustos);
 
     this->ReadAccidAttr(custos, vrvCustos);
 
@@ -6504,11 +6695,7 @@ bool MEIInput::ReadDivLine(Object *parent, pugi::xml_node divLine)
     this->ReadLayerElement(divLine, vrvDivLine);
 
     this->ReadFacsimileInterface(divLine, vrvDivLine);
-    vrvDivLine->ReadDivLineLog(divLine);
-    vrvDivLine->ReadColor(divLine);
-    vrvDivLine->ReadVisibility(divLine);
-    vrvDivLine->ReadExtSymAuth(divLine);
-    vrvDivLine->ReadExtSymNames(divLine);
+    this->ReadAttClasses<AttDivLineLog, AttColor, AttVisibility, AttExtSymAuth, AttExtSymNames>(divLine, vrvDivLine);
 
     parent->AddChild(vrvDivLine);
     this->ReadUnsupportedAttr(divLine, vrvDivLine);
@@ -6521,8 +6708,7 @@ bool MEIInput::ReadDot(Object *parent, pugi::xml_node dot)
     this->ReadLayerElement(dot, vrvDot);
 
     this->ReadPositionInterface(dot, vrvDot);
-    vrvDot->ReadColor(dot);
-    vrvDot->ReadDotLog(dot);
+    this->ReadAttClasses<AttColor, AttDotLog>(dot, vrvDot);
 
     parent->AddChild(vrvDot);
     this->ReadUnsupportedAttr(dot, vrvDot);
@@ -6538,8 +6724,7 @@ bool MEIInput::ReadFTrem(Object *parent, pugi::xml_node fTrem)
         UpgradeFTremTo_4_0_0(fTrem, vrvFTrem);
     }
 
-    vrvFTrem->ReadFTremVis(fTrem);
-    vrvFTrem->ReadTremMeasured(fTrem);
+    this->ReadAttClasses<AttFTremVis, AttTremMeasured>(fTrem, vrvFTrem);
 
     parent->AddChild(vrvFTrem);
     this->ReadUnsupportedAttr(fTrem, vrvFTrem);
@@ -6551,9 +6736,7 @@ bool MEIInput::ReadGraceGrp(Object *parent, pugi::xml_node graceGrp)
     GraceGrp *vrvGraceGrp = new GraceGrp();
     this->ReadLayerElement(graceGrp, vrvGraceGrp);
 
-    vrvGraceGrp->ReadColor(graceGrp);
-    vrvGraceGrp->ReadGraced(graceGrp);
-    vrvGraceGrp->ReadGraceGrpLog(graceGrp);
+    this->ReadAttClasses<AttColor, AttGraced, AttGraceGrpLog>(graceGrp, vrvGraceGrp);
 
     parent->AddChild(vrvGraceGrp);
     this->ReadUnsupportedAttr(graceGrp, vrvGraceGrp);
@@ -6579,11 +6762,8 @@ bool MEIInput::ReadKeyAccid(Object *parent, pugi::xml_node keyAccid)
 
     this->ReadPitchInterface(keyAccid, vrvKeyAccid);
     this->ReadPositionInterface(keyAccid, vrvKeyAccid);
-    vrvKeyAccid->ReadAccidental(keyAccid);
-    vrvKeyAccid->ReadColor(keyAccid);
-    vrvKeyAccid->ReadEnclosingChars(keyAccid);
-    vrvKeyAccid->ReadExtSymAuth(keyAccid);
-    vrvKeyAccid->ReadExtSymNames(keyAccid);
+    this->ReadAttClasses<AttAccidental, AttColor, AttEnclosingChars, AttExtSymAuth, AttExtSymNames
+        >(keyAccid, vrvKeyAccid);
 
     parent->AddChild(vrvKeyAccid);
     this->ReadUnsupportedAttr(keyAccid, vrvKeyAccid);
@@ -6599,13 +6779,8 @@ bool MEIInput::ReadKeySig(Object *parent, pugi::xml_node keySig)
         UpgradeKeySigTo_5_0_0(keySig);
     }
 
-    vrvKeySig->ReadAccidental(keySig);
-    vrvKeySig->ReadColor(keySig);
-    vrvKeySig->ReadKeyMode(keySig);
-    vrvKeySig->ReadKeySigLog(keySig);
-    vrvKeySig->ReadKeySigVis(keySig);
-    vrvKeySig->ReadPitch(keySig);
-    vrvKeySig->ReadVisibility(keySig);
+    this->ReadAttClasses<AttAccidental, AttColor, AttKeyMode, AttKeySigLog, AttKeySigVis, AttPitch, AttVisibility
+        >(keySig, vrvKeySig);
 
     parent->AddChild(vrvKeySig);
     this->ReadUnsupportedAttr(keySig, vrvKeySig);
@@ -6647,13 +6822,8 @@ bool MEIInput::ReadMensur(Object *parent, pugi::xml_node mensur)
         }
     }
 
-    vrvMensur->ReadColor(mensur);
-    vrvMensur->ReadCue(mensur);
-    vrvMensur->ReadDurationRatio(mensur);
-    vrvMensur->ReadMensuralShared(mensur);
-    vrvMensur->ReadMensurVis(mensur);
-    vrvMensur->ReadSlashCount(mensur);
-    vrvMensur->ReadStaffLoc(mensur);
+    this->ReadAttClasses<AttColor, AttCue, AttDurationRatio, AttMensuralShared, AttMensurVis, AttSlashCount, AttStaffLoc
+        >(mensur, vrvMensur);
 
     if (m_meiversion < meiVersion_MEIVERSION_5_0_0_dev) {
         UpgradeMensurTo_5_0_0(mensur, vrvMensur);
@@ -6673,10 +6843,7 @@ bool MEIInput::ReadMeterSig(Object *parent, pugi::xml_node meterSig)
         this->UpgradeMeterSigTo_5_0_0(meterSig, vrvMeterSig);
     }
 
-    vrvMeterSig->ReadEnclosingChars(meterSig);
-    vrvMeterSig->ReadMeterSigLog(meterSig);
-    vrvMeterSig->ReadMeterSigVis(meterSig);
-    vrvMeterSig->ReadVisibility(meterSig);
+    this->ReadAttClasses<AttEnclosingChars, AttMeterSigLog, AttMeterSigVis, AttVisibility>(meterSig, vrvMeterSig);
 
     parent->AddChild(vrvMeterSig);
     this->ReadUnsupportedAttr(meterSig, vrvMeterSig);
@@ -6696,10 +6863,7 @@ bool MEIInput::ReadMRest(Object *parent, pugi::xml_node mRest)
         }
     }
 
-    vrvMRest->ReadColor(mRest);
-    vrvMRest->ReadCue(mRest);
-    vrvMRest->ReadFermataPresent(mRest);
-    vrvMRest->ReadVisibility(mRest);
+    this->ReadAttClasses<AttColor, AttCue, AttFermataPresent, AttVisibility>(mRest, vrvMRest);
 
     if (vrvMRest->HasFermata()) {
         m_doc->SetMarkup(MARKUP_ANALYTICAL_FERMATA);
@@ -6720,9 +6884,7 @@ bool MEIInput::ReadMRpt(Object *parent, pugi::xml_node mRpt)
     MRpt *vrvMRpt = new MRpt();
     this->ReadLayerElement(mRpt, vrvMRpt);
 
-    vrvMRpt->ReadColor(mRpt);
-    vrvMRpt->ReadNumbered(mRpt);
-    vrvMRpt->ReadNumberPlacement(mRpt);
+    this->ReadAttClasses<AttColor, AttNumbered, AttNumberPlacement>(mRpt, vrvMRpt);
 
     parent->AddChild(vrvMRpt);
     this->ReadUnsupportedAttr(mRpt, vrvMRpt);
@@ -6757,11 +6919,7 @@ bool MEIInput::ReadMultiRest(Object *parent, pugi::xml_node multiRest)
     this->ReadLayerElement(multiRest, vrvMultiRest);
 
     this->ReadPositionInterface(multiRest, vrvMultiRest);
-    vrvMultiRest->ReadColor(multiRest);
-    vrvMultiRest->ReadMultiRestVis(multiRest);
-    vrvMultiRest->ReadNumbered(multiRest);
-    vrvMultiRest->ReadNumberPlacement(multiRest);
-    vrvMultiRest->ReadWidth(multiRest);
+    this->ReadAttClasses<AttColor, AttMultiRestVis, AttNumbered, AttNumberPlacement, AttWidth>(multiRest, vrvMultiRest);
 
     parent->AddChild(vrvMultiRest);
     this->ReadUnsupportedAttr(multiRest, vrvMultiRest);
@@ -6789,9 +6947,7 @@ bool MEIInput::ReadNc(Object *parent, pugi::xml_node nc)
     this->ReadFacsimileInterface(nc, vrvNc);
     this->ReadPitchInterface(nc, vrvNc);
     this->ReadPositionInterface(nc, vrvNc);
-    vrvNc->ReadColor(nc);
-    vrvNc->ReadIntervalMelodic(nc);
-    vrvNc->ReadNcForm(nc);
+    this->ReadAttClasses<AttColor, AttIntervalMelodic, AttNcForm>(nc, vrvNc);
 
     parent->AddChild(vrvNc);
     return this->ReadLayerChildren(vrvNc, nc, vrvNc);
@@ -6824,21 +6980,9 @@ bool MEIInput::ReadNote(Object *parent, pugi::xml_node note)
     this->ReadDurationInterface(note, vrvNote);
     this->ReadPitchInterface(note, vrvNote);
     this->ReadPositionInterface(note, vrvNote);
-    vrvNote->ReadColor(note);
-    vrvNote->ReadColoration(note);
-    vrvNote->ReadCue(note);
-    vrvNote->ReadExtSymAuth(note);
-    vrvNote->ReadExtSymNames(note);
-    vrvNote->ReadGraced(note);
-    vrvNote->ReadHarmonicFunction(note);
-    vrvNote->ReadMidiVelocity(note);
-    vrvNote->ReadNoteGesTab(note);
-    vrvNote->ReadNoteHeads(note);
-    vrvNote->ReadNoteVisMensural(note);
-    vrvNote->ReadStems(note);
-    vrvNote->ReadStemsCmn(note);
-    vrvNote->ReadTiePresent(note);
-    vrvNote->ReadVisibility(note);
+    this->ReadAttClasses<AttColor, AttColoration, AttCue, AttExtSymAuth, AttExtSymNames, AttGraced, AttHarmonicFunction,
+        AttMidiVelocity, AttNoteGesTab, AttNoteHeads, AttNoteVisMensural, AttStems, AttStemsCmn, AttTiePresent,
+        AttVisibility>(note, vrvNote);
 
     InstArticulation artic;
     artic.ReadArticulation(note);
@@ -6877,11 +7021,7 @@ bool MEIInput::ReadRest(Object *parent, pugi::xml_node rest)
 
     this->ReadDurationInterface(rest, vrvRest);
     this->ReadPositionInterface(rest, vrvRest);
-    vrvRest->ReadColor(rest);
-    vrvRest->ReadCue(rest);
-    vrvRest->ReadExtSymAuth(rest);
-    vrvRest->ReadExtSymNames(rest);
-    vrvRest->ReadRestVisMensural(rest);
+    this->ReadAttClasses<AttColor, AttCue, AttExtSymAuth, AttExtSymNames, AttRestVisMensural>(rest, vrvRest);
 
     parent->AddChild(vrvRest);
     this->ReadUnsupportedAttr(rest, vrvRest);
@@ -6929,9 +7069,7 @@ bool MEIInput::ReadStem(Object *parent, pugi::xml_node stem)
     Stem *vrvStem = new Stem();
     this->ReadLayerElement(stem, vrvStem);
 
-    vrvStem->ReadGraced(stem);
-    vrvStem->ReadStemVis(stem);
-    vrvStem->ReadVisibility(stem);
+    this->ReadAttClasses<AttGraced, AttStemVis, AttVisibility>(stem, vrvStem);
 
     parent->AddChild(vrvStem);
     this->ReadUnsupportedAttr(stem, vrvStem);
@@ -6947,9 +7085,7 @@ bool MEIInput::ReadSyl(Object *parent, pugi::xml_node syl)
     Syl *vrvSyl = new Syl();
     this->ReadLayerElement(syl, vrvSyl);
 
-    vrvSyl->ReadLang(syl);
-    vrvSyl->ReadTypography(syl);
-    vrvSyl->ReadSylLog(syl);
+    this->ReadAttClasses<AttLang, AttTypography, AttSylLog>(syl, vrvSyl);
 
     this->ReadFacsimileInterface(syl, vrvSyl);
 
@@ -6963,8 +7099,7 @@ bool MEIInput::ReadSyllable(Object *parent, pugi::xml_node syllable)
     Syllable *vrvSyllable = new Syllable();
     this->ReadLayerElement(syllable, vrvSyllable);
 
-    vrvSyllable->ReadColor(syllable);
-    vrvSyllable->ReadSlashCount(syllable);
+    this->ReadAttClasses<AttColor, AttSlashCount>(syllable, vrvSyllable);
 
     parent->AddChild(vrvSyllable);
     return this->ReadLayerChildren(vrvSyllable, syllable, vrvSyllable);
@@ -6999,10 +7134,7 @@ bool MEIInput::ReadTuplet(Object *parent, pugi::xml_node tuplet)
     Tuplet *vrvTuplet = new Tuplet();
     this->ReadLayerElement(tuplet, vrvTuplet);
 
-    vrvTuplet->ReadColor(tuplet);
-    vrvTuplet->ReadDurationRatio(tuplet);
-    vrvTuplet->ReadNumberPlacement(tuplet);
-    vrvTuplet->ReadTupletVis(tuplet);
+    this->ReadAttClasses<AttColor, AttDurationRatio, AttNumberPlacement, AttTupletVis>(tuplet, vrvTuplet);
 
     parent->AddChild(vrvTuplet);
     this->ReadUnsupportedAttr(tuplet, vrvTuplet);
@@ -7014,10 +7146,7 @@ bool MEIInput::ReadVerse(Object *parent, pugi::xml_node verse)
     Verse *vrvVerse = new Verse();
     this->ReadLayerElement(verse, vrvVerse);
 
-    vrvVerse->ReadColor(verse);
-    vrvVerse->ReadLang(verse);
-    vrvVerse->ReadNInteger(verse);
-    vrvVerse->ReadTypography(verse);
+    this->ReadAttClasses<AttColor, AttLang, AttNInteger, AttTypography>(verse, vrvVerse);
 
     parent->AddChild(vrvVerse);
     this->ReadUnsupportedAttr(verse, vrvVerse);
@@ -7128,8 +7257,7 @@ bool MEIInput::ReadSymbolDefChildren(Object *parent, pugi::xml_node parentNode,
 bool MEIInput::ReadTextElement(pugi::xml_node element, TextElement *object)
 {
     this->SetMeiID(element, object);
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    this->ReadAttClasses<AttLabelled, AttTyped>(element, object);
 
     return true;
 }
@@ -7190,13 +7318,8 @@ bool MEIInput::ReadRend(Object *parent, pugi::xml_node rend)
 
     this->ReadAreaPosInterface(rend, vrvRend);
 
-    vrvRend->ReadColor(rend);
-    vrvRend->ReadExtSymAuth(rend);
-    vrvRend->ReadLang(rend);
-    vrvRend->ReadNNumberLike(rend);
-    vrvRend->ReadTextRendition(rend);
-    vrvRend->ReadTypography(rend);
-    vrvRend->ReadWhitespace(rend);
+    this->ReadAttClasses<AttColor, AttExtSymAuth, AttLang, AttNNumberLike, AttTextRendition, AttTypography,
+        AttWhitespace>(rend, vrvRend);
 
     if (vrvRend->GetFirstAncestor(REND) && (vrvRend->HasHalign() || vrvRend->HasValign())) {
         LogWarning("@halign or @valign in nested <rend> element <rend> %s will be ignored", vrvRend->GetID().c_str());
@@ -7246,10 +7369,7 @@ bool MEIInput::ReadSymbol(Object *parent, pugi::xml_node symbol)
     Symbol *vrvSymbol = new Symbol();
     this->ReadTextElement(symbol, vrvSymbol);
 
-    vrvSymbol->ReadColor(symbol);
-    vrvSymbol->ReadExtSymAuth(symbol);
-    vrvSymbol->ReadExtSymNames(symbol);
-    vrvSymbol->ReadTypography(symbol);
+    this->ReadAttClasses<AttColor, AttExtSymAuth, AttExtSymNames, AttTypography>(symbol, vrvSymbol);
 
     parent->AddChild(vrvSymbol);
     this->ReadUnsupportedAttr(symbol, vrvSymbol);
@@ -7289,8 +7409,7 @@ bool MEIInput::ReadAltSymInterface(pugi::xml_node element, AltSymInterface *inte
 
 bool MEIInput::ReadAreaPosInterface(pugi::xml_node element, AreaPosInterface *interface)
 {
-    interface->ReadHorizontalAlign(element);
-    interface->ReadVerticalAlign(element);
+    this->ReadAttClasses<AttHorizontalAlign, AttVerticalAlign>(element, interface);
     return true;
 }
 
@@ -7300,14 +7419,8 @@ bool MEIInput::ReadDurationInterface(pugi::xml_node element, DurationInterface *
         UpgradeDurGesTo_4_0_0(element, interface);
     }
 
-    interface->ReadAugmentDots(element);
-    interface->ReadBeamSecondary(element);
-    interface->ReadDurationGes(element);
-    interface->ReadDurationLog(element);
-    interface->ReadDurationQuality(element);
-    interface->ReadDurationRatio(element);
-    interface->ReadFermataPresent(element);
-    interface->ReadStaffIdent(element);
+    this->ReadAttClasses<AttAugmentDots, AttBeamSecondary, AttDurationGes, AttDurationLog, AttDurationQuality,
+        AttDurationRatio, AttFermataPresent, AttStaffIdent>(element, interface);
 
     if (interface->HasFermata()) {
         m_doc->SetMarkup(MARKUP_ANALYTICAL_FERMATA);
@@ -7330,10 +7443,7 @@ bool MEIInput::ReadFacsimileInterface(pugi::xml_node element, FacsimileInterface
 
 bool MEIInput::ReadPitchInterface(pugi::xml_node element, PitchInterface *interface)
 {
-    interface->ReadNoteGes(element);
-    interface->ReadOctave(element);
-    interface->ReadPitch(element);
-    interface->ReadPitchGes(element);
+    this->ReadAttClasses<AttNoteGes, AttOctave, AttPitch, AttPitchGes>(element, interface);
     return true;
 }
 
@@ -7345,20 +7455,14 @@ bool MEIInput::ReadPlistInterface(pugi::xml_node element, PlistInterface *interf
 
 bool MEIInput::ReadPositionInterface(pugi::xml_node element, PositionInterface *interface)
 {
-    interface->ReadStaffLoc(element);
-    interface->ReadStaffLocPitched(element);
+    this->ReadAttClasses<AttStaffLoc, AttStaffLocPitched>(element, interface);
     return true;
 }
 
 bool MEIInput::ReadScoreDefInterface(pugi::xml_node element, ScoreDefInterface *interface)
 {
-    interface->ReadBarring(element);
-    interface->ReadDurationDefault(element);
-    interface->ReadLyricStyle(element);
-    interface->ReadMidiTempo(element);
-    interface->ReadMmTempo(element);
-    interface->ReadMultinumMeasures(element);
-    interface->ReadPianoPedals(element);
+    this->ReadAttClasses<AttBarring, AttDurationDefault, AttLyricStyle, AttMidiTempo, AttMmTempo, AttMultinumMeasures,
+        AttPianoPedals>(element, interface);
     return true;
 }
 
@@ -7370,17 +7474,14 @@ bool MEIInput::ReadTextDirInterface(pugi::xml_node element, TextDirInterface *in
 
 bool MEIInput::ReadTimePointInterface(pugi::xml_node element, TimePointInterface *interface)
 {
-    interface->ReadStaffIdent(element);
-    interface->ReadStartId(element);
-    interface->ReadTimestampLog(element);
+    this->ReadAttClasses<AttStaffIdent, AttStartId, AttTimestampLog>(element, interface);
     return true;
 }
 
 bool MEIInput::ReadTimeSpanningInterface(pugi::xml_node element, TimeSpanningInterface *interface)
 {
     this->ReadTimePointInterface(element, interface);
-    interface->ReadStartEndId(element);
-    interface->ReadTimestamp2Log(element);
+    this->ReadAttClasses<AttStartEndId, AttTimestamp2Log>(element, interface);
     return true;
 }
 
@@ -7391,6 +7492,15 @@ void MEIInput::ReadUnsupportedAttr(pugi::xml_node element, Object *object)
     }
 }
 
+template <class... ATTS, class ELEMENT> void MEIInput::ReadAttClasses(pugi::xml_node element, ELEMENT *object)
+{
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const uint32_t hash = AttConverterBase::StrHash(attr.name());
+        if ((static_cast<ATTS *>(object)->ReadAttribute(attr, hash) || ...)) element.remove_attribute(attr);
+    }
+}
+
 bool MEIInput::ReadEditorialElement(Object *parent, pugi::xml_node current, EditorialLevel level, Object *filter)
 {
     if (std::string(current.name()) == "abbr") {
@@ -7454,8 +7564,7 @@ bool MEIInput::ReadEditorialElement(pugi::xml_node element, EditorialElement *ob
 {
     this->SetMeiID(element, object);
 
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    this->ReadAttClasses<AttLabelled, AttTyped>(element, object);
 
     return true;
 }
@@ -7489,8 +7598,7 @@ bool MEIInput::ReadAnnot(Object *parent, pugi::xml_node annot)
     Annot *vrvAnnot = new Annot();
     this->ReadEditorialElement(annot, vrvAnnot);
 
-    vrvAnnot->ReadPlist(annot);
-    vrvAnnot->ReadSource(annot);
+    this->ReadAttClasses<AttPlist, AttSource>(annot, vrvAnnot);
 
     parent->AddChild(vrvAnnot);
     vrvAnnot->m_content.reset();
@@ -7563,7 +7671,7 @@ bool MEIInput::ReadAppChildren(Object *parent, pugi::xml_node parentNode, Editor
         if (selectedLemOrRdg == current) {
             EditorialElement *last = dynamic_cast<EditorialElement *>(parent->GetLast());
             if (last) {
-                last->m_visibility = Visible;
+                last->SetVisibility(Visible);
                 hasXPathSelected = true;
             }
         }
@@ -7573,7 +7681,7 @@ bool MEIInput::ReadAppChildren(Object *parent, pugi::xml_node parentNode, Editor
     if (!hasXPathSelected) {
         EditorialElement *first = dynamic_cast<EditorialElement *>(parent->GetFirst());
         if (first) {
-            first->m_visibility = Visible;
+            first->SetVisibility(Visible);
         }
         else {
             LogWarning("Could not make one <rdg> or <lem> visible");
@@ -7655,11 +7763,11 @@ bool MEIInput::ReadChoiceChildren(Object *parent, pugi::xml_node parentNode, Edi
         EditorialElement *last = dynamic_cast<EditorialElement *>(parent->GetLast());
         if (success && last) {
             if (selectedChild == current) {
-                last->m_visibility = Visible;
+                last->SetVisibility(Visible);
                 hasXPathSelected = true;
             }
             else {
-                last->m_visibility = Hidden;
+                last->SetVisibility(Hidden);
             }
         }
     }
@@ -7668,7 +7776,7 @@ bool MEIInput::ReadChoiceChildren(Object *parent, pugi::xml_node parentNode, Edi
     if (!hasXPathSelected) {
         EditorialElement *first = dynamic_cast<EditorialElement *>(parent->GetFirst());
         if (first) {
-            first->m_visibility = Visible;
+            first->SetVisibility(Visible);
         }
         else {
             LogWarning("Could not make one child of <choice> visible");
@@ -7731,7 +7839,7 @@ bool MEIInput::ReadLem(Object *parent, pugi::xml_node lem, EditorialLevel level,
 
     Lem *vrvLem = new Lem();
     // By default make them all hidden. MEIInput::ReadAppChildren will make one visible.
-    vrvLem->m_visibility = Hidden;
+    vrvLem->SetVisibility(Hidden);
     this->ReadEditorialElement(lem, vrvLem);
 
     vrvLem->ReadSource(lem);
@@ -7759,7 +7867,7 @@ bool MEIInput::ReadRdg(Object *parent, pugi::xml_node rdg, EditorialLevel level,
 
     Rdg *vrvRdg = new Rdg();
     // By default make them all hidden. MEIInput::ReadAppChildren will make one visible.
-    vrvRdg->m_visibility = Hidden;
+    vrvRdg->SetVisibility(Hidden);
     this->ReadEditorialElement(rdg, vrvRdg);
 
     vrvRdg->ReadSource(rdg);
@@ -7870,11 +7978,11 @@ bool MEIInput::ReadSubstChildren(Object *parent, pugi::xml_node parentNode, Edit
         EditorialElement *last = dynamic_cast<EditorialElement *>(parent->GetLast());
         if (success && last) {
             if (selectedChild == current) {
-                last->m_visibility = Visible;
+                last->SetVisibility(Visible);
                 hasXPathSelected = true;
             }
             else {
-                last->m_visibility = Hidden;
+                last->SetVisibility(Hidden);
             }
         }
     }
@@ -7883,7 +7991,7 @@ bool MEIInput::ReadSubstChildren(Object *parent, pugi::xml_node parentNode, Edit
     if (!hasXPathSelected) {
         EditorialElement *first = dynamic_cast<EditorialElement *>(parent->GetFirst());
         if (first) {
-            first->m_visibility = Visible;
+            first->SetVisibility(Visible);
         }
         else {
             LogWarning("Could not make one child of <subst> visible");
@@ -8479,10 +8587,7 @@ bool MEIInput::ReadGraphic(Object *parent, pugi::xml_node graphic)
     assert(parent);
     Graphic *vrvGraphic = new Graphic();
     this->SetMeiID(graphic, vrvGraphic);
-    vrvGraphic->ReadPointing(graphic);
-    vrvGraphic->ReadWidth(graphic);
-    vrvGraphic->ReadHeight(graphic);
-    vrvGraphic->ReadTyped(graphic);
+    this->ReadAttClasses<AttPointing, AttWidth, AttHeight, AttTyped>(graphic, vrvGraphic);
     parent->AddChild(vrvGraphic);
     return true;
 }
@@ -8492,8 +8597,7 @@ bool MEIInput::ReadSurface(Facsimile *parent, pugi::xml_node surface)
     assert(parent);
     Surface *vrvSurface = new Surface();
     this->SetMeiID(surface, vrvSurface);
-    vrvSurface->ReadCoordinated(surface);
-    vrvSurface->ReadTyped(surface);
+    this->ReadAttClasses<AttCoordinated, AttTyped>(surface, vrvSurface);
 
     for (pugi::xml_node child = surface.first_child(); child; child = child.next_sibling()) {
         if (strcmp(child.name(), "graphic") == 0) {
@@ -8515,8 +8619,7 @@ bool MEIInput::ReadZone(Surface *parent, pugi::xml_node zone)
     assert(parent);
     Zone *vrvZone = new Zone();
     this->SetMeiID(zone, vrvZone);
-    vrvZone->ReadCoordinated(zone);
-    vrvZone->ReadTyped(zone);
+    this->ReadAttClasses<AttCoordinated, AttTyped>(zone, vrvZone);
     parent->AddChild(vrvZone);
     return true;
 }
@@ -10,6 +10,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 #include <numeric>
 #include <regex>
 #include <sstream>
@@ -169,6 +170,62 @@ bool MusicXmlInput::HasContentWithValue(const pugi::xml_node node, const std::st
     return false;
 }
 
+void MusicXmlInput::IndexParts(pugi::xml_node root)
+{
+    m_partsById.clear();
+    m_firstPart = pugi::xml_node();
+    m_hasNonControllingMeasure = false;
+    m_hasEncodedBreaks = false;
+    m_multipleRests.clear();
+
+    if (!IsElement(root, "score-partwise")) return;
+
+    for (pugi::xml_node part : root.children("part")) {
+        if (!m_firstPart) m_firstPart = part;
+        // Keep the first part for each @id
+        m_partsById.emplace(part.attribute("id").as_string(), part);
+        for (pugi::xml_node measure : part.children("measure")) {
+            if (HasAttributeWithValue(measure, "non-controlling", "yes")) m_hasNonControllingMeasure = true;
+            for (pugi::xml_node child : measure.children()) {
+                if (child.type() != pugi::node_element) continue;
+                if (IsElement(child, "print") && (child.attribute("new-system") || child.attribute("new-page"))) {
+                    m_hasEncodedBreaks = true;
+                }
+                // Same as ".//multiple-rest" and ".//multiple-rest[@use-symbols='yes']" on the child
+                musicxml::MultipleRest multipleRest;
+                child.find_node([this, &multipleRest](pugi::xml_node node) {
+                    if (std::strcmp(node.name(), "multiple-rest") != 0) return false;
+                    if (!multipleRest.m_node) multipleRest.m_node = node;
+                    if (HasAttributeWithValue(node, "use-symbols", "yes")) multipleRest.m_useSymbols = true;
+                    return false;
+                });
+                if (multipleRest.m_node) m_multipleRests.emplace(child, multipleRest);
+            }
+        }
+    }
+}
+
+bool MusicXmlInput::IsInFirstPart(pugi::xml_node node) const
+{
+    for (pugi::xml_node parent = node.parent(); parent; parent = parent.parent()) {
+        if (IsElement(parent, "part")) return (parent == m_firstPart);
+    }
+    return false;
+}
+
+void MusicXmlInput::IndexMeasures(Section *section)
+{
+    m_measuresByN.clear();
+
+    for (Object *child : section->GetChildren()) {
+        if (!child->Is(MEASURE)) continue;
+        Measure *measure = vrv_cast<Measure *>(child);
+        assert(measure);
+        // Keep the first measure for each @n
+        m_measuresByN.emplace(measure->GetN(), measure);
+    }
+}
+
 std::string MusicXmlInput::GetContent(const pugi::xml_node node) const
 {
     assert(node);
@@ -188,13 +245,49 @@ std::string MusicXmlInput::GetContentOfChild(const pugi::xml_node node, const st
     return "";
 }
 
+pugi::xml_node MusicXmlInput::FindChild(
+    const pugi::xml_node node, std::string_view path, const musicxml::NodePredicate &predicate) const
+{
+    std::vector<pugi::xml_node> children;
+    this->CollectChildren(node, path, predicate, children, true);
+    return (children.empty()) ? pugi::xml_node() : children.front();
+}
+
+std::vector<pugi::xml_node> MusicXmlInput::FindChildren(
+    const pugi::xml_node node, std::string_view path, const musicxml::NodePredicate &predicate) const
+{
+    std::vector<pugi::xml_node> children;
+    this->CollectChildren(node, path, predicate, children, false);
+    return children;
+}
+
+bool MusicXmlInput::CollectChildren(const pugi::xml_node node, std::string_view path,
+    const musicxml::NodePredicate &predicate, std::vector<pugi::xml_node> &children, bool firstOnly) const
+{
+    const size_t separator = path.find('/');
+    const std::string_view name = path.substr(0, separator);
+    for (pugi::xml_node child : node.children()) {
+        if (child.type() != pugi::node_element) continue;
+        if ((name != "*") && (name != child.name())) continue;
+        if (separator != std::string_view::npos) {
+            // Stop as soon as the first element is found
+            if (this->CollectChildren(child, path.substr(separator + 1), predicate, children, firstOnly)) return true;
+        }
+        else if (!predicate || predicate(child)) {
+            children.push_back(child);
+            if (firstOnly) return true;
+        }
+    }
+    return false;
+}
+
 void MusicXmlInput::ProcessClefChangeQueue(Section *section)
 {
     while (!m_clefChangeQueue.empty()) {
         musicxml::ClefChange clefChange = m_clefChangeQueue.front();
         m_clefChangeQueue.pop();
-        AttNNumberLikeComparison comparisonMeasure(MEASURE, clefChange.m_measureNum);
-        Measure *currentMeasure = vrv_cast<Measure *>(section->FindDescendantByComparison(&comparisonMeasure));
+        auto measureIter = m_measuresByN.find(clefChange.m_measureNum);
+        Measure *currentMeasure = (measureIter != m_measuresByN.end()) ? measureIter->second : NULL;
         if (!currentMeasure) {
             LogWarning("MusicXML import: Clef change at measure %s, staff %d, time %d not inserted",
                 clefChange.m_measureNum.c_str(), clefChange.m_staff->GetN(), clefChange.m_scoreOnset);
@@ -656,10 +749,9 @@ std::string MusicXmlInput::GetWordsOrDynamicsText(const pugi::xml_node node) con
     return std::string();
 }
 
-void MusicXmlInput::TextRendition(const pugi::xpath_node_set words, ControlElement *element) const
+void MusicXmlInput::TextRendition(const std::vector<pugi::xml_node> &words, ControlElement *element) const
 {
-    for (pugi::xpath_node_set::const_iterator it = words.begin(); it != words.end(); ++it) {
-        pugi::xml_node textNode = it->node();
+    for (pugi::xml_node textNode : words) {
         pugi::xml_node soundNode = textNode.parent().next_sibling("sound");
         std::string textStr = GetWordsOrDynamicsText(textNode);
         std::string textColor = textNode.attribute("color").as_string();
@@ -821,9 +913,10 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
 {
     assert(root);
 
+    this->IndexParts(root);
+
     // check for multimetric music
-    bool multiMetric = root.select_node("/score-partwise/part/measure[@non-controlling='yes']");
-    if (multiMetric) {
+    if (m_hasNonControllingMeasure) {
         LogError("MusicXML import: Multimetric music detected. Import cancelled.");
         exit(1);
     }
@@ -832,7 +925,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
 
     // the mdiv
     Mdiv *mdiv = new Mdiv();
-    mdiv->m_visibility = Visible;
+    mdiv->SetVisibility(Visible);
     m_doc->AddChild(mdiv);
     // the score
     Score *score = new Score();
@@ -841,9 +934,13 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
     Section *section = new Section();
     score->AddChild(section);
     // initialize layout
-    if (root.select_node("/score-partwise/part/measure/print[@new-system or @new-page]")) {
+    if (m_hasEncodedBreaks) {
         m_layoutInformation = LAYOUT_ENCODED;
-        if (!root.select_node("/score-partwise/part[1]/measure[1]/print[@new-system or @new-page]")) {
+        bool firstMeasureBreak = false;
+        for (pugi::xml_node print : m_firstPart.child("measure").children("print")) {
+            if (print.attribute("new-system") || print.attribute("new-page")) firstMeasureBreak = true;
+        }
+        if (!firstMeasureBreak) {
             // always start with a new page
             Pb *pb = new Pb();
             section->AddChild(pb);
@@ -903,12 +1000,14 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
     short int staffOffset = 0;
     m_octDis.push_back(0);
 
-    pugi::xpath_node scoreMidiBpm = root.select_node("/score-partwise/part[1]/measure[1]/sound[@tempo][1]");
-    if (scoreMidiBpm) m_doc->GetCurrentScoreDef()->SetMidiBpm(scoreMidiBpm.node().attribute("tempo").as_double());
+    pugi::xml_node scoreMidiBpm = m_firstPart.child("measure").find_child(
+        [](pugi::xml_node child) { return (std::string(child.name()) == "sound") && child.attribute("tempo"); });
+    if (scoreMidiBpm) m_doc->GetCurrentScoreDef()->SetMidiBpm(scoreMidiBpm.attribute("tempo").as_double());
 
-    pugi::xpath_node_set partListChildren = root.select_nodes("/score-partwise/part-list/*");
-    for (pugi::xpath_node_set::const_iterator it = partListChildren.begin(); it != partListChildren.end(); ++it) {
-        pugi::xpath_node xpathNode = *it;
+    pugi::xml_node partList = (IsElement(root, "score-partwise")) ? root.child("part-list") : pugi::xml_node();
+    for (pugi::xml_node partListChild : partList.children()) {
+        if (partListChild.type() != pugi::node_element) continue;
+        pugi::xpath_node xpathNode = partListChild;
         if (IsElement(xpathNode.node(), "part-group")) {
             if (HasAttributeWithValue(xpathNode.node(), "type", "start")) {
                 StaffGrp *staffGrp = new StaffGrp();
@@ -981,8 +1080,9 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
         else if (IsElement(xpathNode.node(), "score-part")) {
             // get the attributes element of the first measure of the part
             const std::string partId = xpathNode.node().attribute("id").as_string();
-            std::string xpath = StringFormat("/score-partwise/part[@id='%s']/measure[1]", partId.c_str());
-            pugi::xpath_node partFirstMeasure = root.select_node(xpath.c_str());
+            auto partIter = m_partsById.find(partId);
+            pugi::xpath_node partFirstMeasure
+                = (partIter != m_partsById.end()) ? partIter->second.child("measure") : pugi::xml_node();
             if (!partFirstMeasure.node().child("attributes")) {
                 LogWarning("MusicXML import: Could not find the 'attributes' element in the first "
                            "measure of part '%s'",
@@ -1074,13 +1174,11 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
             }
 
             // find the part and read it
-            xpath = StringFormat("/score-partwise/part[@id='%s']", partId.c_str());
-            pugi::xpath_node part = root.select_node(xpath.c_str());
-            if (!part) {
+            if (partIter == m_partsById.end()) {
                 LogWarning("MusicXML import: Could not find the part '%s'", partId.c_str());
                 continue;
             }
-            ReadMusicXmlPart(part.node(), section, nbStaves, staffOffset);
+            ReadMusicXmlPart(partIter->second, section, nbStaves, staffOffset);
             // increment the staffOffset for reading the next part
             staffOffset += nbStaves;
         }
@@ -1090,13 +1188,15 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
     }
     // here we could check that there is only one staffGrp left in m_staffGrpStack
 
+    this->IndexMeasures(section);
+
     ProcessClefChangeQueue(section);
 
     Measure *measure = NULL;
     for (auto iter = m_controlElements.begin(); iter != m_controlElements.end(); ++iter) {
         if (!measure || (measure->GetN() != iter->first)) {
-            AttNNumberLikeComparison comparisonMeasure(MEASURE, iter->first);
-            measure = vrv_cast<Measure *>(section->FindDescendantByComparison(&comparisonMeasure, 1));
+            auto measureIter = m_measuresByN.find(iter->first);
+            measure = (measureIter != m_measuresByN.end()) ? measureIter->second : NULL;
         }
         if (!measure) {
             LogWarning("MusicXML import: Element '%s' could not be added to measure %s",
@@ -1657,10 +1757,11 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
     // read the content of the measure
     for (pugi::xml_node::iterator it = node.begin(); it != node.end(); ++it) {
         // first check if there is a multi measure rest
-        if (it->select_node(".//multiple-rest")) {
-            const int multiRestLength = it->select_node(".//multiple-rest").node().text().as_int();
+        const auto multipleRestIter = m_multipleRests.find(*it);
+        if (multipleRestIter != m_multipleRests.end()) {
+            const int multiRestLength = multipleRestIter->second.m_node.text().as_int();
             MultiRest *multiRest = new MultiRest;
-            if (it->select_node(".//multiple-rest[@use-symbols='yes']")) multiRest->SetBlock(BOOLEAN_false);
+            if (multipleRestIter->second.m_useSymbols) multiRest->SetBlock(BOOLEAN_false);
             multiRest->SetNum(multiRestLength);
             Layer *layer = SelectLayer(1, measure);
             AddLayerElement(layer, multiRest);
@@ -1701,7 +1802,7 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
             ReadMusicXmlNote(*it, measure, measureNum, staffOffset, section);
         }
         // for now only check first part
-        else if (IsElement(*it, "print") && node.select_node("parent::part[not(preceding-sibling::part)]")) {
+        else if (IsElement(*it, "print") && IsInFirstPart(*it)) {
             ReadMusicXmlPrint(*it, section);
         }
     }
@@ -1807,8 +1908,12 @@ void MusicXmlInput::ReadMusicXmlAttributes(
     pugi::xml_node time = node.child("time");
 
     // for now only read first key change in first part and update scoreDef
-    if ((key || time || divisionChange) && node.select_node("ancestor::part[not(preceding-sibling::part)]")
-        && !node.select_node("preceding-sibling::attributes/key")) {
+    bool hasPrecedingKey = false;
+    for (pugi::xml_node previous = node.previous_sibling("attributes"); previous && !hasPrecedingKey;
+         previous = previous.previous_sibling("attributes")) {
+        if (previous.child("key")) hasPrecedingKey = true;
+    }
+    if ((key || time || divisionChange) && IsInFirstPart(node) && !hasPrecedingKey) {
         ScoreDef *scoreDef = new ScoreDef();
         if (key) {
             KeySig *meiKey = ConvertKey(key);
@@ -1826,13 +1931,13 @@ void MusicXmlInput::ReadMusicXmlAttributes(
         section->AddChild(scoreDef);
     }
 
-    pugi::xpath_node measureRepeat = node.select_node("measure-style/measure-repeat");
-    pugi::xpath_node measureSlash = node.select_node("measure-style/slash");
+    pugi::xml_node measureRepeat = FindChild(node, "measure-style/measure-repeat");
+    pugi::xml_node measureSlash = FindChild(node, "measure-style/slash");
     if (measureRepeat) {
-        m_mRpt = (HasAttributeWithValue(measureRepeat.node(), "type", "start")) ? true : false;
+        m_mRpt = (HasAttributeWithValue(measureRepeat, "type", "start")) ? true : false;
     }
     if (measureSlash) {
-        m_slash = (HasAttributeWithValue(measureSlash.node(), "type", "start")) ? true : false;
+        m_slash = (HasAttributeWithValue(measureSlash, "type", "start")) ? true : false;
     }
 }
 
@@ -1855,7 +1960,7 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, c
     assert(staff);
 
     const std::string barStyle = node.child("bar-style").text().as_string();
-    pugi::xpath_node repeat = node.select_node("repeat");
+    pugi::xml_node repeat = node.child("repeat");
     if (!barStyle.empty()) {
         data_BARRENDITION barRendition = ConvertStyleToRend(barStyle, repeat);
         if (HasAttributeWithValue(node, "location", "left")) {
@@ -1960,7 +2065,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
     const std::string directionId = node.attribute("id").as_string();
 
     const pugi::xml_node typeNode = node.child("direction-type");
-    const pugi::xpath_node voice = node.select_node("voice");
+    const pugi::xml_node voice = node.child("voice");
     const short int offset = node.child("offset").text().as_int();
     const pugi::xml_node staffNode = node.child("staff");
     const pugi::xml_node soundNode = node.child("sound");
@@ -2026,13 +2131,14 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Dashes (to be connected with previous <dir> or <dynam> as @extender and @tstamp2 attribute
-    pugi::xpath_node dashes = typeNode.select_node("bracket|dashes");
+    pugi::xml_node dashes = FindChild(typeNode, "*",
+        [this](pugi::xml_node child) { return (IsElement(child, "bracket") || IsElement(child, "dashes")); });
     if (dashes) {
-        short int dashesNumber = dashes.node().attribute("number").as_int();
+        short int dashesNumber = dashes.attribute("number").as_int();
         dashesNumber = (dashesNumber < 1) ? 1 : dashesNumber;
         short int staffNum = 1;
         if (staffNode) staffNum = staffNode.text().as_int() + staffOffset;
-        if (HasAttributeWithValue(dashes.node(), "type", "stop")) {
+        if (HasAttributeWithValue(dashes, "type", "stop")) {
             std::vector<std::pair<ControlElement *, musicxml::OpenDashes>>::iterator iter = m_openDashesStack.begin();
             while (iter != m_openDashesStack.end()) {
                 if (iter->second.m_dirN == dashesNumber && iter->second.m_staffNum == staffNum) {
@@ -2052,7 +2158,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
                 }
             }
         }
-        else if (std::strncmp(dashes.node().name(), "dashes", 6) == 0) {
+        else if (std::strncmp(dashes.name(), "dashes", 6) == 0) {
             ControlElement *controlElement = nullptr;
             // find last ControlElement of type dynam or dir and activate extender
             // this is bad MusicXML and shouldn't happen
@@ -2092,26 +2198,27 @@ void MusicXmlInput::ReadMusicXmlDirection(
         }
     }
 
-    pugi::xpath_node_set words = node.select_nodes("direction-type/words");
+    std::vector<pugi::xml_node> words = FindChildren(node, "direction-type/words");
     const bool containsWords = !words.empty();
-    bool containsDynamics
-        = !node.select_node("direction-type/dynamics").node().empty() || soundNode.attribute("dynamics");
-    bool containsTempo = !node.select_node("direction-type/metronome").node().empty() || soundNode.attribute("tempo");
+    bool containsDynamics = FindChild(node, "direction-type/dynamics") || soundNode.attribute("dynamics");
+    bool containsTempo = FindChild(node, "direction-type/metronome") || soundNode.attribute("tempo");
 
     // Directive
     int defaultY = 0; // y position attribute, only for directives and dynamics
     if (containsWords && !containsTempo && !containsDynamics) {
-        pugi::xpath_node_set words = node.select_nodes("direction-type/*[self::words or self::coda or self::segno]");
-        defaultY = words.first().node().attribute("default-y").as_int();
-        defaultY = (defaultY * 10) + words.first().node().attribute("relative-y").as_int();
-        std::string wordStr = words.first().node().text().as_string();
+        std::vector<pugi::xml_node> words = FindChildren(node, "direction-type/*", [this](pugi::xml_node child) {
+            return (IsElement(child, "words") || IsElement(child, "coda") || IsElement(child, "segno"));
+        });
+        defaultY = words.front().attribute("default-y").as_int();
+        defaultY = (defaultY * 10) + words.front().attribute("relative-y").as_int();
+        std::string wordStr = words.front().text().as_string();
         if (wordStr.rfind("cresc", 0) == 0 || wordStr.rfind("dim", 0) == 0 || wordStr.rfind("decresc", 0) == 0) {
             containsDynamics = true;
         }
         else {
             Dir *dir = new Dir();
             if (words.size() == 1) {
-                dir->SetLang(words.first().node().attribute("xml:lang").as_string());
+                dir->SetLang(words.front().attribute("xml:lang").as_string());
             }
             dir->SetPlace(dir->AttPlacementRelStaff::StrToStaffrel(placeStr.c_str()));
             dir->SetTstamp(timeStamp);
@@ -2134,16 +2241,15 @@ void MusicXmlInput::ReadMusicXmlDirection(
             m_controlElements.push_back({ measureNum, dir });
             m_dirStack.push_back(dir);
 
-            pugi::xpath_node extender = (words.end() - 1)->parent().next_sibling("direction-type").first_child();
-            if (!strcmp(extender.node().name(), "bracket") || !strcmp(extender.node().name(), "dashes")) {
-                short int extNumber = extender.node().attribute("number").as_int();
+            pugi::xml_node extender = words.back().parent().next_sibling("direction-type").first_child();
+            if (!strcmp(extender.name(), "bracket") || !strcmp(extender.name(), "dashes")) {
+                short int extNumber = extender.attribute("number").as_int();
                 extNumber = (extNumber < 1) ? 1 : extNumber;
                 short int staffNum = staffNode.text().as_int() + staffOffset;
                 staffNum = (staffNum < 1) ? 1 : staffNum;
                 dir->SetExtender(BOOLEAN_true);
-                if (std::strncmp(extender.node().name(), "bracket", 7) == 0) {
-                    dir->SetLform(
-                        dir->AttLineRendBase::StrToLineform(extender.node().attribute("line-type").as_string()));
+                if (std::strncmp(extender.name(), "bracket", 7) == 0) {
+                    dir->SetLform(dir->AttLineRendBase::StrToLineform(extender.attribute("line-type").as_string()));
                 }
                 else {
                     dir->SetLform(LINEFORM_dashed);
@@ -2156,10 +2262,10 @@ void MusicXmlInput::ReadMusicXmlDirection(
 
     // Dynamics
     if (containsDynamics) {
-        pugi::xpath_node_set dynamics = node.select_nodes(
-            containsWords ? "direction-type/dynamics|direction-type/words" : "direction-type/dynamics");
-
-        dynamics.sort();
+        auto isDynamics = [this, containsWords](pugi::xml_node child) {
+            return (IsElement(child, "dynamics") || (containsWords && IsElement(child, "words")));
+        };
+        std::vector<pugi::xml_node> dynamics = FindChildren(node, "direction-type/*", isDynamics);
 
         Dynam *dynam = new Dynam();
         dynam->SetPlace(dynam->AttPlacementRelStaff::StrToStaffrel(placeStr.c_str()));
@@ -2184,9 +2290,9 @@ void MusicXmlInput::ReadMusicXmlDirection(
         }
 
         TextRendition(dynamics, dynam);
-        if (defaultY == 0) {
-            defaultY = dynamics.first().node().attribute("default-y").as_int();
-            defaultY = (defaultY * 10) + dynamics.first().node().attribute("relative-y").as_int();
+        if ((defaultY == 0) && !dynamics.empty()) {
+            defaultY = dynamics.front().attribute("default-y").as_int();
+            defaultY = (defaultY * 10) + dynamics.front().attribute("relative-y").as_int();
         }
         // parse the default_y attribute and transform to vgrp value, to vertically align dynamics and directives
         defaultY = (defaultY < 0) ? std::abs(defaultY) : defaultY + 2000;
@@ -2195,16 +2301,16 @@ void MusicXmlInput::ReadMusicXmlDirection(
         m_dynamStack.push_back(dynam);
 
         if (!dynamics.empty()) {
-            pugi::xpath_node extender = (dynamics.end() - 1)->parent().next_sibling("direction-type").first_child();
-            if (!strcmp(extender.node().name(), "bracket") || !strcmp(extender.node().name(), "dashes")) {
-                short int extNumber = extender.node().attribute("number").as_int();
+            pugi::xml_node extender = dynamics.back().parent().next_sibling("direction-type").first_child();
+            if (!strcmp(extender.name(), "bracket") || !strcmp(extender.name(), "dashes")) {
+                short int extNumber = extender.attribute("number").as_int();
                 extNumber = (extNumber < 1) ? 1 : extNumber;
                 short int staffNum = staffNode.text().as_int() + staffOffset;
                 staffNum = (staffNum < 1) ? 1 : staffNum;
                 dynam->SetExtender(BOOLEAN_true);
-                if (std::strncmp(extender.node().name(), "bracket", 7) == 0) {
+                if (std::strncmp(extender.name(), "bracket", 7) == 0) {
                     dynam->SetLform(
-                        dynam->AttLineRendBase::StrToLineform(extender.node().attribute("line-type").as_string()));
+                        dynam->AttLineRendBase::StrToLineform(extender.attribute("line-type").as_string()));
                 }
                 else {
                     dynam->SetLform(LINEFORM_dashed);
@@ -2216,12 +2322,12 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Hairpins
-    pugi::xpath_node_set wedges = node.select_nodes("direction-type/wedge");
-    for (pugi::xpath_node_set::const_iterator wedge = wedges.begin(); wedge != wedges.end(); ++wedge) {
-        short int hairpinNumber = wedge->node().attribute("number").as_int();
+    std::vector<pugi::xml_node> wedges = FindChildren(node, "direction-type/wedge");
+    for (pugi::xml_node wedge : wedges) {
+        short int hairpinNumber = wedge.attribute("number").as_int();
         hairpinNumber = (hairpinNumber < 1) ? 1 : hairpinNumber;
         bool matchedWedge = false;
-        if (HasAttributeWithValue(wedge->node(), "type", "stop")) {
+        if (HasAttributeWithValue(wedge, "type", "stop")) {
             // match wedge type=stop to open hairpin
             std::vector<std::pair<Hairpin *, musicxml::OpenSpanner>>::iterator iter;
             for (iter = m_hairpinStack.begin(); iter != m_hairpinStack.end(); ++iter) {
@@ -2230,13 +2336,13 @@ void MusicXmlInput::ReadMusicXmlDirection(
                     if (measureDifference >= 0) {
                         iter->first->SetTstamp2(std::pair<int, double>(measureDifference, timeStamp));
                     }
-                    if (wedge->node().attribute("niente")) {
-                        iter->first->SetNiente(ConvertWordToBool(wedge->node().attribute("niente").as_string()));
+                    if (wedge.attribute("niente")) {
+                        iter->first->SetNiente(ConvertWordToBool(wedge.attribute("niente").as_string()));
                     }
                     if (iter->first->GetForm() == hairpinLog_FORM_cres) {
-                        if (wedge->node().attribute("spread")) {
+                        if (wedge.attribute("spread")) {
                             data_MEASUREMENTSIGNED opening;
-                            opening.SetVu(wedge->node().attribute("spread").as_double() / 5);
+                            opening.SetVu(wedge.attribute("spread").as_double() / 5);
                             iter->first->SetOpening(opening);
                         }
                     }
@@ -2253,14 +2359,14 @@ void MusicXmlInput::ReadMusicXmlDirection(
         else {
             Hairpin *hairpin = new Hairpin();
             musicxml::OpenSpanner openHairpin(hairpinNumber, m_measureCounts.at(measure));
-            if (HasAttributeWithValue(wedge->node(), "type", "crescendo")) {
+            if (HasAttributeWithValue(wedge, "type", "crescendo")) {
                 hairpin->SetForm(hairpinLog_FORM_cres);
             }
-            else if (HasAttributeWithValue(wedge->node(), "type", "diminuendo")) {
+            else if (HasAttributeWithValue(wedge, "type", "diminuendo")) {
                 hairpin->SetForm(hairpinLog_FORM_dim);
-                if (wedge->node().attribute("spread")) {
+                if (wedge.attribute("spread")) {
                     data_MEASUREMENTSIGNED opening;
-                    opening.SetVu(wedge->node().attribute("spread").as_double() / 5);
+                    opening.SetVu(wedge.attribute("spread").as_double() / 5);
                     hairpin->SetOpening(opening);
                 }
             }
@@ -2269,14 +2375,14 @@ void MusicXmlInput::ReadMusicXmlDirection(
                 return;
             }
             hairpin->SetLform(
-                hairpin->AttLineRendBase::StrToLineform(wedge->node().attribute("line-type").as_string()));
-            if (wedge->node().attribute("niente")) {
-                hairpin->SetNiente(ConvertWordToBool(wedge->node().attribute("niente").as_string()));
+                hairpin->AttLineRendBase::StrToLineform(wedge.attribute("line-type").as_string()));
+            if (wedge.attribute("niente")) {
+                hairpin->SetNiente(ConvertWordToBool(wedge.attribute("niente").as_string()));
             }
-            hairpin->SetColor(wedge->node().attribute("color").as_string());
+            hairpin->SetColor(wedge.attribute("color").as_string());
             hairpin->SetPlace(hairpin->AttPlacementRelStaff::StrToStaffrel(placeStr.c_str()));
             hairpin->SetTstamp(timeStamp);
-            if (wedge->node().attribute("id")) hairpin->SetID(wedge->node().attribute("id").as_string());
+            if (wedge.attribute("id")) hairpin->SetID(wedge.attribute("id").as_string());
             if (staffNode) {
                 hairpin->SetStaff(hairpin->AttStaffIdent::StrToXsdPositiveIntegerList(
                     std::to_string(staffNode.text().as_int() + staffOffset)));
@@ -2288,8 +2394,8 @@ void MusicXmlInput::ReadMusicXmlDirection(
             else {
                 hairpin->SetStaff(hairpin->AttStaffIdent::StrToXsdPositiveIntegerList(std::to_string(1 + staffOffset)));
             }
-            int defaultY = wedge->node().attribute("default-y").as_int();
-            defaultY = (defaultY * 10) + wedge->node().attribute("relative-y").as_int();
+            int defaultY = wedge.attribute("default-y").as_int();
+            defaultY = (defaultY * 10) + wedge.attribute("relative-y").as_int();
             // parse the default_y attribute and transform to vgrp value, to vertically align hairpins
             defaultY = (defaultY < 0) ? std::abs(defaultY) : defaultY + 2000;
             hairpin->SetVgrp(defaultY);
@@ -2480,15 +2586,16 @@ void MusicXmlInput::ReadMusicXmlDirection(
     if (containsTempo) {
         Tempo *tempo = new Tempo();
         if (!words.empty()) {
-            const std::string lang = words.first().node().attribute("xml:lang")
-                ? words.first().node().attribute("xml:lang").as_string()
+            const std::string lang = words.front().attribute("xml:lang")
+                ? words.front().attribute("xml:lang").as_string()
                 : "it";
             tempo->SetLang(lang);
         }
         tempo->SetPlace(tempo->AttPlacementRelStaff::StrToStaffrel(placeStr.c_str()));
         if (words.size() != 0) TextRendition(words, tempo);
-        pugi::xpath_node metronome = node.select_node("direction-type/metronome[not(@print-object='no')]");
-        if (metronome) PrintMetronome(metronome.node(), tempo);
+        pugi::xml_node metronome = FindChild(node, "direction-type/metronome",
+            [this](pugi::xml_node child) { return !HasAttributeWithValue(child, "print-object", "no"); });
+        if (metronome) PrintMetronome(metronome, tempo);
         if (soundNode.attribute("tempo")) {
             tempo->SetMidiBpm(soundNode.attribute("tempo").as_double());
         }
@@ -2576,9 +2683,9 @@ void MusicXmlInput::ReadMusicXmlHarmony(pugi::xml_node node, Measure *measure, c
 
     int durOffset = 0;
 
-    std::string harmText = GetContentOfChild(node, "root/root-step");
-    pugi::xpath_node alter = node.select_node("root/root-alter");
-    if (alter) harmText += ConvertAlterToSymbol(GetContent(alter.node()));
+    std::string harmText = FindChild(node, "root/root-step").text().as_string();
+    pugi::xml_node alter = FindChild(node, "root/root-alter");
+    if (alter) harmText += ConvertAlterToSymbol(GetContent(alter));
     pugi::xml_node kind = node.child("kind");
     if (kind) {
         if (HasAttributeWithValue(kind, "use-symbols", "yes")) {
@@ -2659,49 +2766,55 @@ void MusicXmlInput::ReadMusicXmlNote(
         return;
     }
 
-    const pugi::xpath_node notations = node.select_node("notations[not(@print-object='no')]");
+    auto isPrinted = [this](pugi::xml_node child) { return !HasAttributeWithValue(child, "print-object", "no"); };
+    const pugi::xml_node notations = FindChild(node, "notations", isPrinted);
 
-    const bool cue = (node.child("cue") || node.select_node("type[@size='cue']")) ? true : false;
+    auto isCueType = [this](pugi::xml_node type) { return HasAttributeWithValue(type, "size", "cue"); };
+    const bool cue = (node.child("cue") || FindChild(node, "type", isCueType)) ? true : false;
     pugi::xml_node grace = node.child("grace");
 
     // duration string and dots
     const std::string typeStr = node.child("type").text().as_string();
-    const int dots = (int)node.select_nodes("dot").size();
+    const int dots = (int)FindChildren(node, "dot").size();
 
     short int tremSlashNum = -1;
 
     const bool readBeamsAndTuplets = ReadMusicXmlBeamsAndTuplets(node, layer, isChord);
 
     // beam start
-    bool beamStart = node.select_node("beam[@number='1'][text()='begin']");
+    bool beamStart = FindChild(node, "beam", [this](pugi::xml_node beam) {
+        return (HasAttributeWithValue(beam, "number", "1") && HasContentWithValue(beam, "begin"));
+    });
     // tremolos
-    pugi::xpath_node tremolo = notations.node().select_node("ornaments/tremolo");
+    pugi::xml_node tremolo = FindChild(notations, "ornaments/tremolo");
 
     if (tremolo) {
-        if (HasAttributeWithValue(tremolo.node(), "type", "start")) {
+        if (HasAttributeWithValue(tremolo, "type", "start")) {
             if (!isChord) {
                 FTrem *fTrem = new FTrem();
                 AddLayerElement(layer, fTrem);
                 m_elementStackMap.at(layer).push_back(fTrem);
-                int beamFloatNum = tremolo.node().text().as_int(); // number of floating beams
+                int beamFloatNum = tremolo.text().as_int(); // number of floating beams
                 int beamAttachedNum = 0; // number of attached beams
                 while (beamStart && beamAttachedNum < 8) { // count number of (attached) beams, max 8
-                    std::ostringstream o;
-                    o << "beam[@number='" << ++beamAttachedNum + 1 << "'][text()='begin']";
-                    beamStart = node.select_node(o.str().c_str());
+                    const std::string beamNumber = std::to_string(++beamAttachedNum + 1);
+                    beamStart = FindChild(node, "beam", [this, &beamNumber](pugi::xml_node beam) {
+                        return (HasAttributeWithValue(beam, "number", beamNumber)
+                            && HasContentWithValue(beam, "begin"));
+                    });
                 }
                 fTrem->SetBeams(beamFloatNum + beamAttachedNum);
                 fTrem->SetBeamsFloat(beamFloatNum);
             }
         }
-        else if (!HasAttributeWithValue(tremolo.node(), "type", "stop")) {
+        else if (!HasAttributeWithValue(tremolo, "type", "stop")) {
             // this is default tremolo type in MusicXML
-            tremSlashNum = tremolo.node().text().as_int();
+            tremSlashNum = tremolo.text().as_int();
             if (!isChord) {
                 BTrem *bTrem = new BTrem();
                 AddLayerElement(layer, bTrem);
                 m_elementStackMap.at(layer).push_back(bTrem);
-                if (HasAttributeWithValue(tremolo.node(), "type", "unmeasured")) {
+                if (HasAttributeWithValue(tremolo, "type", "unmeasured")) {
                     bTrem->SetForm(tremForm_FORM_unmeas);
                     tremSlashNum = 0;
                 }
@@ -2821,7 +2934,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         // accidental
         pugi::xml_node accidental = node.child("accidental");
         if (!accidental) {
-            accidental = node.select_node("notations/accidental-mark").node();
+            accidental = FindChild(node, "notations/accidental-mark");
         }
         if (accidental) {
             Accid *accid = new Accid();
@@ -2904,8 +3017,8 @@ void MusicXmlInput::ReadMusicXmlNote(
         if (node.child("notehead-text")) LogWarning("MusicXML import: notehead-text is not supported");
 
         // look at the next note to see if we are starting or ending a chord
-        pugi::xpath_node nextNote = node.select_node("./following-sibling::note");
-        if (nextNote.node().child("chord")) nextIsChord = true;
+        pugi::xml_node nextNote = node.next_sibling("note");
+        if (nextNote.child("chord")) nextIsChord = true;
         Chord *chord = NULL;
         TabGrp *tabGrp = NULL;
         if (isTablature) {
@@ -3122,9 +3235,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // slurs
-        pugi::xpath_node_set slurs = node.select_nodes("notations/slur");
-        for (pugi::xpath_node_set::const_iterator it = slurs.begin(); it != slurs.end(); ++it) {
-            pugi::xml_node slur = it->node();
+        for (pugi::xml_node slur : FindChildren(node, "notations/slur")) {
             short int slurNumber = slur.attribute("number").as_int();
             slurNumber = (slurNumber < 1) ? 1 : slurNumber;
             const curvature_CURVEDIR dir = InferCurvedir(slur);
@@ -3146,11 +3257,11 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // ties
-        ReadMusicXmlTies(notations.node(), layer, note, measureNum);
+        ReadMusicXmlTies(notations, layer, note, measureNum);
 
         // articulation
         std::vector<data_ARTICULATION> artics;
-        for (pugi::xml_node articulations : notations.node().children("articulations")) {
+        for (pugi::xml_node articulations : notations.children("articulations")) {
             for (pugi::xml_node articulation : articulations.children()) {
                 Artic *artic = new Artic();
                 artics.push_back(ConvertArticulations(articulation.name()));
@@ -3179,7 +3290,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // technical
-        for (pugi::xml_node technical : notations.node().children("technical")) {
+        for (pugi::xml_node technical : notations.children("technical")) {
             for (pugi::xml_node technicalChild : technical.children()) {
                 const std::string technicalChildName = technicalChild.name();
 
@@ -3269,31 +3380,31 @@ void MusicXmlInput::ReadMusicXmlNote(
     m_ID = "#" + element->GetID();
 
     // breath marks
-    pugi::xpath_node xmlBreath = notations.node().select_node("articulations/breath-mark");
+    pugi::xml_node xmlBreath = FindChild(notations, "articulations/breath-mark");
     if (xmlBreath) {
         Breath *breath = new Breath();
         m_controlElements.push_back({ measureNum, breath });
         breath->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         breath->SetPlace(
-            breath->AttPlacementRelStaff::StrToStaffrel(xmlBreath.node().attribute("placement").as_string()));
-        breath->SetColor(xmlBreath.node().attribute("color").as_string());
+            breath->AttPlacementRelStaff::StrToStaffrel(xmlBreath.attribute("placement").as_string()));
+        breath->SetColor(xmlBreath.attribute("color").as_string());
         breath->SetTstamp((double)(m_durTotal) * (double)m_meterUnit / (double)(4 * m_ppq) + 0.5);
     }
 
     // caesura
-    pugi::xpath_node xmlCaesura = notations.node().select_node("articulations/caesura");
+    pugi::xml_node xmlCaesura = FindChild(notations, "articulations/caesura");
     if (xmlCaesura) {
         Caesura *caesura = new Caesura();
         m_controlElements.push_back({ measureNum, caesura });
         caesura->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         caesura->SetPlace(
-            caesura->AttPlacementRelStaff::StrToStaffrel(xmlCaesura.node().attribute("placement").as_string()));
-        caesura->SetColor(xmlCaesura.node().attribute("color").as_string());
+            caesura->AttPlacementRelStaff::StrToStaffrel(xmlCaesura.attribute("placement").as_string()));
+        caesura->SetColor(xmlCaesura.attribute("color").as_string());
         caesura->SetTstamp((double)(m_durTotal) * (double)m_meterUnit / (double)(4 * m_ppq) + 0.5);
     }
 
     // dynamics
-    pugi::xml_node xmlDynam = notations.node().child("dynamics");
+    pugi::xml_node xmlDynam = notations.child("dynamics");
     if (xmlDynam) {
         Dynam *dynam = new Dynam();
         m_controlElements.push_back({ measureNum, dynam });
@@ -3322,7 +3433,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // fermatas
-    pugi::xml_node xmlFermata = notations.node().child("fermata");
+    pugi::xml_node xmlFermata = notations.child("fermata");
     if (xmlFermata) {
         Fermata *fermata = new Fermata();
         m_controlElements.push_back({ measureNum, fermata });
@@ -3333,9 +3444,9 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // fingering
-    auto xmlFing = notations.node().select_node("technical/fingering");
+    pugi::xml_node xmlFing = FindChild(notations, "technical/fingering");
     if (xmlFing) {
-        const std::string fingText = xmlFing.node().text().as_string();
+        const std::string fingText = xmlFing.text().as_string();
         Fing *fing = new Fing();
         Text *text = new Text();
         text->SetText(UTF8to32(fingText));
@@ -3343,17 +3454,17 @@ void MusicXmlInput::ReadMusicXmlNote(
         const std::string startID = note ? ("#" + note->GetID()) : m_ID;
         fing->SetStartid(startID);
         fing->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
-        fing->SetPlace(fing->AttPlacementRelStaff::StrToStaffrel(xmlFing.node().attribute("placement").as_string()));
+        fing->SetPlace(fing->AttPlacementRelStaff::StrToStaffrel(xmlFing.attribute("placement").as_string()));
         fing->AddChild(text);
     }
 
     // glissando and slide
-    pugi::xpath_node_set glissandi = notations.node().select_nodes("glissando|slide");
-    for (pugi::xpath_node_set::const_iterator it = glissandi.begin(); it != glissandi.end(); ++it) {
+    auto isGlissando
+        = [this](pugi::xml_node child) { return (IsElement(child, "glissando") || IsElement(child, "slide")); };
+    for (pugi::xml_node xmlGlissando : FindChildren(notations, "*", isGlissando)) {
         std::string noteID = m_ID;
         // prevent from using chords or tabGrps
         if (element->Is(CHORD) || element->Is(TABGRP)) noteID = "#" + element->GetChild(0)->GetID();
-        pugi::xml_node xmlGlissando = it->node();
         if (HasAttributeWithValue(xmlGlissando, "type", "start")) {
             Gliss *gliss = new Gliss();
             m_controlElements.push_back({ measureNum, gliss });
@@ -3382,25 +3493,26 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // mordents
-    pugi::xpath_node xmlMordent = notations.node().select_node("ornaments/*[contains(name(), 'mordent')]");
+    pugi::xml_node xmlMordent = FindChild(
+        notations, "ornaments/*", [](pugi::xml_node child) { return (std::strstr(child.name(), "mordent") != NULL); });
     if (xmlMordent) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back({ measureNum, mordent });
         mordent->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         mordent->SetStartid(m_ID);
         // color
-        mordent->SetColor(xmlMordent.node().attribute("color").as_string());
+        mordent->SetColor(xmlMordent.attribute("color").as_string());
         // long
-        mordent->SetLong(ConvertWordToBool(xmlMordent.node().attribute("long").as_string()));
+        mordent->SetLong(ConvertWordToBool(xmlMordent.attribute("long").as_string()));
         // place
         mordent->SetPlace(
-            mordent->AttPlacementRelStaff::StrToStaffrel(xmlMordent.node().attribute("placement").as_string()));
+            mordent->AttPlacementRelStaff::StrToStaffrel(xmlMordent.attribute("placement").as_string()));
         // form
         mordent->SetForm(mordentLog_FORM_lower);
-        if (!std::strncmp(xmlMordent.node().name(), "inverted", 7)) {
+        if (!std::strncmp(xmlMordent.name(), "inverted", 7)) {
             mordent->SetForm(mordentLog_FORM_upper);
         }
-        for (pugi::xml_node xmlAccidMark : notations.node().children("accidental-mark")) {
+        for (pugi::xml_node xmlAccidMark : notations.children("accidental-mark")) {
             const data_ACCIDENTAL_WRITTEN accid = ConvertAccidentalToAccid(xmlAccidMark.text().as_string());
             if (HasAttributeWithValue(xmlAccidMark, "placement", "above")) {
                 mordent->SetAccidupper(accid);
@@ -3415,13 +3527,13 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
         if (BOOLEAN_true == mordent->GetLong()) {
             int mordentFlags = (mordentLog_FORM_upper == mordent->GetForm()) ? FORM_Inverted : FORM_Normal;
-            if (xmlMordent.node().attribute("approach")) {
-                mordentFlags |= (std::string(xmlMordent.node().attribute("approach").as_string()) == "above")
+            if (xmlMordent.attribute("approach")) {
+                mordentFlags |= (std::string(xmlMordent.attribute("approach").as_string()) == "above")
                     ? APPR_Above
                     : APPR_Below;
             }
-            if (xmlMordent.node().attribute("departure")) {
-                mordentFlags |= (std::string(xmlMordent.node().attribute("departure").as_string()) == "above")
+            if (xmlMordent.attribute("departure")) {
+                mordentFlags |= (std::string(xmlMordent.attribute("departure").as_string()) == "above")
                     ? DEP_Above
                     : DEP_Below;
             }
@@ -3434,48 +3546,51 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // schleifer/haydn (counts as mordent with different glyph)
-    pugi::xpath_node xmlExtOrnament
-        = notations.node().select_node("ornaments/*[contains(name(), 'schleifer') or contains(name(), 'haydn')]");
+    pugi::xml_node xmlExtOrnament = FindChild(notations, "ornaments/*", [](pugi::xml_node child) {
+        return (std::strstr(child.name(), "schleifer") != NULL) || (std::strstr(child.name(), "haydn") != NULL);
+    });
     if (xmlExtOrnament) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back({ measureNum, mordent });
         mordent->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         mordent->SetStartid(m_ID);
         // color
-        mordent->SetColor(xmlExtOrnament.node().attribute("color").as_string());
+        mordent->SetColor(xmlExtOrnament.attribute("color").as_string());
         // place
         mordent->SetPlace(
-            mordent->AttPlacementRelStaff::StrToStaffrel(xmlExtOrnament.node().attribute("placement").as_string()));
-        const bool isHaydn = std::string(xmlExtOrnament.node().name()) == "haydn";
+            mordent->AttPlacementRelStaff::StrToStaffrel(xmlExtOrnament.attribute("placement").as_string()));
+        const bool isHaydn = std::string(xmlExtOrnament.name()) == "haydn";
         AttModule::SetExternalsymbols(mordent, "glyph.num", isHaydn ? "U+E56F" : "U+E587");
         AttModule::SetExternalsymbols(mordent, "glyph.auth", "smufl");
     }
 
     // trill
-    pugi::xpath_node xmlTrill = notations.node().select_node("ornaments/trill-mark");
-    pugi::xpath_node xmlTrillLine = notations.node().select_node("ornaments/wavy-line[@type='start']");
+    auto isStart = [this](pugi::xml_node child) { return HasAttributeWithValue(child, "type", "start"); };
+    auto isStop = [this](pugi::xml_node child) { return HasAttributeWithValue(child, "type", "stop"); };
+    pugi::xml_node xmlTrill = FindChild(notations, "ornaments/trill-mark");
+    pugi::xml_node xmlTrillLine = FindChild(notations, "ornaments/wavy-line", isStart);
     if (xmlTrill || xmlTrillLine) {
         Trill *trill = new Trill();
         m_controlElements.push_back({ measureNum, trill });
         trill->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         trill->SetStartid(m_ID);
         // color
-        trill->SetColor(xmlTrill.node().attribute("color").as_string());
+        trill->SetColor(xmlTrill.attribute("color").as_string());
         // place
-        trill->SetPlace(trill->AttPlacementRelStaff::StrToStaffrel(xmlTrill.node().attribute("placement").as_string()));
+        trill->SetPlace(trill->AttPlacementRelStaff::StrToStaffrel(xmlTrill.attribute("placement").as_string()));
         if (xmlTrillLine) {
             trill->SetExtender(BOOLEAN_true);
-            trill->SetN(xmlTrillLine.node().attribute("number").as_string());
+            trill->SetN(xmlTrillLine.attribute("number").as_string());
             if (!xmlTrill) {
                 trill->SetLstartsym(LINESTARTENDSYMBOL_none);
-                trill->SetColor(xmlTrillLine.node().attribute("color").as_string());
+                trill->SetColor(xmlTrillLine.attribute("color").as_string());
                 trill->SetPlace(
-                    trill->AttPlacementRelStaff::StrToStaffrel(xmlTrillLine.node().attribute("placement").as_string()));
+                    trill->AttPlacementRelStaff::StrToStaffrel(xmlTrillLine.attribute("placement").as_string()));
             }
             musicxml::OpenSpanner openTrill(1, m_measureCounts.at(measure));
             m_trillStack.push_back({ trill, openTrill });
         }
-        for (pugi::xml_node xmlAccidMark = xmlTrill.node().next_sibling("accidental-mark"); xmlAccidMark;
+        for (pugi::xml_node xmlAccidMark = xmlTrill.next_sibling("accidental-mark"); xmlAccidMark;
              xmlAccidMark = xmlAccidMark.next_sibling("accidental-mark")) {
             if (HasAttributeWithValue(xmlAccidMark, "placement", "below")) {
                 trill->SetAccidlower(ConvertAccidentalToAccid(xmlAccidMark.text().as_string()));
@@ -3485,9 +3600,9 @@ void MusicXmlInput::ReadMusicXmlNote(
             }
         }
     }
-    if (!m_trillStack.empty() && notations.node().select_node("ornaments/wavy-line[@type='stop']")) {
-        short int extNumber
-            = notations.node().select_node("ornaments/wavy-line[@type='stop']").node().attribute("number").as_int();
+    pugi::xml_node xmlTrillLineEnd = FindChild(notations, "ornaments/wavy-line", isStop);
+    if (!m_trillStack.empty() && xmlTrillLineEnd) {
+        short int extNumber = xmlTrillLineEnd.attribute("number").as_int();
         std::vector<std::pair<Trill *, musicxml::OpenSpanner>>::iterator iter = m_trillStack.begin();
         while (iter != m_trillStack.end()) {
             const int measureDifference = m_measureCounts.at(measure) - iter->second.m_lastMeasureCount;
@@ -3504,16 +3619,17 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // turns
-    pugi::xpath_node xmlTurn = notations.node().select_node("ornaments/*[contains(name(), 'turn')]");
+    pugi::xml_node xmlTurn = FindChild(
+        notations, "ornaments/*", [](pugi::xml_node child) { return (std::strstr(child.name(), "turn") != NULL); });
     if (xmlTurn) {
         Turn *turn = new Turn();
         m_controlElements.push_back({ measureNum, turn });
         turn->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         turn->SetStartid(m_ID);
-        turn->SetColor(xmlTurn.node().attribute("color").as_string());
-        turn->SetPlace(turn->AttPlacementRelStaff::StrToStaffrel(xmlTurn.node().attribute("placement").as_string()));
+        turn->SetColor(xmlTurn.attribute("color").as_string());
+        turn->SetPlace(turn->AttPlacementRelStaff::StrToStaffrel(xmlTurn.attribute("placement").as_string()));
         turn->SetForm(turnLog_FORM_upper);
-        for (pugi::xml_node xmlAccidMark = xmlTurn.node().next_sibling("accidental-mark"); xmlAccidMark;
+        for (pugi::xml_node xmlAccidMark = xmlTurn.next_sibling("accidental-mark"); xmlAccidMark;
              xmlAccidMark = xmlAccidMark.next_sibling("accidental-mark")) {
             if (HasAttributeWithValue(xmlAccidMark, "placement", "above")) {
                 turn->SetAccidupper(ConvertAccidentalToAccid(xmlAccidMark.text().as_string()));
@@ -3525,22 +3641,22 @@ void MusicXmlInput::ReadMusicXmlNote(
                 LogWarning("MusicXML import: Cannot add an accidental to a turn without placement");
             }
         }
-        if (xmlTurn.node().attribute("slash").as_bool()) {
+        if (xmlTurn.attribute("slash").as_bool()) {
             AttModule::SetExternalsymbols(turn, "glyph.auth", "smufl");
             AttModule::SetExternalsymbols(turn, "glyph.num", "U+E569");
         }
-        if (!std::strncmp(xmlTurn.node().name(), "inverted", 8)) {
+        if (!std::strncmp(xmlTurn.name(), "inverted", 8)) {
             turn->SetForm(turnLog_FORM_lower);
-            if (std::string(xmlTurn.node().name()).find("vertical") != std::string::npos) {
+            if (std::string(xmlTurn.name()).find("vertical") != std::string::npos) {
                 turn->SetType("vertical");
                 AttModule::SetExternalsymbols(turn, "glyph.auth", "smufl");
                 AttModule::SetExternalsymbols(turn, "glyph.num", "U+E56B");
             }
         }
-        if (!std::strncmp(xmlTurn.node().name(), "delayed", 7)) {
+        if (!std::strncmp(xmlTurn.name(), "delayed", 7)) {
             turn->SetDelayed(BOOLEAN_true);
         }
-        if (!std::strncmp(xmlTurn.node().name(), "vertical", 8)) {
+        if (!std::strncmp(xmlTurn.name(), "vertical", 8)) {
             turn->SetType("vertical");
             AttModule::SetExternalsymbols(turn, "glyph.auth", "smufl");
             AttModule::SetExternalsymbols(turn, "glyph.num", "U+E56A");
@@ -3548,11 +3664,12 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // arpeggio
-    pugi::xpath_node xmlArpeggiate = notations.node().select_node("*[contains(name(), 'arpeggiate')]");
+    pugi::xml_node xmlArpeggiate = FindChild(
+        notations, "*", [](pugi::xml_node child) { return (std::strstr(child.name(), "arpeggiate") != NULL); });
     if (xmlArpeggiate) {
-        short int arpegN = xmlArpeggiate.node().attribute("number").as_int();
+        short int arpegN = xmlArpeggiate.attribute("number").as_int();
         arpegN = (arpegN < 1) ? 1 : arpegN;
-        const std::string direction = xmlArpeggiate.node().attribute("direction").as_string();
+        const std::string direction = xmlArpeggiate.attribute("direction").as_string();
         bool added = false;
         if (!m_ArpeggioStack.empty()) { // check existing arpeggios
             for (auto iter = m_ArpeggioStack.begin(); iter != m_ArpeggioStack.end(); ++iter) {
@@ -3568,7 +3685,7 @@ void MusicXmlInput::ReadMusicXmlNote(
             Arpeg *arpeggio = new Arpeg();
             arpeggio->GetPlistInterface()->AddRef("#" + element->GetID());
             // color
-            arpeggio->SetColor(xmlArpeggiate.node().attribute("color").as_string());
+            arpeggio->SetColor(xmlArpeggiate.attribute("color").as_string());
             // direction (up/down) and in MEI arrow
             if (!direction.empty()) {
                 arpeggio->SetArrow(BOOLEAN_true);
@@ -3582,7 +3699,7 @@ void MusicXmlInput::ReadMusicXmlNote(
                     arpeggio->SetOrder(arpegLog_ORDER_NONE);
                 }
             }
-            if (!std::strncmp(xmlArpeggiate.node().name(), "non", 3)) {
+            if (!std::strncmp(xmlArpeggiate.name(), "non", 3)) {
                 arpeggio->SetOrder(arpegLog_ORDER_nonarp);
             }
             m_ArpeggioStack.push_back({ arpeggio, musicxml::OpenArpeggio(arpegN, onset) });
@@ -3592,24 +3709,25 @@ void MusicXmlInput::ReadMusicXmlNote(
 
     // tremolo end
     if (tremolo) {
-        if (HasAttributeWithValue(tremolo.node(), "type", "stop")) {
+        if (HasAttributeWithValue(tremolo, "type", "stop")) {
             RemoveLastFromStack(FTREM, layer);
         }
-        else if (!HasAttributeWithValue(tremolo.node(), "type", "start") && !isChord) {
+        else if (!HasAttributeWithValue(tremolo, "type", "start") && !isChord) {
             RemoveLastFromStack(BTREM, layer);
         }
     }
 
     // tuplet end
-    pugi::xpath_node tupletEnd = node.select_node("notations/tuplet[@type='stop']");
+    pugi::xml_node tupletEnd = FindChild(node, "notations/tuplet", isStop);
     if (tupletEnd) {
         RemoveLastFromStack(TUPLET, layer);
     }
 
     // beam end
-    bool beamEnd = node.select_node("beam[text()='end']");
+    bool beamEnd = FindChild(node, "beam", [this](pugi::xml_node beam) { return HasContentWithValue(beam, "end"); });
     if (beamEnd) {
-        int breakSec = (int)node.select_nodes("beam[text()='continue']").size();
+        auto isContinue = [this](pugi::xml_node beam) { return HasContentWithValue(beam, "continue"); };
+        int breakSec = (int)FindChildren(node, "beam", isContinue).size();
         if (breakSec) {
             if (element->Is(NOTE)) {
                 Note *note = vrv_cast<Note *>(element);
@@ -3705,14 +3823,35 @@ void MusicXmlInput::ReadMusicXmlPrint(pugi::xml_node node, Section *section)
 
 bool MusicXmlInput::ReadMusicXmlBeamsAndTuplets(const pugi::xml_node &node, Layer *layer, bool isChord)
 {
-    pugi::xpath_node beamStart = node.select_node("beam[@number='1' and text()='begin']");
-    pugi::xpath_node tupletStart = node.select_node("notations/tuplet[@type='start']");
-    pugi::xpath_node currentMeasure = node.select_node("ancestor::measure");
+    auto isFirstBeamBegin = [this](pugi::xml_node beam) {
+        return (HasAttributeWithValue(beam, "number", "1") && HasContentWithValue(beam, "begin"));
+    };
+    auto isFirstBeamEnd = [this](pugi::xml_node beam) {
+        return (HasAttributeWithValue(beam, "number", "1") && HasContentWithValue(beam, "end"));
+    };
+    auto isStart = [this](pugi::xml_node child) { return HasAttributeWithValue(child, "type", "start"); };
+    auto isStop = [this](pugi::xml_node child) { return HasAttributeWithValue(child, "type", "stop"); };
+
+    pugi::xml_node beamStart = FindChild(node, "beam", isFirstBeamBegin);
+    pugi::xml_node tupletStart = FindChild(node, "notations/tuplet", isStart);
+    // Nothing to do and no need to look at the following notes
+    if (!beamStart && !tupletStart) return true;
 
-    pugi::xml_node beamEnd = node.select_node("./following-sibling::note[beam[@number='1' and text()='end']]").node();
-    pugi::xml_node tupletEnd = node.select_node("./following-sibling::note[notations/tuplet[@type='stop']]").node();
+    pugi::xml_node currentMeasure = node.parent();
+    while (currentMeasure && !IsElement(currentMeasure, "measure")) currentMeasure = currentMeasure.parent();
 
-    const auto measureNodeChildren = currentMeasure.node().children();
+    // The first following notes ending the beam, ending a tuplet and starting a tuplet
+    pugi::xml_node beamEnd;
+    pugi::xml_node tupletEnd;
+    pugi::xml_node nextTupletStart;
+    for (pugi::xml_node next = node.next_sibling("note"); next; next = next.next_sibling("note")) {
+        if (!beamEnd && FindChild(next, "beam", isFirstBeamEnd)) beamEnd = next;
+        if (!tupletEnd && FindChild(next, "notations/tuplet", isStop)) tupletEnd = next;
+        if (!nextTupletStart && FindChild(next, "notations/tuplet", isStart)) nextTupletStart = next;
+        if (beamEnd && tupletEnd && nextTupletStart) break;
+    }
+
+    const auto measureNodeChildren = currentMeasure.children();
     std::vector<pugi::xml_node> currentMeasureNodes(measureNodeChildren.begin(), measureNodeChildren.end());
     // in case note is a start of both beam and tuplet - need to figure which one is longer
     if (beamStart && tupletStart) {
@@ -3723,57 +3862,51 @@ bool MusicXmlInput::ReadMusicXmlBeamsAndTuplets(const pugi::xml_node &node, Laye
         // Negative number - beam ends first, positive - tuplet, zero - both are of the same length
         const int distance = static_cast<int>(std::distance(beamEndIterator, tupletEndIterator));
         if (distance > 0) {
-            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart.node(), layer);
-            ReadMusicXmlBeamStart(node, beamStart.node(), layer);
+            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart, layer);
+            ReadMusicXmlBeamStart(node, beamStart, layer);
         }
         else {
-            ReadMusicXmlBeamStart(node, beamStart.node(), layer);
-            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart.node(), layer);
+            ReadMusicXmlBeamStart(node, beamStart, layer);
+            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart, layer);
         }
     }
     // If note is a start of the beam only - check if there is a tuplet starting/ending in the span of
     // the whole duration of this beam
     else if (beamStart) {
-        // find whether there is a tuplet that starts during the span of the beam
-        pugi::xpath_node nextTupletStart
-            = node.select_node("./following-sibling::note[notations/tuplet[@type='start']]").node();
-
         // find start and end of the beam
         const auto beamStartIterator = std::find(currentMeasureNodes.begin(), currentMeasureNodes.end(), node);
         const auto beamEndIterator = std::find(beamStartIterator, currentMeasureNodes.end(), beamEnd);
 
         // find staff number for the corresponding elements - we do not want to match beam start on one staff with beam
         // end on another
-        pugi::xpath_node nodeStaff = node.select_node("staff");
-        pugi::xpath_node endBeamStaff = beamEnd.select_node("staff");
+        pugi::xml_node nodeStaff = node.child("staff");
+        pugi::xml_node endBeamStaff = beamEnd.child("staff");
 
         if (beamEndIterator == currentMeasureNodes.end()
-            || (nodeStaff && endBeamStaff
-                && (nodeStaff.node().text().as_int() != endBeamStaff.node().text().as_int()))) {
-            std::string measureName = (currentMeasure.node().attribute("id"))
-                ? currentMeasure.node().attribute("id").as_string()
-                : currentMeasure.node().attribute("number").as_string();
+            || (nodeStaff && endBeamStaff && (nodeStaff.text().as_int() != endBeamStaff.text().as_int()))) {
+            std::string measureName = (currentMeasure.attribute("id")) ? currentMeasure.attribute("id").as_string()
+                                                                       : currentMeasure.attribute("number").as_string();
             LogDebug("MusicXML import: Beam without end in measure %s treated as <beamSpan>", measureName.c_str());
             return false;
         }
         // form vector of the beam nodes and find whether there are tuplets that start or end within the beam
         std::vector<pugi::xml_node> beamNodes(beamStartIterator, beamEndIterator + 1);
-        bool isTupletStartInBeam
-            = (beamNodes.end() != std::find(beamNodes.begin(), beamNodes.end(), nextTupletStart.node()));
+        // find whether there is a tuplet that starts during the span of the beam
+        bool isTupletStartInBeam = (beamNodes.end() != std::find(beamNodes.begin(), beamNodes.end(), nextTupletStart));
         bool isTupletEndInBeam = (beamNodes.end() != std::find(beamNodes.begin(), beamNodes.end(), tupletEnd));
         // in case if there is only start/end of the tuplet in the beam, then we need to use beamSpan instead
         if ((tupletEnd != beamEnd) && (isTupletStartInBeam != isTupletEndInBeam)) {
             // TODO: same call as in else-case is intentional. Proper beamSpan support will need to be implemented
             // before this case can be handled correctly
-            ReadMusicXmlBeamStart(node, beamStart.node(), layer);
+            ReadMusicXmlBeamStart(node, beamStart, layer);
         }
         else {
-            ReadMusicXmlBeamStart(node, beamStart.node(), layer);
+            ReadMusicXmlBeamStart(node, beamStart, layer);
         }
     }
     // no special logic needed if we have just tupletStart - just read it as is
     else if (tupletStart) {
-        if (!isChord) ReadMusicXmlTupletStart(node, tupletStart.node(), layer);
+        if (!isChord) ReadMusicXmlTupletStart(node, tupletStart, layer);
     }
 
     return true;
@@ -3788,11 +3921,11 @@ void MusicXmlInput::ReadMusicXmlTupletStart(const pugi::xml_node &node, const pu
     Tuplet *tuplet = new Tuplet();
     AddLayerElement(layer, tuplet);
     m_elementStackMap.at(layer).push_back(tuplet);
-    short int num = node.select_node("time-modification/actual-notes").node().text().as_int();
-    short int numbase = node.select_node("time-modification/normal-notes").node().text().as_int();
+    short int num = FindChild(node, "time-modification/actual-notes").text().as_int();
+    short int numbase = FindChild(node, "time-modification/normal-notes").text().as_int();
     if (tupletStart.first_child()) {
-        num = tupletStart.select_node("tuplet-actual/tuplet-number").node().text().as_int();
-        numbase = tupletStart.select_node("tuplet-normal/tuplet-number").node().text().as_int();
+        num = FindChild(tupletStart, "tuplet-actual/tuplet-number").text().as_int();
+        numbase = FindChild(tupletStart, "tuplet-normal/tuplet-number").text().as_int();
     }
     if (num) tuplet->SetNum(num);
     if (numbase) tuplet->SetNumbase(numbase);
@@ -3805,7 +3938,8 @@ void MusicXmlInput::ReadMusicXmlTupletStart(const pugi::xml_node &node, const pu
 
 void MusicXmlInput::ReadMusicXmlBeamStart(const pugi::xml_node &node, const pugi::xml_node &beamStart, Layer *layer)
 {
-    if (!beamStart || (node.select_node("notations/ornaments/tremolo[@type='start']"))) return;
+    auto isStart = [this](pugi::xml_node child) { return HasAttributeWithValue(child, "type", "start"); };
+    if (!beamStart || FindChild(node, "notations/ornaments/tremolo", isStart)) return;
     if (m_elementStackMap.at(layer).size() > 0 && m_elementStackMap.at(layer).back()->Is(BEAM)) {
         LogDebug("MusicXML import: Adding a beam to a beam");
         if (!node.child("grace")) return;
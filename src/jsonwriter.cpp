@@ -0,0 +1,178 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        jsonwriter.cpp
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "jsonwriter.h"
+
+//----------------------------------------------------------------------------
+
+#include <cassert>
+#include <cstdio>
+#include <limits>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// JsonWriter
+//----------------------------------------------------------------------------
+
+JsonWriter::JsonWriter(std::string &output) : m_output(output)
+{
+    m_output.clear();
+    m_depth = 0;
+}
+
+void JsonWriter::StartObject()
+{
+    this->AppendKey(NULL);
+    m_output += "{\n";
+    ++m_depth;
+}
+
+void JsonWriter::StartObject(const std::string &key)
+{
+    this->AppendKey(&key);
+    m_output += "{\n";
+    ++m_depth;
+}
+
+void JsonWriter::EndObject()
+{
+    this->End('}');
+}
+
+void JsonWriter::StartArray()
+{
+    this->AppendKey(NULL);
+    m_output += "[\n";
+    ++m_depth;
+}
+
+void JsonWriter::StartArray(const std::string &key)
+{
+    this->AppendKey(&key);
+    m_output += "[\n";
+    ++m_depth;
+}
+
+void JsonWriter::EndArray()
+{
+    this->End(']');
+}
+
+void JsonWriter::AddString(const std::string &value)
+{
+    this->AppendKey(NULL);
+    this->AppendQuoted(value);
+    m_output += ",\n";
+}
+
+void JsonWriter::AddString(const std::string &key, const std::string &value)
+{
+    this->AppendKey(&key);
+    this->AppendQuoted(value);
+    m_output += ",\n";
+}
+
+void JsonWriter::AddNumber(double value)
+{
+    this->AppendKey(NULL);
+    this->AppendNumber(value);
+    m_output += ",\n";
+}
+
+void JsonWriter::AddNumber(const std::string &key, double value)
+{
+    this->AppendKey(&key);
+    this->AppendNumber(value);
+    m_output += ",\n";
+}
+
+void JsonWriter::AddBool(bool value)
+{
+    this->AppendKey(NULL);
+    m_output += (value) ? "true,\n" : "false,\n";
+}
+
+void JsonWriter::AddBool(const std::string &key, bool value)
+{
+    this->AppendKey(&key);
+    m_output += (value) ? "true,\n" : "false,\n";
+}
+
+void JsonWriter::AddStringArray(const std::string &key, const std::vector<std::string> &values)
+{
+    this->StartArray(key);
+    for (const std::string &value : values) this->AddString(value);
+    this->EndArray();
+}
+
+void JsonWriter::AppendKey(const std::string *key)
+{
+    m_output.append(m_depth, '\t');
+    if (key) {
+        this->AppendQuoted(*key);
+        m_output += ": ";
+    }
+}
+
+void JsonWriter::AppendQuoted(const std::string &value)
+{
+    static const char *hexDigits = "0123456789abcdef";
+
+    m_output += '"';
+    for (const char c : value) {
+        switch (c) {
+            case '"': m_output += "\\\""; break;
+            case '\\': m_output += "\\\\"; break;
+            case '/': m_output += "\\/"; break;
+            case '\b': m_output += "\\b"; break;
+            case '\f': m_output += "\\f"; break;
+            case '\n': m_output += "\\n"; break;
+            case '\r': m_output += "\\r"; break;
+            case '\t': m_output += "\\t"; break;
+            default:
+                if ((unsigned char)c < 32) {
+                    m_output += "\\u00";
+                    m_output += hexDigits[(unsigned char)c >> 4];
+                    m_output += hexDigits[(unsigned char)c & 0xF];
+                }
+                else {
+                    m_output += c;
+                }
+        }
+    }
+    m_output += '"';
+}
+
+void JsonWriter::AppendNumber(double value)
+{
+    // Same precision as jsonxx for numbers without a precision set
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*Lg", std::numeric_limits<long double>::digits10 + 1, (long double)value);
+    m_output += buffer;
+}
+
+void JsonWriter::End(char closing)
+{
+    assert(m_depth > 0);
+
+    // The comma of the last value is replaced by a space, as jsonxx does
+    const size_t size = m_output.size();
+    if ((size > 2) && (m_output.at(size - 2) == ',')) m_output.at(size - 2) = ' ';
+
+    --m_depth;
+    m_output.append(m_depth, '\t');
+    m_output += closing;
+    m_output += ",\n";
+
+    // Same for the top level object or array
+    if ((m_depth == 0) && (m_output.at(m_output.size() - 2) == ',')) m_output.at(m_output.size() - 2) = ' ';
+}
+
+} // namespace vrv
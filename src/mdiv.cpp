@@ -61,9 +61,17 @@ bool Mdiv::IsSupportedChild(Object *child)
     return true;
 }
 
+void Mdiv::SetVisibility(VisibilityType visibility)
+{
+    if (m_visibility == visibility) return;
+
+    m_visibility = visibility;
+    this->Modify();
+}
+
 void Mdiv::MakeVisible()
 {
-    m_visibility = Visible;
+    this->SetVisibility(Visible);
     if (this->GetParent() && this->GetParent()->Is(MDIV)) {
         Mdiv *parent = vrv_cast<Mdiv *>(this->GetParent());
         assert(parent);
@@ -103,7 +103,10 @@ FunctorCode GetAlignmentLeftRightFunctor::VisitObject(const Object *object)
 // InitProcessingListsFunctor
 //----------------------------------------------------------------------------
 
-InitProcessingListsFunctor::InitProcessingListsFunctor() : ConstFunctor() {}
+InitProcessingListsFunctor::InitProcessingListsFunctor() : ConstFunctor()
+{
+    this->SetVisitedClassIds({ LAYER, VERSE });
+}
 
 FunctorCode InitProcessingListsFunctor::VisitLayer(const Layer *layer)
 {
@@ -65,30 +65,21 @@ namespace vrv {
 // Object
 //----------------------------------------------------------------------------
 
-thread_local unsigned long Object::s_objectCounter = 0;
-thread_local uint32_t Object::s_xmlIDCounter = 0;
+// Random start ID for each thread, unless Object::SeedID is called
+thread_local uint32_t Object::s_xmlIDCounter = std::random_device()();
 
 Object::Object() : BoundingBox()
 {
-    if (s_objectCounter++ == 0) {
-        this->SeedID();
-    }
     this->Init(OBJECT, "m-");
 }
 
 Object::Object(ClassId classId) : BoundingBox()
 {
-    if (s_objectCounter++ == 0) {
-        this->SeedID();
-    }
     this->Init(classId, "m-");
 }
 
 Object::Object(ClassId classId, const std::string &classIdStr) : BoundingBox()
 {
-    if (s_objectCounter++ == 0) {
-        this->SeedID();
-    }
     this->Init(classId, classIdStr);
 }
 
@@ -110,6 +101,7 @@ Object::Object(const Object &object) : BoundingBox(object)
     // Flags
     m_isAttribute = object.m_isAttribute;
     m_isModified = true;
+    m_descendantClassIdsValid = false;
     m_isReferenceObject = object.m_isReferenceObject;
 
     // Also copy attribute classes
@@ -156,6 +148,7 @@ Object &Object::operator=(const Object &object)
         // Flags
         m_isAttribute = object.m_isAttribute;
         m_isModified = true;
+        m_descendantClassIdsValid = false;
         m_isReferenceObject = object.m_isReferenceObject;
 
         // Also copy attribute classes
@@ -199,6 +192,7 @@ void Object::Init(ClassId classId, const std::string &classIdStr)
     // Flags
     m_isAttribute = false;
     m_isModified = true;
+    m_descendantClassIdsValid = false;
     m_isReferenceObject = false;
     // Comments
     m_comment = "";
@@ -361,6 +355,8 @@ void Object::SwapID(Object *other)
 
 void Object::ClearChildren()
 {
+    this->InvalidateDescendantClassIds();
+
     if (m_isReferenceObject) {
         m_children.clear();
         return;
@@ -522,6 +518,7 @@ void Object::InsertChild(Object *element, int idx)
     // With this method we require the parent to be NULL
     assert(!element->GetParent());
     element->SetParent(this);
+    this->InvalidateDescendantClassIds();
 
     if (idx >= (int)m_children.size()) {
         m_children.push_back(element);
@@ -540,6 +537,7 @@ Object *Object::DetachChild(int idx)
     child->ResetParent();
     ArrayOfObjects::iterator iter = m_children.begin();
     m_children.erase(iter + (idx));
+    this->InvalidateDescendantClassIds();
     return child;
 }
 
@@ -571,6 +569,8 @@ Object *Object::Relinquish(int idx)
 
 void Object::ClearRelinquishedChildren()
 {
+    this->InvalidateDescendantClassIds();
+
     ArrayOfObjects::iterator iter;
     for (iter = m_children.begin(); iter != m_children.end();) {
         if ((*iter)->GetParent() != this) {
@@ -892,6 +892,37 @@ void Object::Modify(bool modified) const
         m_parent->Modify();
     }
     m_isModified = modified;
+    if (modified) this->InvalidateDescendantClassIds();
+}
+
+const ClassIdMask &Object::GetDescendantClassIds() const
+{
+    if (!m_descendantClassIdsValid) {
+        m_descendantClassIds.reset();
+        for (const Object *child : m_children) {
+            m_descendantClassIds.set(child->GetClassId());
+            m_descendantClassIds |= child->GetDescendantClassIds();
+        }
+        m_descendantClassIdsValid = true;
+    }
+    return m_descendantClassIds;
+}
+
+bool Object::ContainsClassIds(const ClassIdMask &classIds) const
+{
+    if (classIds.test(this->GetClassId())) return true;
+    return (this->GetDescendantClassIds() & classIds).any();
+}
+
+void Object::InvalidateDescendantClassIds() const
+{
+    const Object *object = this;
+    // Ancestors of an invalidated object are always invalidated too
+    while (object && object->m_descendantClassIdsValid) {
+        object->m_descendantClassIdsValid = false;
+        object->DescendantsModified();
+        object = object->m_parent;
+    }
 }
 
 void Object::FillFlatList(ListOfConstObjects &flatList) const
@@ -1045,10 +1076,12 @@ void Object::Process(Functor &functor, int deepness, bool skipFirst)
         // We need a pointer to the array for the option to work on a reversed copy
         ArrayOfObjects *children = &m_children;
         Filters *filters = functor.GetFilters();
+        // Subtrees without any of the classes visited by the functor are skipped
+        const ClassIdMask *visitedClassIds = (functor.HasVisitedClassIds()) ? &functor.GetVisitedClassIds() : NULL;
         if (functor.GetDirection() == BACKWARD) {
             for (ArrayOfObjects::reverse_iterator iter = children->rbegin(); iter != children->rend(); ++iter) {
                 // we will end here if there is no filter at all or for the current child type
-                if (this->FiltersApply(filters, *iter)) {
+                if (this->FiltersApply(filters, *iter) && (*iter)->VisitedClassIdsApply(visitedClassIds)) {
                     (*iter)->Process(functor, deepness);
                 }
             }
@@ -1056,7 +1089,7 @@ void Object::Process(Functor &functor, int deepness, bool skipFirst)
         else {
             for (ArrayOfObjects::iterator iter = children->begin(); iter != children->end(); ++iter) {
                 // we will end here if there is no filter at all or for the current child type
-                if (this->FiltersApply(filters, *iter)) {
+                if (this->FiltersApply(filters, *iter) && (*iter)->VisitedClassIdsApply(visitedClassIds)) {
                     (*iter)->Process(functor, deepness);
                 }
             }
@@ -1102,10 +1135,12 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
         // We need a pointer to the array for the option to work on a reversed copy
         const ArrayOfObjects *children = &m_children;
         Filters *filters = functor.GetFilters();
+        // Subtrees without any of the classes visited by the functor are skipped
+        const ClassIdMask *visitedClassIds = (functor.HasVisitedClassIds()) ? &functor.GetVisitedClassIds() : NULL;
         if (functor.GetDirection() == BACKWARD) {
             for (ArrayOfObjects::const_reverse_iterator iter = children->rbegin(); iter != children->rend(); ++iter) {
                 // we will end here if there is no filter at all or for the current child type
-                if (this->FiltersApply(filters, *iter)) {
+                if (this->FiltersApply(filters, *iter) && (*iter)->VisitedClassIdsApply(visitedClassIds)) {
                     (*iter)->Process(functor, deepness);
                 }
             }
@@ -1113,7 +1148,7 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
         else {
             for (ArrayOfObjects::const_iterator iter = children->begin(); iter != children->end(); ++iter) {
                 // we will end here if there is no filter at all or for the current child type
-                if (this->FiltersApply(filters, *iter)) {
+                if (this->FiltersApply(filters, *iter) && (*iter)->VisitedClassIdsApply(visitedClassIds)) {
                     (*iter)->Process(functor, deepness);
                 }
             }
@@ -1126,6 +1161,84 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
     }
 }
 
+void Object::Process(CompositeFunctor &functor, int deepness)
+{
+    for (int i = 0; i < functor.GetFunctorCount(); ++i) {
+        // Processing backward or with filters is not supported
+        assert(functor.GetFunctor(i)->GetDirection() == FORWARD);
+        assert(!functor.GetFunctor(i)->GetFilters());
+    }
+
+    this->ProcessComposite(functor, functor.GetFullMask(), deepness);
+}
+
+void Object::ProcessComposite(CompositeFunctor &functor, uint32_t activeMask, int deepness)
+{
+    // Remove the functors that have been stopped
+    for (int i = 0; i < functor.GetFunctorCount(); ++i) {
+        if ((activeMask & (1u << i)) && (functor.GetFunctor(i)->GetCode() == FUNCTOR_STOP)) {
+            activeMask &= ~(1u << i);
+        }
+    }
+    if (!activeMask) return;
+
+    // Update the current score stored in the document
+    this->UpdateDocumentScore(FORWARD);
+
+    // The functors going deeper and the ones for which AcceptEnd needs to be called
+    uint32_t childMask = 0;
+    uint32_t endMask = 0;
+    for (int i = 0; i < functor.GetFunctorCount(); ++i) {
+        if (!(activeMask & (1u << i))) continue;
+        Functor *current = functor.GetFunctor(i);
+        FunctorCode code = this->Accept(*current);
+        current->SetCode(code);
+        // do not go any deeper for this functor
+        if (code == FUNCTOR_SIBLINGS) {
+            current->SetCode(FUNCTOR_CONTINUE);
+            continue;
+        }
+        endMask |= (1u << i);
+        if ((code != FUNCTOR_STOP) && !this->SkipChildren(current->VisibleOnly())) {
+            childMask |= (1u << i);
+        }
+    }
+    if (!endMask) return;
+
+    if (this->IsEditorialElement()) {
+        // since editorial object doesn't count, we increase the deepness limit
+        ++deepness;
+    }
+    if (deepness == 0) {
+        return;
+    }
+    --deepness;
+
+    if (childMask) {
+        for (Object *child : m_children) {
+            // Subtrees without any of the classes visited by a functor are skipped for it
+            uint32_t mask = childMask;
+            for (int i = 0; i < functor.GetFunctorCount(); ++i) {
+                if (!(mask & (1u << i))) continue;
+                Functor *current = functor.GetFunctor(i);
+                if (current->HasVisitedClassIds() && !child->ContainsClassIds(current->GetVisitedClassIds())) {
+                    mask &= ~(1u << i);
+                }
+            }
+            if (mask) child->ProcessComposite(functor, mask, deepness);
+        }
+    }
+
+    for (int i = 0; i < functor.GetFunctorCount(); ++i) {
+        if (!(endMask & (1u << i))) continue;
+        Functor *current = functor.GetFunctor(i);
+        if (current->ImplementsEndInterface()) {
+            FunctorCode code = this->AcceptEnd(*current);
+            current->SetCode(code);
+        }
+    }
+}
+
 FunctorCode Object::Accept(Functor &functor)
 {
     return functor.VisitObject(this);
@@ -1199,6 +1312,13 @@ bool Object::FiltersApply(const Filters *filters, Object *object) const
     return filters ? filters->Apply(object) : true;
 }
 
+bool Object::VisitedClassIdsApply(const ClassIdMask *classIds) const
+{
+    // No visited classes means that all objects are visited
+    if (!classIds) return true;
+    return this->ContainsClassIds(*classIds);
+}
+
 void Object::SaveObject(Output *output, bool basic)
 {
     SaveFunctor save(output, basic);
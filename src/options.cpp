@@ -904,6 +904,21 @@ Options::Options()
     m_standardOutput.SetShortOption(' ', true);
     m_baseOptions.AddOption(&m_standardOutput);
 
+    m_server.SetInfo("Server",
+        "Read newline-delimited JSON requests from the standard input and write the results to the standard output");
+    m_server.Init(false);
+    m_server.SetKey("server");
+    m_server.SetShortOption(' ', true);
+    m_baseOptions.AddOption(&m_server);
+
+    m_threads.SetInfo("Threads",
+        "Number of threads for writing all pages or converting several input files (0 for all hardware threads); "
+        "with several threads, generated IDs of SVG pages differ from the ones with a single thread");
+    m_threads.Init(1, 0, 256);
+    m_threads.SetKey("threads");
+    m_threads.SetShortOption(' ', true);
+    m_baseOptions.AddOption(&m_threads);
+
     m_help.SetInfo("Help", "Display this message");
     m_help.Init(false);
     m_help.SetKey("help");
@@ -1051,6 +1066,11 @@ Options::Options()
     m_ligatureAsBracket.Init(false);
     this->Register(&m_ligatureAsBracket, "ligatureAsBracket", &m_general);
 
+    m_meiStream.SetInfo("Stream MEI files",
+        "Read MEI files measure by measure for reducing the memory needed for loading large files");
+    m_meiStream.Init(false);
+    this->Register(&m_meiStream, "meiStream", &m_general);
+
     m_mensuralToMeasure.SetInfo("Mensural to measure", "Convert mensural sections to measure-based MEI");
     m_mensuralToMeasure.Init(false);
     this->Register(&m_mensuralToMeasure, "mensuralToMeasure", &m_general);
@@ -1161,6 +1181,10 @@ Options::Options()
     m_svgBoundingBoxes.Init(false);
     this->Register(&m_svgBoundingBoxes, "svgBoundingBoxes", &m_general);
 
+    m_svgCacheSize.SetInfo("SVG cache size", "The number of rendered SVG pages kept in memory (0 for no cache)");
+    m_svgCacheSize.Init(0, 0, 1000);
+    this->Register(&m_svgCacheSize, "svgCacheSize", &m_general);
+
     m_svgCss.SetInfo("SVG additional CSS", "CSS (as a string) to be added to the SVG output");
     m_svgCss.Init("");
     this->Register(&m_svgCss, "svgCss", &m_general);
@@ -61,6 +61,7 @@
 #include "score.h"
 #include "staff.h"
 #include "system.h"
+#include "traversalindex.h"
 #include "view.h"
 #include "vrv.h"
 
@@ -85,6 +86,8 @@ void Page::Reset()
     m_score = NULL;
     m_scoreEnd = NULL;
     m_layoutDone = false;
+    m_traversalIndex.Reset();
+    m_traversalIndexValid = false;
     this->ResetID();
 
     // by default we have no values and use the document ones
@@ -186,6 +189,23 @@ const RunningElement *Page::GetFooter() const
     }
 }
 
+TraversalIndex &Page::GetTraversalIndex()
+{
+    if (!m_traversalIndexValid) {
+        m_traversalIndex.Build(this);
+        // Cache the classes of the content so any change of it is notified with DescendantsModified
+        this->GetDescendantClassIds();
+        m_traversalIndexValid = true;
+    }
+    return m_traversalIndex;
+}
+
+void Page::DescendantsModified() const
+{
+    m_traversalIndex.Reset();
+    m_traversalIndexValid = false;
+}
+
 void Page::LayOut(bool force)
 {
     if (m_layoutDone && !force) {
@@ -195,13 +215,14 @@ void Page::LayOut(bool force)
         return;
     }
 
+    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
+    assert(doc);
+    ProfileScope profileScope(doc->GetProfiler(), "layOut");
+
     this->LayOutHorizontally();
     this->JustifyHorizontally();
     this->LayOutVertically();
     this->JustifyVertically();
-
-    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
-    assert(doc);
     if (doc->GetOptions()->m_svgBoundingBoxes.GetValue()) {
         View view;
         view.SetDoc(doc);
@@ -227,38 +248,51 @@ void Page::LayOutTranscription(bool force)
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
+    ProfileScope profileScope(doc->GetProfiler(), "layOutTranscription");
+
     // Reset the horizontal alignment
     ResetHorizontalAlignmentFunctor resetHorizontalAlignment;
     this->Process(resetHorizontalAlignment);
+    profileScope.Lap("resetHorizontalAlignment");
 
     // Reset the vertical alignment
     ResetVerticalAlignmentFunctor resetVerticalAlignment;
     this->Process(resetVerticalAlignment);
+    profileScope.Lap("resetVerticalAlignment");
 
     // Align the content of the page using measure aligners
     // After this:
     // - each LayerElement object will have its Alignment pointer initialized
     AlignHorizontallyFunctor alignHorizontally(doc);
     this->Process(alignHorizontally);
+    profileScope.Lap("alignHorizontally");
 
     // Align the content of the page using system aligners
     // After this:
     // - each Staff object will then have its StaffAlignment pointer initialized
     AlignVerticallyFunctor alignVertically(doc);
     this->Process(alignVertically);
+    profileScope.Lap("alignVertically");
 
     // Set the pitch / pos alignment
     CalcAlignmentPitchPosFunctor calcAlignmentPitchPos(doc);
     this->Process(calcAlignmentPitchPos);
+    profileScope.Lap("calcAlignmentPitchPos");
+
+    // Flat traversal for the functors visiting only a few classes - the tree is not modified by the functors below
+    TraversalIndex &traversalIndex = this->GetTraversalIndex();
 
     CalcStemFunctor calcStem(doc);
-    this->Process(calcStem);
+    traversalIndex.Process(calcStem);
+    profileScope.Lap("calcStem");
 
     CalcChordNoteHeadsFunctor calcChordNoteHeads(doc);
     this->Process(calcChordNoteHeads);
+    profileScope.Lap("calcChordNoteHeads");
 
     CalcDotsFunctor calcDots(doc);
-    this->Process(calcDots);
+    traversalIndex.Process(calcDots);
+    profileScope.Lap("calcDots");
 
     // Render it for filling the bounding box
     View view;
@@ -270,9 +304,11 @@ void Page::LayOutTranscription(bool force)
 
     AdjustXRelForTranscriptionFunctor adjustXRelForTranscription;
     this->Process(adjustXRelForTranscription);
+    profileScope.Lap("adjustXRelForTranscription");
 
     CalcLedgerLinesFunctor calcLedgerLines(doc);
-    this->Process(calcLedgerLines);
+    traversalIndex.Process(calcLedgerLines);
+    profileScope.Lap("calcLedgerLines");
 
     m_layoutDone = true;
 }
@@ -286,25 +322,31 @@ void Page::ResetAligners()
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
+    ProfileScope profileScope(doc->GetProfiler(), "resetAligners");
+
     // Reset the horizontal alignment
     ResetHorizontalAlignmentFunctor resetHorizontalAlignment;
     this->Process(resetHorizontalAlignment);
+    profileScope.Lap("resetHorizontalAlignment");
 
     // Reset the vertical alignment
     ResetVerticalAlignmentFunctor resetVerticalAlignment;
     this->Process(resetVerticalAlignment);
+    profileScope.Lap("resetVerticalAlignment");
 
     // Align the content of the page using measure aligners
     // After this:
     // - each LayerElement object will have its Alignment pointer initialized
     AlignHorizontallyFunctor alignHorizontally(doc);
     this->Process(alignHorizontally);
+    profileScope.Lap("alignHorizontally");
 
     // Align the content of the page using system aligners
     // After this:
     // - each Staff object will then have its StaffAlignment pointer initialized
     AlignVerticallyFunctor alignVertically(doc);
     this->Process(alignVertically);
+    profileScope.Lap("alignVertically");
 
     // Unless duration-based spacing is disabled, set the X position of each Alignment.
     // Does non-linear spacing based on the duration space between two Alignment objects.
@@ -327,35 +369,47 @@ void Page::ResetAligners()
         CalcAlignmentXPosFunctor calcAlignmentXPos(doc);
         calcAlignmentXPos.SetLongestActualDur(longestActualDur);
         this->Process(calcAlignmentXPos);
+        profileScope.Lap("calcAlignmentXPos");
     }
 
     // Set the pitch / pos alignment
     CalcAlignmentPitchPosFunctor calcAlignmentPitchPos(doc);
     this->Process(calcAlignmentPitchPos);
+    profileScope.Lap("calcAlignmentPitchPos");
 
     if (IsMensuralType(doc->m_notationType)) {
         CalcLigatureNotePosFunctor calcLigatureNotePos(doc);
         this->Process(calcLigatureNotePos);
+        profileScope.Lap("calcLigatureNotePos");
     }
 
+    // Flat traversal for the functors visiting only a few classes - the tree is not modified by the functors below
+    TraversalIndex &traversalIndex = this->GetTraversalIndex();
+
     CalcStemFunctor calcStem(doc);
-    this->Process(calcStem);
+    traversalIndex.Process(calcStem);
+    profileScope.Lap("calcStem");
 
     CalcChordNoteHeadsFunctor calcChordNoteHeads(doc);
     this->Process(calcChordNoteHeads);
+    profileScope.Lap("calcChordNoteHeads");
 
     CalcDotsFunctor calcDots(doc);
-    this->Process(calcDots);
+    traversalIndex.Process(calcDots);
+    profileScope.Lap("calcDots");
 
     // Adjust the position of outside articulations
     CalcArticFunctor calcArtic(doc);
     this->Process(calcArtic);
+    profileScope.Lap("calcArtic");
 
     CalcSlurDirectionFunctor calcSlurDirection(doc);
     this->Process(calcSlurDirection);
+    profileScope.Lap("calcSlurDirection");
 
     CalcSpanningBeamSpansFunctor calcSpanningBeamSpans(doc);
     this->Process(calcSpanningBeamSpans);
+    profileScope.Lap("calcSpanningBeamSpans");
 }
 
 void Page::LayOutHorizontally()
@@ -367,6 +421,8 @@ void Page::LayOutHorizontally()
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
+    ProfileScope profileScope(doc->GetProfiler(), "layOutHorizontally");
+
     this->ResetAligners();
 
     // Render it for filling the bounding box
@@ -377,82 +433,100 @@ void Page::LayOutHorizontally()
     // Do not do the layout in this view - otherwise we will loop...
     view.SetPage(this->GetIdx(), false);
     view.DrawCurrentPage(&bBoxDC, false);
+    profileScope.Lap("drawBoundingBoxes");
 
     // Adjust the position of outside articulations
     AdjustArticFunctor adjustArtic(doc);
     this->Process(adjustArtic);
+    profileScope.Lap("adjustArtic");
 
     // Adjust the x position of the LayerElement where multiple layers collide
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
     // For the first iteration align elements without taking dots into consideration
     AdjustLayersFunctor adjustLayers(doc, doc->GetCurrentScoreDef()->GetStaffNs());
     this->Process(adjustLayers);
+    profileScope.Lap("adjustLayers");
 
     // Adjust dots for the multiple layers. Try to align dots that can be grouped together when layers collide,
     // otherwise keep their relative positioning
     AdjustDotsFunctor adjustDots(doc, doc->GetCurrentScoreDef()->GetStaffNs());
     this->Process(adjustDots);
+    profileScope.Lap("adjustDots");
 
     // Adjust layers again, this time including dots positioning
     AdjustLayersFunctor adjustLayersWithDots(doc, doc->GetCurrentScoreDef()->GetStaffNs());
     adjustLayersWithDots.IgnoreDots(false);
     this->Process(adjustLayersWithDots);
+    profileScope.Lap("adjustLayersWithDots");
 
     // Adjust the X position of the accidentals, including in chords
     AdjustAccidXFunctor adjustAccidX(doc);
     this->Process(adjustAccidX);
+    profileScope.Lap("adjustAccidX");
 
     // Adjust the X shift of the Alignment looking at the bounding boxes
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
     AdjustXPosFunctor adjustXPos(doc, doc->GetCurrentScoreDef()->GetStaffNs());
     adjustXPos.SetExcluded({ TABDURSYM });
     this->Process(adjustXPos);
+    profileScope.Lap("adjustXPos");
 
     // Adjust tabRhythm separately
     adjustXPos.ClearExcluded();
     adjustXPos.SetIncluded({ BARLINE, KEYSIG, METERSIG, TABDURSYM });
     adjustXPos.SetRightBarLinesOnly(true);
     this->Process(adjustXPos);
+    profileScope.Lap("adjustXPos");
 
     // Adjust the X shift of the Alignment looking at the bounding boxes
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
     AdjustGraceXPosFunctor adjustGraceXPos(doc, doc->GetCurrentScoreDef()->GetStaffNs());
     this->Process(adjustGraceXPos);
+    profileScope.Lap("adjustGraceXPos");
 
     // Adjust the spacing of clef changes since they are skipped in AdjustXPos
     // Look at each clef change and  move them to the left and add space if necessary
     AdjustClefChangesFunctor adjustClefChanges(doc);
     this->Process(adjustClefChanges);
+    profileScope.Lap("adjustClefChanges");
 
     // We need to populate processing lists for processing the document by Layer (for matching @tie) and
     // by Verse (for matching syllable connectors)
     InitProcessingListsFunctor initProcessingLists;
     this->Process(initProcessingLists);
+    profileScope.Lap("initProcessingLists");
 
     this->AdjustSylSpacingByVerse(initProcessingLists.GetVerseTree(), doc);
+    profileScope.Lap("adjustSylSpacing");
 
     AdjustHarmGrpsSpacingFunctor adjustHarmGrpsSpacing(doc);
     this->Process(adjustHarmGrpsSpacing);
+    profileScope.Lap("adjustHarmGrpsSpacing");
 
     // Adjust the arpeg
     AdjustArpegFunctor adjustArpeg(doc);
     this->Process(adjustArpeg);
+    profileScope.Lap("adjustArpeg");
 
     // Adjust the tempo
     AdjustTempoFunctor adjustTempo(doc);
     this->Process(adjustTempo);
+    profileScope.Lap("adjustTempo");
 
     // Adjust the position of the tuplets
     AdjustTupletsXFunctor adjustTupletsX(doc);
     this->Process(adjustTupletsX);
+    profileScope.Lap("adjustTupletsX");
 
     // Prevent a margin overflow
     AdjustXOverflowFunctor adjustXOverflow(doc->GetDrawingUnit(100));
     this->Process(adjustXOverflow);
+    profileScope.Lap("adjustXOverflow");
 
     // Adjust measure X position
     AlignMeasuresFunctor alignMeasures(doc);
     this->Process(alignMeasures);
+    profileScope.Lap("alignMeasures");
 }
 
 void Page::LayOutHorizontallyWithCache(bool restore)
@@ -474,18 +548,23 @@ void Page::LayOutVertically()
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
+    ProfileScope profileScope(doc->GetProfiler(), "layOutVertically");
+
     // Reset the vertical alignment
     ResetVerticalAlignmentFunctor resetVerticalAlignment;
     this->Process(resetVerticalAlignment);
+    profileScope.Lap("resetVerticalAlignment");
 
     CalcLedgerLinesFunctor calcLedgerLines(doc);
     this->Process(calcLedgerLines);
+    profileScope.Lap("calcLedgerLines");
 
     // Align the content of the page using system aligners
     // After this:
     // - each Staff object will then have its StaffAlignment pointer initialized
     AlignVerticallyFunctor alignVertically(doc);
     this->Process(alignVertically);
+    profileScope.Lap("alignVertically");
 
     // Render it for filling the bounding box
     View view;
@@ -494,62 +573,77 @@ void Page::LayOutVertically()
     // Do not do the layout in this view - otherwise we will loop...
     view.SetPage(this->GetIdx(), false);
     view.DrawCurrentPage(&bBoxDC, false);
+    profileScope.Lap("drawBoundingBoxes");
 
     // Adjust the position of outside articulations with slurs end and start positions
     AdjustArticWithSlursFunctor adjustArticWithSlurs(doc);
     this->Process(adjustArticWithSlurs);
+    profileScope.Lap("adjustArticWithSlurs");
 
     // Adjust the position of the beams in regards of layer elements
     AdjustBeamsFunctor adjustBeams(doc);
     this->Process(adjustBeams);
+    profileScope.Lap("adjustBeams");
 
     // Adjust the position of the tuplets
     AdjustTupletsYFunctor adjustTupletsY(doc);
     this->Process(adjustTupletsY);
+    profileScope.Lap("adjustTupletsY");
 
     // Adjust the position of the slurs
     AdjustSlursFunctor adjustSlurs(doc);
     this->Process(adjustSlurs);
+    profileScope.Lap("adjustSlurs");
 
     // At this point slurs must not be reinitialized, otherwise the adjustment we just did was in vain
     view.SetSlurHandling(SlurHandling::Drawing);
     view.SetPage(this->GetIdx(), false);
     view.DrawCurrentPage(&bBoxDC, false);
+    profileScope.Lap("drawBoundingBoxes");
 
     // Adjust the position of tuplets by slurs
     AdjustTupletWithSlursFunctor adjustTupletWithSlurs(doc);
     this->Process(adjustTupletWithSlurs);
+    profileScope.Lap("adjustTupletWithSlurs");
 
     // Fill the arrays of bounding boxes (above and below) for each staff alignment for which the box overflows.
     CalcBBoxOverflowsFunctor calcBBoxOverflows(doc);
     this->Process(calcBBoxOverflows);
+    profileScope.Lap("calcBBoxOverflows");
 
     // Adjust the positioners of floating elements (slurs, hairpin, dynam, etc)
     AdjustFloatingPositionersFunctor adjustFloatingPositioners(doc);
     this->Process(adjustFloatingPositioners);
+    profileScope.Lap("adjustFloatingPositioners");
 
     // Adjust the overlap of the staff alignments by looking at the overflow bounding boxes
     AdjustStaffOverlapFunctor adjustStaffOverlap(doc);
     this->Process(adjustStaffOverlap);
+    profileScope.Lap("adjustStaffOverlap");
 
     // Set the Y position of each StaffAlignment
     // Adjust the Y shift to make sure there is a minimal space (staffMargin) between each staff
     AdjustYPosFunctor adjustYPos(doc);
     this->Process(adjustYPos);
+    profileScope.Lap("adjustYPos");
 
     // Adjust the positioners of floating elements placed between staves
     AdjustFloatingPositionersBetweenFunctor adjustFloatingPositionersBetween(doc);
     this->Process(adjustFloatingPositionersBetween);
+    profileScope.Lap("adjustFloatingPositionersBetween");
 
     AdjustCrossStaffYPosFunctor adjustCrossStaffYPos(doc);
     this->Process(adjustCrossStaffYPos);
+    profileScope.Lap("adjustCrossStaffYPos");
 
     // Redraw are re-adjust the position of the slurs when we have cross-staff ones
     if (adjustSlurs.HasCrossStaffSlurs()) {
         view.SetSlurHandling(SlurHandling::Initialize);
         view.SetPage(this->GetIdx(), false);
         view.DrawCurrentPage(&bBoxDC, false);
+        profileScope.Lap("drawBoundingBoxes");
         this->Process(adjustSlurs);
+        profileScope.Lap("adjustSlurs");
     }
 
     doc->SetCurrentScore(this->m_score);
@@ -567,6 +661,7 @@ void Page::LayOutVertically()
     alignSystems.SetShift(doc->m_drawingPageContentHeight);
     alignSystems.SetSystemSpacing(doc->GetOptions()->m_spacingSystem.GetValue() * doc->GetDrawingUnit(100));
     this->Process(alignSystems);
+    profileScope.Lap("alignSystems");
 }
 
 void Page::JustifyHorizontally()
@@ -588,10 +683,13 @@ void Page::JustifyHorizontally()
             = doc->m_drawingPageContentWidth + doc->m_drawingPageMarginLeft + doc->m_drawingPageMarginRight;
     }
     else {
+        ProfileScope profileScope(doc->GetProfiler(), "justifyHorizontally");
+
         // Justify X position
         JustifyXFunctor justifyX(doc);
         justifyX.SetSystemFullWidth(doc->m_drawingPageContentWidth);
         this->Process(justifyX);
+        profileScope.Lap("justifyX");
     }
 }
 
@@ -617,17 +715,21 @@ void Page::JustifyVertically()
     // Ignore vertical justification if it's not required
     if (!this->IsJustificationRequired(doc)) return;
 
+    ProfileScope profileScope(doc->GetProfiler(), "justifyVertically");
+
     // Justify Y position
     JustifyYFunctor justifyY(doc);
     justifyY.SetJustificationSum(m_justificationSum);
     justifyY.SetSpaceToDistribute(m_drawingJustifiableHeight);
     this->Process(justifyY);
+    profileScope.Lap("justifyY");
 
     if (!justifyY.GetShiftForStaff().empty()) {
         // Adjust cross staff content which is displaced through vertical justification
         JustifyYAdjustCrossStaffFunctor justifyYAdjustCrossStaff(doc);
         justifyYAdjustCrossStaff.SetShiftForStaff(justifyY.GetShiftForStaff());
         this->Process(justifyYAdjustCrossStaff);
+        profileScope.Lap("justifyYAdjustCrossStaff");
     }
 }
 
@@ -877,7 +877,10 @@ FunctorCode PrepareTimestampsFunctor::VisitMeasureEnd(Measure *measure)
 // PreparePedalsFunctor
 //----------------------------------------------------------------------------
 
-PreparePedalsFunctor::PreparePedalsFunctor(Doc *doc) : DocFunctor(doc) {}
+PreparePedalsFunctor::PreparePedalsFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetVisitedClassIds({ MEASURE, PEDAL });
+}
 
 FunctorCode PreparePedalsFunctor::VisitMeasureEnd(Measure *measure)
 {
@@ -969,6 +972,16 @@ PrepareLyricsFunctor::PrepareLyricsFunctor() : Functor()
     m_currentSyl = NULL;
     m_lastNoteOrChord = NULL;
     m_penultimateNoteOrChord = NULL;
+    m_stopAtNextSyl = false;
+}
+
+void PrepareLyricsFunctor::ContinueFrom(const PrepareLyricsFunctor &functor)
+{
+    m_currentSyl = functor.m_currentSyl;
+    m_lastNoteOrChord = functor.m_lastNoteOrChord;
+    m_penultimateNoteOrChord = functor.m_penultimateNoteOrChord;
+    m_stopAtNextSyl = true;
+    this->SetCode(FUNCTOR_CONTINUE);
 }
 
 FunctorCode PrepareLyricsFunctor::VisitChord(Chord *chord)
@@ -1041,6 +1054,12 @@ FunctorCode PrepareLyricsFunctor::VisitSyl(Syl *syl)
         }
     }
 
+    // The syl itself was already processed
+    if (m_stopAtNextSyl) {
+        m_currentSyl = NULL;
+        return FUNCTOR_STOP;
+    }
+
     // Now decide what to do with the starting syl and check if it has a forward connector
     if ((syl->GetWordpos() == sylLog_WORDPOS_i) || (syl->GetWordpos() == sylLog_WORDPOS_m)) {
         m_currentSyl = syl;
@@ -1321,6 +1340,8 @@ PrepareRptFunctor::PrepareRptFunctor(Doc *doc) : DocFunctor(doc)
 {
     m_currentMRpt = NULL;
     m_multiNumber = BOOLEAN_NONE;
+
+    this->SetVisitedClassIds({ LAYER, MRPT, STAFF });
 }
 
 FunctorCode PrepareRptFunctor::VisitLayer(Layer *layer)
@@ -1810,7 +1831,10 @@ FunctorCode PrepareStaffCurrentTimeSpanningFunctor::VisitSyl(Syl *syl)
 // PrepareRehPositionFunctor
 //----------------------------------------------------------------------------
 
-PrepareRehPositionFunctor::PrepareRehPositionFunctor() : Functor() {}
+PrepareRehPositionFunctor::PrepareRehPositionFunctor() : Functor()
+{
+    this->SetVisitedClassIds({ REH });
+}
 
 FunctorCode PrepareRehPositionFunctor::VisitReh(Reh *reh)
 {
@@ -1826,7 +1850,10 @@ FunctorCode PrepareRehPositionFunctor::VisitReh(Reh *reh)
 // PrepareBeamSpanElementsFunctor
 //----------------------------------------------------------------------------
 
-PrepareBeamSpanElementsFunctor::PrepareBeamSpanElementsFunctor() : Functor() {}
+PrepareBeamSpanElementsFunctor::PrepareBeamSpanElementsFunctor() : Functor()
+{
+    this->SetVisitedClassIds({ BEAMSPAN });
+}
 
 FunctorCode PrepareBeamSpanElementsFunctor::VisitBeamSpan(BeamSpan *beamSpan)
 {
@@ -0,0 +1,123 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        profiler.cpp
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "profiler.h"
+
+//----------------------------------------------------------------------------
+
+#include <cassert>
+#include <cstring>
+#include <functional>
+
+//----------------------------------------------------------------------------
+
+#include "jsonxx.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// Profiler
+//----------------------------------------------------------------------------
+
+Profiler::Profiler()
+{
+    this->Reset();
+}
+
+void Profiler::Reset()
+{
+    m_nodes.clear();
+    m_nodes.emplace_back();
+    m_frames.clear();
+}
+
+void Profiler::Start(const char *name)
+{
+    const int parent = (m_frames.empty()) ? 0 : m_frames.back().m_node;
+    const int node = this->GetChild(parent, name);
+    const Clock::time_point now = Clock::now();
+    m_frames.push_back({ node, now, now });
+}
+
+void Profiler::End()
+{
+    // The profiler was reset while the stage was running
+    if (m_frames.empty()) return;
+
+    const Clock::time_point now = Clock::now();
+    ProfileNode &node = m_nodes.at(m_frames.back().m_node);
+    ++node.m_count;
+    node.m_time += std::chrono::duration<double, std::milli>(now - m_frames.back().m_start).count();
+    m_frames.pop_back();
+
+    // The next step of the parent stage does not include this stage
+    if (!m_frames.empty()) m_frames.back().m_lap = now;
+}
+
+void Profiler::Lap(const char *name)
+{
+    if (m_frames.empty()) return;
+
+    const int node = this->GetChild(m_frames.back().m_node, name);
+    const Clock::time_point now = Clock::now();
+    ProfileFrame &frame = m_frames.back();
+    ++m_nodes.at(node).m_count;
+    m_nodes.at(node).m_time += std::chrono::duration<double, std::milli>(now - frame.m_lap).count();
+    frame.m_lap = now;
+}
+
+int Profiler::GetChild(int parent, const char *name)
+{
+    for (const int child : m_nodes.at(parent).m_children) {
+        if (!strcmp(m_nodes.at(child).m_name.c_str(), name)) return child;
+    }
+
+    const int child = (int)m_nodes.size();
+    m_nodes.emplace_back();
+    m_nodes.back().m_name = name;
+    m_nodes.at(parent).m_children.push_back(child);
+    return child;
+}
+
+std::string Profiler::GetJson() const
+{
+    std::function<jsonxx::Array(int)> getStages = [this, &getStages](int parent) {
+        jsonxx::Array stages;
+        for (const int child : m_nodes.at(parent).m_children) {
+            const ProfileNode &node = m_nodes.at(child);
+            jsonxx::Object stage;
+            stage << "name" << node.m_name;
+            stage << "count" << node.m_count;
+            stage << "time" << node.m_time;
+            if (!node.m_children.empty()) stage << "stages" << getStages(child);
+            stages << stage;
+        }
+        return stages;
+    };
+
+    jsonxx::Object o;
+    o << "stages" << getStages(0);
+    o << "unit" << "ms";
+
+    return o.json();
+}
+
+//----------------------------------------------------------------------------
+// ProfileScope
+//----------------------------------------------------------------------------
+
+ProfileScope::ProfileScope(Profiler &profiler, const char *name) : m_profiler(profiler)
+{
+    m_profiler.Start(name);
+}
+
+ProfileScope::~ProfileScope()
+{
+    m_profiler.End();
+}
+
+} // namespace vrv
@@ -48,6 +48,9 @@ Resources::Resources()
 {
     m_path = s_defaultPath;
     m_currentStyle = k_defaultStyle;
+    m_currentTextTable = NULL;
+    m_currentTextGlyphArray = NULL;
+    m_fontGeneration = 0;
 }
 
 bool Resources::InitFonts()
@@ -82,6 +85,7 @@ bool Resources::InitFonts()
     }
 
     m_currentStyle = k_defaultStyle;
+    this->UpdateCurrentTextTable();
 
     return true;
 }
@@ -130,19 +134,46 @@ void Resources::SelectTextFont(data_FONTWEIGHT fontWeight, data_FONTSTYLE fontSt
         LogWarning("Text font for style (%d, %d) is not loaded. Use default", fontWeight, fontStyle);
         m_currentStyle = k_defaultStyle;
     }
+    this->UpdateCurrentTextTable();
 }
 
-const Glyph *Resources::GetTextGlyph(char32_t code) const
+void Resources::UpdateCurrentTextTable() const
 {
     const StyleAttributes style = (m_textFont.count(m_currentStyle) != 0) ? m_currentStyle : k_defaultStyle;
-    if (m_textFont.count(style) == 0) return NULL;
+    m_currentTextTable = (m_textFont.count(style) != 0) ? &m_textFont.at(style) : NULL;
+    m_currentTextGlyphArray = (m_textGlyphArrays.count(style) != 0) ? &m_textGlyphArrays.at(style) : NULL;
+}
 
-    const GlyphTable &currentTable = m_textFont.at(style);
-    if (currentTable.count(code) == 0) {
-        return NULL;
+const Glyph *Resources::GetTextGlyph(char32_t code) const
+{
+    if (m_currentTextGlyphArray && (code < m_currentTextGlyphArray->size())) {
+        return (*m_currentTextGlyphArray)[code];
     }
 
-    return &currentTable.at(code);
+    if (!m_currentTextTable) return NULL;
+
+    GlyphTable::const_iterator it = m_currentTextTable->find(code);
+    return (it != m_currentTextTable->end()) ? &it->second : NULL;
+}
+
+bool Resources::GetCachedTextExtent(
+    const std::u32string &text, int pointSize, bool typeSize, TextExtend &extend) const
+{
+    const TextExtentKey key{ text, m_currentStyle, pointSize, typeSize };
+    auto it = m_textExtentCache.find(key);
+    if (it == m_textExtentCache.end()) return false;
+
+    extend = it->second;
+    return true;
+}
+
+void Resources::SetCachedTextExtent(
+    const std::u32string &text, int pointSize, bool typeSize, const TextExtend &extend) const
+{
+    // Keep the cache bounded for documents with a very large amount of distinct text
+    if (m_textExtentCache.size() >= 100000) m_textExtentCache.clear();
+
+    m_textExtentCache[TextExtentKey{ text, m_currentStyle, pointSize, typeSize }] = extend;
 }
 
 char32_t Resources::GetSmuflGlyphForUnicodeChar(const char32_t unicodeChar)
@@ -217,6 +248,9 @@ bool Resources::LoadFont(const std::string &fontName, bool withFallback)
     }
 
     m_fontName = fontName;
+    ++m_fontGeneration;
+    // Text extents can use SMuFL glyphs
+    m_textExtentCache.clear();
     return true;
 }
 
@@ -265,6 +299,15 @@ bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes
             currentTable[code] = glyph;
         }
     }
+
+    TextGlyphArray &glyphArray = m_textGlyphArrays[style];
+    for (char32_t code = 0; code < glyphArray.size(); ++code) {
+        GlyphTable::const_iterator it = currentTable.find(code);
+        glyphArray.at(code) = (it != currentTable.end()) ? &it->second : NULL;
+    }
+    this->UpdateCurrentTextTable();
+    m_textExtentCache.clear();
+
     return true;
 }
 
@@ -55,6 +55,12 @@ SvgDeviceContext::SvgDeviceContext() : DeviceContext(SVG_DEVICE_CONTEXT)
     m_removeXlink = false;
     m_facsimile = false;
     m_indent = 2;
+    m_includeDefs = true;
+    m_hasRegion = false;
+    m_regionX = 0;
+    m_regionY = 0;
+    m_regionWidth = 0;
+    m_regionHeight = 0;
 
     // create the initial SVG element
     // width and height need to be set later; these are taken care of in "commit"
@@ -143,6 +149,12 @@ void SvgDeviceContext::Commit(bool xml_declaration)
         }
     }
 
+    // the size of a region is proportional to the size of the page
+    if (m_hasRegion && (this->GetWidth() > 0) && (this->GetContentHeight() > 0)) {
+        width = std::ceil(width * m_regionWidth / (this->GetWidth() * DEFINITION_FACTOR));
+        height = std::ceil(height * m_regionHeight / (this->GetContentHeight() * DEFINITION_FACTOR));
+    }
+
     if (m_svgViewBox) {
         m_svgNode.prepend_attribute("viewBox") = StringFormat("0 0 %g %g", width, height).c_str();
     }
@@ -165,24 +177,9 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     }
 
     // header
-    if (m_smuflGlyphs.size() > 0) {
-
+    if (m_includeDefs && (m_smuflGlyphs.size() > 0)) {
         pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
-
-        // for each needed glyph
-        for (const Glyph *smuflGlyph : m_smuflGlyphs) {
-            // load the XML file that contains it as a pugi::xml_document
-            std::ifstream source(smuflGlyph->GetPath());
-            sourceDoc.load(source);
-
-            // copy all the nodes inside into the master document
-            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
-                std::string id = StringFormat("%s-%s", child.attribute("id").value(), m_glyphPostfixId.c_str());
-                child.attribute("id").set_value(id.c_str());
-                defs.append_copy(child);
-            }
-        }
+        this->AppendGlyphDefs(defs, m_smuflGlyphs);
     }
 
     unsigned int output_flags = pugi::format_default | pugi::format_no_declaration;
@@ -210,6 +207,59 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     m_committed = true;
 }
 
+void SvgDeviceContext::AppendGlyphDefs(pugi::xml_node defs, const std::set<const Glyph *> &glyphs) const
+{
+    pugi::xml_document sourceDoc;
+
+    // for each needed glyph
+    for (const Glyph *smuflGlyph : glyphs) {
+        // load the XML file that contains it as a pugi::xml_document
+        std::ifstream source(smuflGlyph->GetPath());
+        sourceDoc.load(source);
+
+        // copy all the nodes inside into the master document
+        for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
+            std::string id = StringFormat("%s-%s", child.attribute("id").value(), m_glyphPostfixId.c_str());
+            child.attribute("id").set_value(id.c_str());
+            defs.append_copy(child);
+        }
+    }
+}
+
+void SvgDeviceContext::SetRegion(int x, int y, int width, int height)
+{
+    m_hasRegion = true;
+    m_regionX = x;
+    m_regionY = y;
+    m_regionWidth = width;
+    m_regionHeight = height;
+}
+
+std::string SvgDeviceContext::GetStringDefs(const std::set<const Glyph *> &glyphs) const
+{
+    pugi::xml_document svgDoc;
+    pugi::xml_node svgNode = svgDoc.append_child("svg");
+    svgNode.append_attribute("version") = "1.1";
+    svgNode.append_attribute("xmlns") = "http://www.w3.org/2000/svg";
+    svgNode.append_attribute("xmlns:xlink") = "http://www.w3.org/1999/xlink";
+    svgNode.append_attribute("width") = "0";
+    svgNode.append_attribute("height") = "0";
+
+    pugi::xml_node defs = svgNode.append_child("defs");
+    this->AppendGlyphDefs(defs, glyphs);
+
+    unsigned int output_flags = pugi::format_default | pugi::format_no_declaration;
+    if (m_formatRaw) {
+        output_flags |= pugi::format_raw;
+    }
+
+    std::ostringstream output;
+    std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
+    svgDoc.save(output, indent.c_str(), output_flags);
+
+    return output.str();
+}
+
 void SvgDeviceContext::StartGraphic(
     Object *object, std::string gClass, std::string gId, GraphicID graphicID, bool prepend)
 {
@@ -462,6 +512,10 @@ void SvgDeviceContext::StartPage()
         m_currentNode.append_attribute("viewBox")
             = StringFormat("0 0 %d %d", this->GetWidth(), this->GetHeight()).c_str();
     }
+    else if (m_hasRegion) {
+        m_currentNode.append_attribute("viewBox")
+            = StringFormat("%d %d %d %d", m_regionX, m_regionY, m_regionWidth, m_regionHeight).c_str();
+    }
     else {
         m_currentNode.append_attribute("viewBox") = StringFormat(
             "0 0 %d %d", this->GetWidth() * DEFINITION_FACTOR, this->GetContentHeight() * DEFINITION_FACTOR)
@@ -54,6 +54,14 @@ void SystemElement::Reset()
     m_visibility = Visible;
 }
 
+void SystemElement::SetVisibility(VisibilityType visibility)
+{
+    if (m_visibility == visibility) return;
+
+    m_visibility = visibility;
+    this->Modify();
+}
+
 //----------------------------------------------------------------------------
 // Functor methods
 //----------------------------------------------------------------------------
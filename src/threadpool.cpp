@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        threadpool.cpp
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "threadpool.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+
+#ifndef NO_THREAD_SUPPORT
+
+ThreadPool::ThreadPool(int threadCount)
+{
+    m_pending = 0;
+    m_stop = false;
+
+    if (threadCount <= 0) threadCount = ThreadPool::GetHardwareThreadCount();
+    // With one thread, the tasks are run in the calling thread
+    if (threadCount == 1) return;
+
+    m_workers.reserve(threadCount);
+    for (int i = 0; i < threadCount; ++i) {
+        m_workers.emplace_back(&ThreadPool::Run, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_taskCondition.notify_all();
+    for (std::thread &worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::Enqueue(std::function<void()> task)
+{
+    if (m_workers.empty()) {
+        task();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push(std::move(task));
+        ++m_pending;
+    }
+    m_taskCondition.notify_one();
+}
+
+void ThreadPool::Wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this] { return (m_pending == 0); });
+}
+
+int ThreadPool::GetHardwareThreadCount()
+{
+    return std::max(1, (int)std::thread::hardware_concurrency());
+}
+
+void ThreadPool::Run()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_taskCondition.wait(lock, [this] { return (m_stop || !m_tasks.empty()); });
+            if (m_stop && m_tasks.empty()) return;
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_pending;
+        }
+        m_doneCondition.notify_all();
+    }
+}
+
+#else // NO_THREAD_SUPPORT
+
+ThreadPool::ThreadPool(int threadCount) {}
+
+ThreadPool::~ThreadPool() {}
+
+void ThreadPool::Enqueue(std::function<void()> task)
+{
+    task();
+}
+
+void ThreadPool::Wait() {}
+
+int ThreadPool::GetHardwareThreadCount()
+{
+    return 1;
+}
+
+void ThreadPool::Run() {}
+
+#endif // NO_THREAD_SUPPORT
+
+} // namespace vrv
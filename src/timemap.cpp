@@ -10,10 +10,13 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
 
 //----------------------------------------------------------------------------
 
-#include "jsonxx.h"
+#include "jsonwriter.h"
 #include "measure.h"
 #include "note.h"
 #include "rest.h"
@@ -40,58 +43,126 @@ void Timemap::Reset()
 void Timemap::ToJson(std::string &output, bool includeRests, bool includeMeasures)
 {
     double currentTempo = -1000.0;
-    double newTempo;
 
-    jsonxx::Array timemap;
+    JsonWriter writer(output);
+    writer.StartArray();
 
-    for (auto &[tstamp, entry] : m_map) {
-        jsonxx::Object o;
-        o << "tstamp" << tstamp;
-        o << "qstamp" << entry.qstamp;
-
-        // on / off
-        if (!entry.notesOn.empty()) {
-            jsonxx::Array notesOn;
-            for (auto note : entry.notesOn) notesOn << note;
-            o << "on" << notesOn;
-        }
-        if (!entry.notesOff.empty()) {
-            jsonxx::Array notesOff;
-            for (auto note : entry.notesOff) notesOff << note;
-            o << "off" << notesOff;
+    for (const auto &[tstamp, entry] : m_map) {
+        // tempo - only when it changes
+        bool hasTempo = false;
+        if ((entry.tempo != -1000.0) && (entry.tempo != currentTempo)) {
+            currentTempo = entry.tempo;
+            hasTempo = true;
         }
 
-        // restsOn / restsOff
+        // Keys are written in alphabetical order (same order as with jsonxx)
+        writer.StartObject();
+        if (includeMeasures && !entry.measureOn.empty()) {
+            writer.AddString("measureOn", entry.measureOn);
+        }
+        if (!entry.notesOff.empty()) writer.AddStringArray("off", entry.notesOff);
+        if (!entry.notesOn.empty()) writer.AddStringArray("on", entry.notesOn);
+        writer.AddNumber("qstamp", entry.qstamp);
         if (includeRests) {
-            if (!entry.restsOn.empty()) {
-                jsonxx::Array restsOn;
-                for (auto rest : entry.restsOn) restsOn << rest;
-                o << "restsOn" << restsOn;
-            }
-            if (!entry.restsOff.empty()) {
-                jsonxx::Array restsOff;
-                for (auto rest : entry.restsOff) restsOff << rest;
-                o << "restsOff" << restsOff;
-            }
+            if (!entry.restsOff.empty()) writer.AddStringArray("restsOff", entry.restsOff);
+            if (!entry.restsOn.empty()) writer.AddStringArray("restsOn", entry.restsOn);
         }
+        if (hasTempo) writer.AddString("tempo", std::to_string(currentTempo));
+        writer.AddNumber("tstamp", tstamp);
+        writer.EndObject();
+    }
 
-        // tempo
-        if (entry.tempo != -1000.0) {
-            newTempo = entry.tempo;
-            if (newTempo != currentTempo) {
-                currentTempo = newTempo;
-                o << "tempo" << std::to_string(currentTempo);
-            }
-        }
+    writer.EndArray();
+}
 
-        // measureOn
-        if (includeMeasures && !entry.measureOn.empty()) {
-            o << "measureOn" << entry.measureOn;
+void Timemap::ToBuffer(std::vector<unsigned char> &output, bool includeRests, bool includeMeasures)
+{
+    const uint32_t noId = 0xFFFFFFFF;
+
+    // The ID table with the index of each ID - the views point to the strings of the entries
+    std::vector<std::string_view> ids;
+    std::unordered_map<std::string_view, uint32_t> idIndices;
+    auto getIdIndex = [&ids, &idIndices](const std::string &id) {
+        auto [iter, inserted] = idIndices.try_emplace(id, (uint32_t)ids.size());
+        if (inserted) ids.push_back(id);
+        return iter->second;
+    };
+
+    // The offsets and ID indices of the on, off, restsOn and restsOff columns
+    std::vector<uint32_t> offsets[4];
+    std::vector<uint32_t> indices[4];
+    std::vector<uint32_t> measures;
+    std::vector<double> tempos;
+    const size_t entryCount = m_map.size();
+    for (int i = 0; i < 4; ++i) offsets[i].reserve(entryCount + 1);
+    measures.reserve(entryCount);
+    tempos.reserve(entryCount);
+
+    double currentTempo = 0.0;
+    for (const auto &[tstamp, entry] : m_map) {
+        const std::vector<std::string> *columns[4] = { &entry.notesOn, &entry.notesOff, &entry.restsOn, &entry.restsOff };
+        for (int i = 0; i < 4; ++i) {
+            offsets[i].push_back((uint32_t)indices[i].size());
+            if ((i > 1) && !includeRests) continue;
+            for (const std::string &id : *columns[i]) indices[i].push_back(getIdIndex(id));
         }
-
-        timemap << o;
+        if (entry.tempo != -1000.0) currentTempo = entry.tempo;
+        tempos.push_back(currentTempo);
+        measures.push_back((includeMeasures && !entry.measureOn.empty()) ? getIdIndex(entry.measureOn) : noId);
     }
-    output = timemap.json();
+    for (int i = 0; i < 4; ++i) offsets[i].push_back((uint32_t)indices[i].size());
+
+    size_t idDataSize = 0;
+    for (const std::string_view &id : ids) idDataSize += id.size();
+
+    // Compute the size of the buffer
+    size_t size = 40 + entryCount * 3 * sizeof(double);
+    for (int i = 0; i < 4; ++i) size += (offsets[i].size() + indices[i].size()) * sizeof(uint32_t);
+    size += (measures.size() + ids.size() + 1) * sizeof(uint32_t) + idDataSize;
+
+    output.clear();
+    output.reserve(size);
+
+    auto writeUInt32 = [&output](uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8) output.push_back((unsigned char)((value >> shift) & 0xFF));
+    };
+    auto writeFloat64 = [&output](double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        for (int shift = 0; shift < 64; shift += 8) output.push_back((unsigned char)((bits >> shift) & 0xFF));
+    };
+
+    // Header
+    output.insert(output.end(), { 'V', 'T', 'M', '1' });
+    writeUInt32(1);
+    writeUInt32((uint32_t)entryCount);
+    writeUInt32((uint32_t)ids.size());
+    for (int i = 0; i < 4; ++i) writeUInt32((uint32_t)indices[i].size());
+    writeUInt32((uint32_t)idDataSize);
+    writeUInt32(0);
+
+    // Float64 columns
+    for (const auto &entry : m_map) writeFloat64(entry.first);
+    for (const auto &entry : m_map) writeFloat64(entry.second.qstamp);
+    for (double tempo : tempos) writeFloat64(tempo);
+
+    // Uint32 columns
+    for (int i = 0; i < 4; ++i) {
+        for (uint32_t offset : offsets[i]) writeUInt32(offset);
+        for (uint32_t index : indices[i]) writeUInt32(index);
+    }
+    for (uint32_t measure : measures) writeUInt32(measure);
+
+    // ID table
+    uint32_t idOffset = 0;
+    writeUInt32(idOffset);
+    for (const std::string_view &id : ids) {
+        idOffset += (uint32_t)id.size();
+        writeUInt32(idOffset);
+    }
+    for (const std::string_view &id : ids) output.insert(output.end(), id.begin(), id.end());
+
+    assert(output.size() == size);
 }
 
 } // namespace vrv
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 #include <codecvt>
 #include <locale>
@@ -28,6 +29,7 @@
 #include "iomei.h"
 #include "iomusxml.h"
 #include "iopae.h"
+#include "jsonwriter.h"
 #include "layer.h"
 #include "measure.h"
 #include "nc.h"
@@ -40,6 +42,8 @@
 #include "slur.h"
 #include "staff.h"
 #include "svgdevicecontext.h"
+#include "system.h"
+#include "threadpool.h"
 #include "vrv.h"
 
 //----------------------------------------------------------------------------
@@ -57,12 +61,14 @@ namespace vrv {
 const char *UTF_16_BE_BOM = "\xFE\xFF";
 const char *UTF_16_LE_BOM = "\xFF\xFE";
 const char *ZIP_SIGNATURE = "\x50\x4B\x03\x04";
+// The length of the beginning of the data needed for identifying the input format
+const size_t IDENTIFICATION_LENGTH = 2000;
 
 //----------------------------------------------------------------------------
 // Toolkit
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
+thread_local char *Toolkit::m_humdrumBuffer = NULL;
 
 Toolkit::Toolkit(bool initFont)
 {
@@ -81,6 +87,8 @@ Toolkit::Toolkit(bool initFont)
 
     m_editorToolkit = NULL;
 
+    m_isWorker = false;
+
 #ifndef NO_RUNTIME
     m_runtimeClock = NULL;
 #endif
@@ -115,6 +123,8 @@ std::string Toolkit::GetResourcePath() const
 
 bool Toolkit::SetResourcePath(const std::string &path)
 {
+    this->ResetSvgCache();
+
     Resources &resources = m_doc.GetResourcesForModification();
     resources.SetPath(path);
     return resources.InitFonts();
@@ -122,6 +132,8 @@ bool Toolkit::SetResourcePath(const std::string &path)
 
 bool Toolkit::SetFont(const std::string &fontName)
 {
+    this->ResetSvgCache();
+
     Resources &resources = m_doc.GetResourcesForModification();
     const bool ok = resources.SetFont(fontName);
     if (!ok) LogWarning("Font '%s' could not be loaded", fontName.c_str());
@@ -130,6 +142,8 @@ bool Toolkit::SetFont(const std::string &fontName)
 
 bool Toolkit::SetScale(int scale)
 {
+    this->ResetSvgCache();
+
     return m_options->m_scale.SetValue(scale);
 }
 
@@ -304,6 +318,18 @@ bool Toolkit::LoadFile(const std::string &filename)
         return false;
     }
 
+    // MEI files can be streamed without reading the whole content first, unless the ID seed is a checksum of it
+    if (m_options->m_meiStream.GetValue() && !m_options->m_xmlIdChecksum.GetValue()) {
+        std::string initial(IDENTIFICATION_LENGTH, 0);
+        in.read(&initial[0], initial.size());
+        initial.resize((size_t)in.gcount());
+        in.clear();
+        in.seekg(0, std::ios::beg);
+        if (this->GetInputFormat(initial.data(), initial.size()) == MEI) {
+            return this->LoadMEIStream(in);
+        }
+    }
+
     in.seekg(0, std::ios::end);
     std::streamsize fileSize = (std::streamsize)in.tellg();
     in.clear();
@@ -313,6 +339,11 @@ bool Toolkit::LoadFile(const std::string &filename)
     std::string content(fileSize, 0);
     in.read(&content[0], fileSize);
 
+    // The content is not needed afterwards and MEI can be parsed in place
+    if (this->GetInputFormat(content.data(), content.size()) == MEI) {
+        return this->LoadDataBuffer(content.data(), content.size());
+    }
+
     return this->LoadData(content);
 }
 
@@ -463,22 +494,81 @@ bool Toolkit::LoadZipDataBuffer(const unsigned char *data, int length)
     return this->LoadZipData(bytes);
 }
 
-bool Toolkit::LoadData(const std::string &data)
+FileFormat Toolkit::GetInputFormat(const char *data, size_t length)
 {
-    std::string newData;
-    Input *input = NULL;
+    if (m_inputFrom != AUTO) return m_inputFrom;
+
+    // The identification looks only at the beginning of the data
+    return this->IdentifyInputFrom(std::string(data, std::min(length, IDENTIFICATION_LENGTH)));
+}
+
+void Toolkit::ResetForLoading(const char *data, size_t length)
+{
+    this->ResetSvgCache();
+
+    m_doc.GetProfiler().Reset();
 
     m_doc.m_expansionMap.Reset();
 
     if (m_options->m_xmlIdChecksum.GetValue()) {
         crcInit();
-        unsigned int cr = crcFast((unsigned char *)data.c_str(), (int)data.size());
+        unsigned int cr = crcFast((const unsigned char *)data, (int)length);
         Object::SeedID(cr);
     }
 
 #ifndef NO_HUMDRUM_SUPPORT
     this->ClearHumdrumBuffer();
 #endif
+}
+
+bool Toolkit::LoadDataBuffer(char *data, size_t length)
+{
+    if (this->GetInputFormat(data, length) != MEI) {
+        return this->LoadData(std::string(data, length));
+    }
+
+    this->ResetForLoading(data, length);
+    ProfileScope profileScope(m_doc.GetProfiler(), "load");
+
+    MEIInput input(&m_doc);
+    if (!input.ImportBuffer(data, length)) {
+        LogError("Error importing data");
+        return false;
+    }
+    profileScope.Lap("import");
+
+    this->FinalizeLoadedDoc(&input);
+
+    return true;
+}
+
+bool Toolkit::LoadMEIStream(std::istream &stream)
+{
+    // The checksum for the ID seed needs the whole data
+    assert(!m_options->m_xmlIdChecksum.GetValue());
+
+    this->ResetForLoading(NULL, 0);
+    ProfileScope profileScope(m_doc.GetProfiler(), "load");
+
+    MEIInput input(&m_doc);
+    if (!input.ImportStream(stream)) {
+        LogError("Error importing data");
+        return false;
+    }
+    profileScope.Lap("import");
+
+    this->FinalizeLoadedDoc(&input);
+
+    return true;
+}
+
+bool Toolkit::LoadData(const std::string &data)
+{
+    std::string newData;
+    Input *input = NULL;
+
+    this->ResetForLoading(data.c_str(), data.size());
+    ProfileScope profileScope(m_doc.GetProfiler(), "load");
 
     auto inputFormat = m_inputFrom;
     if (inputFormat == AUTO) {
@@ -702,6 +792,18 @@ bool Toolkit::LoadData(const std::string &data)
             return false;
         }
     }
+    profileScope.Lap("import");
+
+    this->FinalizeLoadedDoc(input);
+
+    delete input;
+
+    return true;
+}
+
+void Toolkit::FinalizeLoadedDoc(Input *input)
+{
+    assert(input);
 
     bool adjustPageHeight = m_options->m_adjustPageHeight.GetValue();
     int footerOption = m_options->m_footer.GetValue();
@@ -757,9 +859,7 @@ bool Toolkit::LoadData(const std::string &data)
         if (input->GetLayoutInformation() == LAYOUT_ENCODED
             && (breaks == BREAKS_encoded || breaks == BREAKS_line || breaks == BREAKS_smart)) {
             if (breaks == BREAKS_encoded) {
-                // LogElapsedTimeStart();
                 m_doc.CastOffEncodingDoc();
-                // LogElapsedTimeEnd("layout");
             }
             else if (breaks == BREAKS_line) {
                 m_doc.CastOffLineDoc();
@@ -778,13 +878,10 @@ bool Toolkit::LoadData(const std::string &data)
             else if (breaks == BREAKS_smart) {
                 LogWarning("Requesting layout with smart breaks but nothing provided in the data");
             }
-            // LogElapsedTimeStart();
             m_doc.CastOffDoc();
-            // LogElapsedTimeEnd("cast-off");
         }
     }
 
-    delete input;
     m_view.SetDoc(&m_doc);
 
 #if defined NO_HUMDRUM_SUPPORT
@@ -801,11 +898,17 @@ bool Toolkit::LoadData(const std::string &data)
         default: m_editorToolkit = new EditorToolkitCMN(&m_doc, &m_view);
     }
 #endif
-
-    return true;
 }
 
 std::string Toolkit::GetMEI(const std::string &jsonOptions)
+{
+    std::string output;
+    MEIStringWriter writer(output);
+    if (!this->WriteMEI(writer, jsonOptions)) return "";
+    return output;
+}
+
+bool Toolkit::WriteMEI(pugi::xml_writer &writer, const std::string &jsonOptions)
 {
     bool scoreBased = true;
     bool basic = false;
@@ -843,7 +946,7 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
 
     if (this->GetPageCount() == 0) {
         LogWarning("No data loaded");
-        return "";
+        return false;
     }
 
     int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
@@ -852,7 +955,7 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
     if (m_doc.HasSelection()) {
         if (!scoreBased) {
             LogError("Page-based MEI output is not possible when a selection is set.");
-            return "";
+            return false;
         }
         hadSelection = true;
         m_doc.DeactiveateSelection();
@@ -873,12 +976,12 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
     if (!lastMeasure.empty()) meioutput.SetLastMeasure(lastMeasure);
     if (!mdiv.empty()) meioutput.SetMdiv(mdiv);
 
-    std::string output = meioutput.GetOutput();
+    const bool success = meioutput.Export(writer);
 
     if (hadSelection) m_doc.ReactivateSelection(false);
 
     if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
-    return output;
+    return success;
 }
 
 std::string Toolkit::ValidatePAEFile(const std::string &filename)
@@ -901,21 +1004,35 @@ std::string Toolkit::ValidatePAE(const std::string &data)
 
 bool Toolkit::SaveFile(const std::string &filename, const std::string &jsonOptions)
 {
-    std::string output = this->GetMEI(jsonOptions);
-    if (output.empty()) {
-        return false;
-    }
-
+    // The MEI is streamed to a temporary file that replaces the output file only once it is complete.
+    // This leaves an existing file untouched when the options are invalid or the output fails.
+    const std::string tmpFilename = filename + ".tmp";
     std::ofstream outfile;
-    outfile.open(filename.c_str());
+    outfile.open(tmpFilename.c_str());
 
     if (!outfile.is_open()) {
         LogError("Unable to write MEI to %s", filename.c_str());
         return false;
     }
 
-    outfile << output;
+    pugi::xml_writer_stream writer(outfile);
+    bool success = this->WriteMEI(writer, jsonOptions);
     outfile.close();
+    if (success && outfile.fail()) {
+        LogError("Unable to write MEI to %s", filename.c_str());
+        success = false;
+    }
+
+    if (!success) {
+        std::remove(tmpFilename.c_str());
+        return false;
+    }
+
+    if (!RenameReplacing(tmpFilename, filename)) {
+        LogError("Unable to write MEI to %s", filename.c_str());
+        std::remove(tmpFilename.c_str());
+        return false;
+    }
     return true;
 }
 
@@ -929,6 +1046,112 @@ std::string Toolkit::GetDefaultOptions() const
     return this->GetOptions(true);
 }
 
+void Toolkit::InitSvgDeviceContext(SvgDeviceContext &svg)
+{
+    svg.SetResources(&m_doc.GetResources());
+
+    int indent = (m_options->m_outputIndentTab.GetValue()) ? -1 : m_options->m_outputIndent.GetValue();
+    svg.SetIndent(indent);
+
+    if (m_options->m_mmOutput.GetValue()) {
+        svg.SetMMOutput(true);
+    }
+
+    if (m_doc.GetType() == Facs) {
+        svg.SetFacsimile(true);
+    }
+
+    // set the option to use viewbox on svg root
+    if (m_options->m_svgBoundingBoxes.GetValue()) {
+        svg.SetSvgBoundingBoxes(true);
+    }
+
+    // set the additional CSS if any
+    if (!m_options->m_svgCss.GetValue().empty()) {
+        svg.SetCss(m_options->m_svgCss.GetValue());
+    }
+
+    if (m_options->m_svgViewBox.GetValue()) {
+        svg.SetSvgViewBox(true);
+    }
+
+    svg.SetHtml5(m_options->m_svgHtml5.GetValue());
+    svg.SetFormatRaw(m_options->m_svgFormatRaw.GetValue());
+    svg.SetRemoveXlink(m_options->m_svgRemoveXlink.GetValue());
+    svg.SetAdditionalAttributes(m_options->m_svgAdditionalAttribute.GetValue());
+    svg.SetSmuflTextFont((option_SMUFLTEXTFONT)m_options->m_smuflTextFont.GetValue());
+}
+
+std::string Toolkit::GetSvgCacheKey(int pageNo, bool xmlDeclaration) const
+{
+    // All the options are included in the fingerprint since most of them change the rendering
+    const size_t fingerprint = std::hash<std::string>{}(this->GetOptions(false));
+    return StringFormat("%d-%d-%zu", pageNo, (int)xmlDeclaration, fingerprint);
+}
+
+void Toolkit::AddToSvgCache(const std::string &key, const std::string &svg)
+{
+    m_svgCache.emplace_front(key, svg);
+    m_svgCacheIndex[key] = m_svgCache.begin();
+
+    // Remove the least recently used pages
+    while ((int)m_svgCache.size() > m_options->m_svgCacheSize.GetValue()) {
+        m_svgCacheIndex.erase(m_svgCache.back().first);
+        m_svgCache.pop_back();
+    }
+}
+
+void Toolkit::ResetSvgCache()
+{
+    m_svgCache.clear();
+    m_svgCacheIndex.clear();
+}
+
+Toolkit *Toolkit::CreateWorkerToolkit(FileFormat inputFormat) const
+{
+    Toolkit *toolkit = new Toolkit(false);
+    toolkit->SetResourcePath(this->GetResourcePath());
+    *toolkit->m_options = *m_options;
+    toolkit->SetFont(m_options->m_font.GetValue());
+    toolkit->m_inputFrom = inputFormat;
+    toolkit->m_isWorker = true;
+    return toolkit;
+}
+
+std::vector<std::string> Toolkit::SplitCollection(const std::string &data, FileFormat format) const
+{
+    std::vector<std::string> units;
+
+    if (format == ABC) {
+        // Each tune starts with an X: field, and the lines before the first one are ignored by the importer
+        std::istringstream stream(data);
+        std::string line;
+        while (std::getline(stream, line)) {
+            if (line.rfind("X:", 0) == 0) units.push_back("");
+            if (!units.empty()) units.back() += line + "\n";
+        }
+    }
+    else if (format == HUMDRUM) {
+        // Each segment starts with a !!!!SEGMENT record, and the records before the first one apply to all of them
+        std::istringstream stream(data);
+        std::string line;
+        std::string header;
+        while (std::getline(stream, line)) {
+            if (line.rfind("!!!!SEGMENT", 0) == 0) units.push_back(header);
+            if (units.empty()) {
+                header += line + "\n";
+            }
+            else {
+                units.back() += line + "\n";
+            }
+        }
+    }
+
+    if (units.empty()) units.push_back(data);
+
+    return units;
+}
+
 std::string Toolkit::GetOptions(bool defaultValues) const
 {
     jsonxx::Object o;
@@ -1024,6 +1247,8 @@ std::string Toolkit::GetAvailableOptions() const
 
 bool Toolkit::SetOptions(const std::string &jsonOptions)
 {
+    this->ResetSvgCache();
+
     jsonxx::Object json;
 
     // Read JSON options
@@ -1112,6 +1337,8 @@ bool Toolkit::SetOptions(const std::string &jsonOptions)
 
 void Toolkit::ResetOptions()
 {
+    this->ResetSvgCache();
+
     std::for_each(m_options->GetItems()->begin(), m_options->GetItems()->end(),
         [](const MapOfStrOptions::value_type &opt) { opt.second->Reset(); });
 
@@ -1260,7 +1487,9 @@ std::string Toolkit::GetOptionUsageString() const
 
 std::string Toolkit::GetElementAttr(const std::string &xmlId)
 {
-    jsonxx::Object o;
+    std::string output;
+    JsonWriter writer(output);
+    writer.StartObject();
 
     const Object *element = NULL;
 
@@ -1306,20 +1535,27 @@ std::string Toolkit::GetElementAttr(const std::string &xmlId)
     // If not found at all
     if (!element) {
         LogWarning("Element '%s' not found", xmlId.c_str());
-        return o.json();
+        writer.EndObject();
+        return output;
     }
 
     // Fill the attribute array (pair of std::string) by looking at attributes for all available MEI modules
     ArrayOfStrAttr attributes;
     element->GetAttributes(&attributes);
 
-    // Fill the JSON object
-    ArrayOfStrAttr::iterator iter;
-    for (iter = attributes.begin(); iter != attributes.end(); ++iter) {
-        o << (*iter).first << (*iter).second;
-        // LogInfo("Element %s - %s", (*iter).first.c_str(), (*iter).second.c_str());
+    // Sort the attributes by name, as with jsonxx
+    std::stable_sort(attributes.begin(), attributes.end(),
+        [](const std::pair<std::string, std::string> &a, const std::pair<std::string, std::string> &b) {
+            return (a.first < b.first);
+        });
+
+    // Fill the JSON object - the last value is kept for duplicate names
+    for (auto iter = attributes.begin(); iter != attributes.end(); ++iter) {
+        if ((std::next(iter) != attributes.end()) && (std::next(iter)->first == iter->first)) continue;
+        writer.AddString(iter->first, iter->second);
     }
-    return o.json();
+    writer.EndObject();
+    return output;
 }
 
 std::string Toolkit::GetNotatedIdForElement(const std::string &xmlId)
@@ -1349,6 +1585,7 @@ std::string Toolkit::GetExpansionIdsForElement(const std::string &xmlId)
 bool Toolkit::Edit(const std::string &editorAction)
 {
     this->ResetLogBuffer();
+    this->ResetSvgCache();
 
     return m_editorToolkit->ParseEditorAction(editorAction);
 }
@@ -1367,6 +1604,11 @@ std::string Toolkit::GetLog()
     return str;
 }
 
+std::string Toolkit::GetProfile() const
+{
+    return m_doc.GetProfiler().GetJson();
+}
+
 std::string Toolkit::GetVersion() const
 {
     return vrv::GetVersion();
@@ -1380,7 +1622,10 @@ void Toolkit::ResetXmlIdSeed(int seed)
 
 void Toolkit::ResetLogBuffer()
 {
-    logBuffer.clear();
+    // Other threads can be logging to the buffer
+    if (m_isWorker) return;
+
+    LogBufferClear();
 }
 
 void Toolkit::RedoLayout(const std::string &jsonOptions)
@@ -1400,12 +1645,15 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
     }
 
     this->ResetLogBuffer();
+    this->ResetSvgCache();
 
     if ((this->GetPageCount() == 0) || (m_doc.GetType() == Transcription) || (m_doc.GetType() == Facs)) {
         LogWarning("No data to re-layout");
         return;
     }
 
+    ProfileScope profileScope(m_doc.GetProfiler(), "redoLayout");
+
     if (m_docSelection.m_isPending) {
         m_doc.InitSelectionDoc(m_docSelection, resetCache);
     }
@@ -1413,6 +1661,11 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
         m_doc.UnCastOffDoc(resetCache);
     }
 
+    this->CastOffDocWithBreaks();
+}
+
+void Toolkit::CastOffDocWithBreaks()
+{
     if (m_options->m_breaks.GetValue() == BREAKS_line) {
         m_doc.CastOffLineDoc();
     }
@@ -1430,6 +1683,7 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
 void Toolkit::RedoPagePitchPosLayout()
 {
     this->ResetLogBuffer();
+    this->ResetSvgCache();
 
     Page *page = m_doc.GetDrawingPage();
 
@@ -1506,53 +1760,309 @@ std::string Toolkit::RenderData(const std::string &data, const std::string &json
     return "";
 }
 
+std::string Toolkit::ConvertCollection(const std::string &data, const std::string &jsonOptions)
+{
+    std::string output = "mei";
+    int threadCount = 0;
+
+    jsonxx::Object json;
+
+    // Read JSON options if not empty
+    if (!jsonOptions.empty()) {
+        if (!json.parse(jsonOptions)) {
+            LogWarning("Cannot parse JSON std::string. Using default options.");
+        }
+        else {
+            if (json.has<jsonxx::String>("output")) output = json.get<jsonxx::String>("output");
+            if (json.has<jsonxx::Number>("threads")) threadCount = json.get<jsonxx::Number>("threads");
+        }
+    }
+
+    if ((output != "mei") && (output != "svg") && (output != "midi")) {
+        LogError("Unsupported collection output '%s'", output.c_str());
+        return "";
+    }
+
+    const FileFormat inputFormat = this->GetInputFormat(data.c_str(), data.size());
+    const std::vector<std::string> units = this->SplitCollection(data, inputFormat);
+
+    if (threadCount <= 0) threadCount = ThreadPool::GetHardwareThreadCount();
+    threadCount = std::min(threadCount, (int)units.size());
+
+    // One toolkit for each thread, created here since the resource path is thread local
+    std::vector<Toolkit *> toolkits;
+    for (int i = 0; i < threadCount; ++i) {
+        toolkits.push_back(this->CreateWorkerToolkit(inputFormat));
+    }
+
+    const uint32_t seed = m_options->m_xmlIdSeed.GetValue();
+    // Not a std::vector<bool> since its elements cannot be written from several threads
+    std::vector<char> loaded(units.size(), false);
+    std::vector<std::vector<std::string>> results(units.size());
+
+    {
+        ThreadPool threadPool(threadCount);
+        for (int i = 0; i < threadCount; ++i) {
+            threadPool.Enqueue([&, i]() {
+                Toolkit *toolkit = toolkits.at(i);
+                // Each toolkit converts every threadCount-th unit
+                for (int j = i; j < (int)units.size(); j += threadCount) {
+                    // Deterministic IDs need a seed for each unit since the ID counter is thread local
+                    if (seed != 0) Object::SeedID(seed + j);
+                    if (!toolkit->LoadData(units.at(j))) continue;
+                    loaded.at(j) = true;
+                    if (output == "svg") {
+                        for (int page = 1; page <= toolkit->GetPageCount(); ++page) {
+                            results.at(j).push_back(toolkit->RenderToSVG(page));
+                        }
+                    }
+                    else if (output == "midi") {
+                        results.at(j).push_back(toolkit->RenderToMIDI());
+                    }
+                    else {
+                        results.at(j).push_back(toolkit->GetMEI());
+                    }
+                }
+            });
+        }
+        threadPool.Wait();
+    }
+
+    for (Toolkit *toolkit : toolkits) {
+        delete toolkit;
+    }
+
+    jsonxx::Array collection;
+    for (int j = 0; j < (int)units.size(); ++j) {
+        jsonxx::Object unit;
+        unit << "n" << (j + 1);
+        unit << "loaded" << (bool)loaded.at(j);
+        if (output == "svg") {
+            jsonxx::Array pages;
+            for (const std::string &page : results.at(j)) pages << page;
+            unit << "data" << pages;
+        }
+        else {
+            unit << "data" << (results.at(j).empty() ? "" : results.at(j).front());
+        }
+        collection << unit;
+    }
+
+    return collection.json();
+}
+
 std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
 {
     this->ResetLogBuffer();
 
+    // Rendering a region is not cached
+    const bool useCache = (m_options->m_svgCacheSize.GetValue() > 0) && !m_view.HasClipRect();
+    std::string cacheKey;
+    if (useCache) {
+        cacheKey = this->GetSvgCacheKey(pageNo, xmlDeclaration);
+        auto iter = m_svgCacheIndex.find(cacheKey);
+        if (iter != m_svgCacheIndex.end()) {
+            // Move it to the front as the most recently used
+            m_svgCache.splice(m_svgCache.begin(), m_svgCache, iter->second);
+            return iter->second->second;
+        }
+    }
+
+    ProfileScope profileScope(m_doc.GetProfiler(), "renderToSVG");
+
     int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
     // Create the SVG object, h & w come from the system
     // We will need to set the size of the page after having drawn it depending on the options
     SvgDeviceContext svg;
-    svg.SetResources(&m_doc.GetResources());
+    this->InitSvgDeviceContext(svg);
 
-    int indent = (m_options->m_outputIndentTab.GetValue()) ? -1 : m_options->m_outputIndent.GetValue();
-    svg.SetIndent(indent);
+    // render the page
+    this->RenderToDeviceContext(pageNo, &svg);
 
-    if (m_options->m_mmOutput.GetValue()) {
-        svg.SetMMOutput(true);
+    std::string out_str = svg.GetStringSVG(xmlDeclaration);
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+    if (useCache) this->AddToSvgCache(cacheKey, out_str);
+    return out_str;
+}
+
+std::string Toolkit::RenderToSVGTiles(int pageNo, const std::string &jsonOptions)
+{
+    this->ResetLogBuffer();
+
+    int measureCount = 0;
+
+    jsonxx::Object json;
+
+    // Read JSON options if not empty
+    if (!jsonOptions.empty()) {
+        if (!json.parse(jsonOptions)) {
+            LogWarning("Cannot parse JSON std::string. Using default options.");
+        }
+        else {
+            if (json.has<jsonxx::Number>("measures")) measureCount = json.get<jsonxx::Number>("measures");
+        }
+    }
+
+    if ((pageNo < 1) || (pageNo > this->GetPageCount())) {
+        LogWarning("Page %d does not exist", pageNo);
+        return "";
     }
 
     if (m_doc.GetType() == Facs) {
-        svg.SetFacsimile(true);
+        LogError("Rendering to tiles is not supported for facsimile documents");
+        return "";
     }
 
-    // set the option to use viewbox on svg root
-    if (m_options->m_svgBoundingBoxes.GetValue()) {
-        svg.SetSvgBoundingBoxes(true);
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    // Lay out the page for getting the tiles
+    m_view.SetPage(pageNo - 1);
+    const std::vector<PageRect> rects = m_view.GetTileRects(measureCount);
+
+    // The tiles all refer to the same glyph <defs>
+    const std::string glyphPostfixId = Object::GenerateHashID();
+    std::set<const Glyph *> glyphs;
+
+    jsonxx::Array tiles;
+    for (const PageRect &rect : rects) {
+        SvgDeviceContext svg;
+        this->InitSvgDeviceContext(svg);
+        svg.SetGlyphPostfixId(glyphPostfixId);
+        svg.SetIncludeDefs(false);
+        svg.SetRegion(rect.m_x, rect.m_y, rect.m_width, rect.m_height);
+
+        m_view.SetClipRect(rect.m_x, rect.m_y, rect.m_width, rect.m_height);
+        this->RenderToDeviceContext(pageNo, &svg);
+        m_view.ResetClipRect();
+
+        glyphs.insert(svg.GetSmuflGlyphs().begin(), svg.GetSmuflGlyphs().end());
+
+        jsonxx::Object tile;
+        tile << "x" << rect.m_x;
+        tile << "y" << rect.m_y;
+        tile << "width" << rect.m_width;
+        tile << "height" << rect.m_height;
+        tile << "svg" << svg.GetStringSVG();
+        tiles << tile;
     }
 
-    // set the additional CSS if any
-    if (!m_options->m_svgCss.GetValue().empty()) {
-        svg.SetCss(m_options->m_svgCss.GetValue());
+    SvgDeviceContext defsSvg;
+    this->InitSvgDeviceContext(defsSvg);
+    defsSvg.SetGlyphPostfixId(glyphPostfixId);
+
+    jsonxx::Object o;
+    o << "defs" << defsSvg.GetStringDefs(glyphs);
+    o << "tiles" << tiles;
+
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+    return o.json();
+}
+
+std::string Toolkit::RenderExcerptToSVG(const std::string &jsonSelection, int pageNo)
+{
+    this->ResetLogBuffer();
+
+    if ((m_doc.GetType() != Raw) || m_doc.HasSelection()) {
+        LogError("Excerpts can be rendered only for documents without a selection and without a facsimile");
+        return "";
+    }
+    if (m_doc.IsMensuralMusicOnly()) {
+        LogError("Excerpts cannot be rendered for mensural music");
+        return "";
     }
 
-    if (m_options->m_svgViewBox.GetValue()) {
-        svg.SetSvgViewBox(true);
+    ListOfObjects measures = m_doc.FindAllDescendantsByType(MEASURE, false);
+    std::vector<std::string> svgs;
+    if (!this->RenderExcerpt(jsonSelection, measures, pageNo, svgs) || svgs.empty()) return "";
+
+    return svgs.front();
+}
+
+std::string Toolkit::RenderExcerptsToSVG(const std::string &jsonOptions)
+{
+    jsonxx::Array excerpts;
+
+    jsonxx::Object json;
+
+    // Read JSON options
+    if (!json.parse(jsonOptions)) {
+        LogError("Cannot parse JSON std::string.");
+        return "";
     }
+    if (json.has<jsonxx::Array>("excerpts")) excerpts = json.get<jsonxx::Array>("excerpts");
 
-    svg.SetHtml5(m_options->m_svgHtml5.GetValue());
-    svg.SetFormatRaw(m_options->m_svgFormatRaw.GetValue());
-    svg.SetRemoveXlink(m_options->m_svgRemoveXlink.GetValue());
-    svg.SetAdditionalAttributes(m_options->m_svgAdditionalAttribute.GetValue());
-    svg.SetSmuflTextFont((option_SMUFLTEXTFONT)m_options->m_smuflTextFont.GetValue());
+    this->ResetLogBuffer();
 
-    // render the page
-    this->RenderToDeviceContext(pageNo, &svg);
+    if ((m_doc.GetType() != Raw) || m_doc.HasSelection()) {
+        LogError("Excerpts can be rendered only for documents without a selection and without a facsimile");
+        return "";
+    }
+    if (m_doc.IsMensuralMusicOnly()) {
+        LogError("Excerpts cannot be rendered for mensural music");
+        return "";
+    }
 
-    std::string out_str = svg.GetStringSVG(xmlDeclaration);
+    ListOfObjects measures = m_doc.FindAllDescendantsByType(MEASURE, false);
+    jsonxx::Array output;
+    for (int j = 0; j < (int)excerpts.size(); ++j) {
+        std::vector<std::string> svgs;
+        const bool loaded = excerpts.has<jsonxx::Object>(j)
+            && this->RenderExcerpt(excerpts.get<jsonxx::Object>(j).json(), measures, 0, svgs);
+        jsonxx::Object excerpt;
+        excerpt << "n" << (j + 1);
+        excerpt << "loaded" << loaded;
+        jsonxx::Array pages;
+        for (const std::string &page : svgs) pages << page;
+        excerpt << "data" << pages;
+        output << excerpt;
+    }
+
+    return output.json();
+}
+
+bool Toolkit::RenderExcerpt(
+    const std::string &jsonSelection, const ListOfObjects &measures, int pageNo, std::vector<std::string> &svgs)
+{
+    DocSelection selection;
+    if (!selection.Parse(jsonSelection)) return false;
+
+    std::string startId;
+    std::string endId;
+    if (!selection.GetRangeIds(measures, startId, endId)) {
+        LogError("The excerpt could not be found");
+        return false;
+    }
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    if (!m_doc.InitExcerptDoc(startId, endId)) return false;
+
+    this->CastOffDocWithBreaks();
+
+    for (int page = 1; page <= this->GetPageCount(); ++page) {
+        if ((pageNo > 0) && (page != pageNo)) continue;
+        // Not RenderToSVG since the pages of the excerpt cannot be cached
+        SvgDeviceContext svg;
+        this->InitSvgDeviceContext(svg);
+        this->RenderToDeviceContext(page, &svg);
+        svgs.push_back(svg.GetStringSVG(false));
+    }
+    if ((pageNo > 0) && svgs.empty()) LogWarning("Page %d of the excerpt does not exist", pageNo);
+
+    m_doc.ResetExcerptDoc();
     if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
-    return out_str;
+
+    return true;
+}
+
+std::string Toolkit::RenderToSVGRegion(int pageNo, int x, int y, int width, int height, bool xmlDeclaration)
+{
+    m_view.SetClipRect(x, y, width, height);
+    std::string output = this->RenderToSVG(pageNo, xmlDeclaration);
+    m_view.ResetClipRect();
+
+    return output;
 }
 
 bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
@@ -1574,6 +2084,103 @@ bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
     return true;
 }
 
+bool Toolkit::RenderToSVGFiles(const std::string &filename, int fromPage, int toPage, int threadCount)
+{
+    this->ResetLogBuffer();
+
+    if ((fromPage < 1) || (toPage > this->GetPageCount()) || (fromPage > toPage)) {
+        LogError("Page range %d-%d is not in the document", fromPage, toPage);
+        return false;
+    }
+
+    // Endings and expansions are not read back from page-based MEI, and it cannot be written with a selection
+    if (m_doc.HasSelection() || m_doc.FindDescendantByType(ENDING) || m_doc.FindDescendantByType(EXPANSION)) {
+        bool success = true;
+        for (int pageNo = fromPage; pageNo <= toPage; ++pageNo) {
+            const std::string pageFilename = StringFormat("%s_%03d.svg", filename.c_str(), pageNo);
+            if (this->RenderToSVGFile(pageFilename, pageNo)) continue;
+            LogError("Unable to write SVG for page %d", pageNo);
+            success = false;
+        }
+        return success;
+    }
+
+    // The page-based MEI keeps the layout and the IDs of the document
+    jsonxx::Object meiOptions;
+    meiOptions << "scoreBased" << false;
+    meiOptions << "removeIds" << false;
+    const std::string mei = this->GetMEI(meiOptions.json());
+    if (mei.empty()) return false;
+
+    // The cast-off widths of the systems are not in the MEI but are needed for laying out the pages again
+    std::vector<std::pair<int, int>> castOffWidths;
+    for (const Object *object : m_doc.FindAllDescendantsByType(SYSTEM, false)) {
+        const System *system = vrv_cast<const System *>(object);
+        castOffWidths.push_back({ system->m_castOffTotalWidth, system->m_castOffJustifiableWidth });
+    }
+
+    const int pageCount = toPage - fromPage + 1;
+    if (threadCount <= 0) threadCount = ThreadPool::GetHardwareThreadCount();
+    threadCount = std::max(1, std::min(threadCount, pageCount));
+
+    // One toolkit for each thread, created here since the resource path is thread local
+    std::vector<Toolkit *> toolkits;
+    for (int i = 0; i < threadCount; ++i) {
+        Toolkit *toolkit = this->CreateWorkerToolkit(MEI);
+        // The MEI is already transposed and expanded
+        toolkit->m_options->m_transpose.Reset();
+        toolkit->m_options->m_transposeMdiv.Reset();
+        toolkit->m_options->m_transposeToSoundingPitch.Reset();
+        toolkit->m_options->m_expand.Reset();
+        toolkits.push_back(toolkit);
+    }
+
+    const uint32_t seed = m_options->m_xmlIdSeed.GetValue();
+    // Not a std::vector<bool> since its elements cannot be written from several threads
+    std::vector<char> written(pageCount, false);
+
+    {
+        ThreadPool threadPool(threadCount);
+        for (int i = 0; i < threadCount; ++i) {
+            threadPool.Enqueue([&, i]() {
+                Toolkit *toolkit = toolkits.at(i);
+                // Deterministic IDs need a seed for loading and for each page since the ID counter is thread local
+                if (seed != 0) Object::SeedID(seed);
+                if (!toolkit->LoadData(mei)) return;
+                ListOfObjects systems = toolkit->m_doc.FindAllDescendantsByType(SYSTEM, false);
+                if (systems.size() != castOffWidths.size()) return;
+                int k = 0;
+                for (Object *object : systems) {
+                    System *system = vrv_cast<System *>(object);
+                    std::tie(system->m_castOffTotalWidth, system->m_castOffJustifiableWidth) = castOffWidths.at(k++);
+                }
+                // Otherwise done when rendering the first page of the toolkit, with IDs depending on the page
+                toolkit->m_doc.ScoreDefSetCurrentDoc();
+                // Each toolkit renders every threadCount-th page
+                for (int j = i; j < pageCount; j += threadCount) {
+                    const int pageNo = fromPage + j;
+                    if (seed != 0) Object::SeedID(seed + pageNo);
+                    const std::string pageFilename = StringFormat("%s_%03d.svg", filename.c_str(), pageNo);
+                    written.at(j) = toolkit->RenderToSVGFile(pageFilename, pageNo);
+                }
+            });
+        }
+        threadPool.Wait();
+    }
+
+    for (Toolkit *toolkit : toolkits) {
+        delete toolkit;
+    }
+
+    bool success = true;
+    for (int j = 0; j < pageCount; ++j) {
+        if (written.at(j)) continue;
+        LogError("Unable to write SVG for page %d", fromPage + j);
+        success = false;
+    }
+    return success;
+}
+
 std::string Toolkit::GetHumdrum()
 {
     return this->GetHumdrumBuffer();
@@ -1603,6 +2210,8 @@ std::string Toolkit::RenderToMIDI()
 {
     this->ResetLogBuffer();
 
+    ProfileScope profileScope(m_doc.GetProfiler(), "renderToMIDI");
+
     smf::MidiFile outputfile;
     outputfile.absoluteTicks();
     m_doc.ExportMIDI(&outputfile);
@@ -1652,7 +2261,32 @@ std::string Toolkit::RenderToTimemap(const std::string &jsonOptions)
 {
     bool includeMeasures = false;
     bool includeRests = false;
+    this->ParseTimemapOptions(jsonOptions, includeRests, includeMeasures);
+
+    this->ResetLogBuffer();
+
+    ProfileScope profileScope(m_doc.GetProfiler(), "renderToTimemap");
+
+    std::string output;
+    m_doc.ExportTimemap(output, includeRests, includeMeasures);
+    return output;
+}
+
+std::vector<unsigned char> Toolkit::RenderToTimemapBuffer(const std::string &jsonOptions)
+{
+    bool includeMeasures = false;
+    bool includeRests = false;
+    this->ParseTimemapOptions(jsonOptions, includeRests, includeMeasures);
+
+    this->ResetLogBuffer();
 
+    std::vector<unsigned char> output;
+    m_doc.ExportTimemapBuffer(output, includeRests, includeMeasures);
+    return output;
+}
+
+void Toolkit::ParseTimemapOptions(const std::string &jsonOptions, bool &includeRests, bool &includeMeasures)
+{
     jsonxx::Object json;
 
     // Read JSON options if not empty
@@ -1666,12 +2300,6 @@ std::string Toolkit::RenderToTimemap(const std::string &jsonOptions)
             if (json.has<jsonxx::Boolean>("includeRests")) includeRests = json.get<jsonxx::Boolean>("includeRests");
         }
     }
-
-    this->ResetLogBuffer();
-
-    std::string output;
-    m_doc.ExportTimemap(output, includeRests, includeMeasures);
-    return output;
 }
 
 std::string Toolkit::RenderToExpansionMap()
@@ -2002,6 +2630,17 @@ void Toolkit::SetCString(const std::string &data)
     strcpy(m_cString, data.c_str());
 }
 
+void Toolkit::SetCBuffer(std::vector<unsigned char> data)
+{
+    m_cBuffer = std::move(data);
+}
+
+const unsigned char *Toolkit::GetCBuffer(int *length)
+{
+    if (length) *length = (int)m_cBuffer.size();
+    return m_cBuffer.data();
+}
+
 const char *Toolkit::GetCString()
 {
     if (m_cString) {
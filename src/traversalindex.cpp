@@ -0,0 +1,161 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        traversalindex.cpp
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "traversalindex.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+//----------------------------------------------------------------------------
+
+#include "object.h"
+#include "score.h"
+#include "vrv.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// TraversalIndex
+//----------------------------------------------------------------------------
+
+TraversalIndex::TraversalIndex() {}
+
+void TraversalIndex::Build(Object *root)
+{
+    assert(root);
+
+    this->Reset();
+
+    BuildTraversalIndexFunctor buildTraversalIndex(this);
+    root->Process(buildTraversalIndex);
+}
+
+void TraversalIndex::Reset()
+{
+    m_entries.clear();
+    m_indicesByClassId.clear();
+}
+
+int TraversalIndex::AddEntry(Object *object)
+{
+    const int idx = (int)m_entries.size();
+    m_entries.push_back({ object, idx + 1 });
+    m_indicesByClassId[object->GetClassId()].push_back(idx);
+    return idx;
+}
+
+void TraversalIndex::SetSubtreeEnd(int idx)
+{
+    m_entries.at(idx).m_subtreeEnd = (int)m_entries.size();
+}
+
+std::vector<int> TraversalIndex::GetIndices(const ClassIdMask &classIds) const
+{
+    std::vector<int> indices;
+    std::vector<int> merged;
+
+    for (const auto &[classId, classIndices] : m_indicesByClassId) {
+        if (!classIds.test(classId)) continue;
+        // Each list is already sorted since the entries are added in pre-order
+        merged.clear();
+        merged.reserve(indices.size() + classIndices.size());
+        std::merge(indices.begin(), indices.end(), classIndices.begin(), classIndices.end(), std::back_inserter(merged));
+        indices.swap(merged);
+    }
+
+    return indices;
+}
+
+void TraversalIndex::Process(Functor &functor)
+{
+    // Only functors with visited classes can be processed
+    assert(functor.HasVisitedClassIds());
+    // Processing backward, with filters or with hidden elements is not supported
+    assert(functor.GetDirection() == FORWARD);
+    assert(!functor.GetFilters());
+    assert(functor.VisibleOnly());
+
+    if (functor.GetCode() == FUNCTOR_STOP) return;
+
+    const std::vector<int> indices = this->GetIndices(functor.GetVisitedClassIds());
+    const bool implementsEnd = functor.ImplementsEndInterface();
+
+    // The entries visited with their subtree still open, for calling AcceptEnd
+    std::vector<int> openEntries;
+    // The objects before this index are skipped because a functor returned FUNCTOR_SIBLINGS
+    int skipUntil = 0;
+
+    for (int idx : indices) {
+        if (idx < skipUntil) continue;
+
+        // Close the subtrees ending before this entry
+        while (!openEntries.empty() && (m_entries.at(openEntries.back()).m_subtreeEnd <= idx)) {
+            functor.SetCode(m_entries.at(openEntries.back()).m_object->AcceptEnd(functor));
+            openEntries.pop_back();
+        }
+
+        Object *object = m_entries.at(idx).m_object;
+        if (object->Is(SCORE)) {
+            // Same as Object::UpdateDocumentScore
+            Score *score = vrv_cast<Score *>(object);
+            assert(score);
+            score->SetAsCurrent();
+        }
+
+        const FunctorCode code = object->Accept(functor);
+        functor.SetCode(code);
+
+        if (code == FUNCTOR_STOP) {
+            if (implementsEnd) openEntries.push_back(idx);
+            break;
+        }
+        else if (code == FUNCTOR_SIBLINGS) {
+            functor.SetCode(FUNCTOR_CONTINUE);
+            skipUntil = m_entries.at(idx).m_subtreeEnd;
+        }
+        else if (implementsEnd) {
+            openEntries.push_back(idx);
+        }
+    }
+
+    // Close the remaining subtrees
+    while (!openEntries.empty()) {
+        functor.SetCode(m_entries.at(openEntries.back()).m_object->AcceptEnd(functor));
+        openEntries.pop_back();
+    }
+}
+
+//----------------------------------------------------------------------------
+// BuildTraversalIndexFunctor
+//----------------------------------------------------------------------------
+
+BuildTraversalIndexFunctor::BuildTraversalIndexFunctor(TraversalIndex *traversalIndex) : Functor()
+{
+    m_traversalIndex = traversalIndex;
+}
+
+FunctorCode BuildTraversalIndexFunctor::VisitObject(Object *object)
+{
+    m_openEntries.push_back(m_traversalIndex->AddEntry(object));
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode BuildTraversalIndexFunctor::VisitObjectEnd(Object *object)
+{
+    assert(!m_openEntries.empty());
+
+    m_traversalIndex->SetSubtreeEnd(m_openEntries.back());
+    m_openEntries.pop_back();
+
+    return FUNCTOR_CONTINUE;
+}
+
+} // namespace vrv
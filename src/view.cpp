@@ -30,6 +30,11 @@ View::View()
     m_options = NULL;
     m_pageIdx = 0;
     m_slurHandling = SlurHandling::Initialize;
+    m_hasClipRect = false;
+    m_clipLeft = 0;
+    m_clipTop = 0;
+    m_clipRight = 0;
+    m_clipBottom = 0;
 
     m_currentColor = AxNONE;
     m_currentElement = NULL;
@@ -99,6 +99,11 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
         }
         else if (child->Is(SYSTEM)) {
             System *system = dynamic_cast<System *>(child);
+            // Skip the system if it is outside the clip rectangle, horizontally including the whole page
+            const auto [top, bottom] = this->GetSystemExtent(system);
+            if (this->IsOutsideClipRect(-m_doc->m_drawingPageMarginLeft, top, m_doc->m_drawingPageWidth, bottom)) {
+                continue;
+            }
             this->DrawSystem(dc, system);
         }
         else {
@@ -113,6 +118,81 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     if (!dcHasResources) dc->ResetResources();
 }
 
+void View::SetClipRect(int x, int y, int width, int height)
+{
+    m_hasClipRect = true;
+    m_clipLeft = x;
+    m_clipTop = y;
+    m_clipRight = x + width;
+    m_clipBottom = y + height;
+}
+
+bool View::IsOutsideClipRect(int left, int top, int right, int bottom) const
+{
+    if (!m_hasClipRect || (m_doc->GetType() == Facs)) return false;
+
+    // Convert to page coordinates - see DrawCurrentPage and ToDeviceContextY
+    const int pageLeft = left + m_doc->m_drawingPageMarginLeft;
+    const int pageRight = right + m_doc->m_drawingPageMarginLeft;
+    const int pageTop = m_doc->m_drawingPageMarginTop + m_doc->m_drawingPageContentHeight - top;
+    const int pageBottom = m_doc->m_drawingPageMarginTop + m_doc->m_drawingPageContentHeight - bottom;
+
+    return ((pageRight < m_clipLeft) || (pageLeft > m_clipRight) || (pageBottom < m_clipTop)
+        || (pageTop > m_clipBottom));
+}
+
+std::pair<int, int> View::GetSystemExtent(const System *system) const
+{
+    assert(system);
+
+    const int top = system->GetDrawingY() + system->m_systemAligner.GetOverflowAbove(m_doc);
+    const int bottom = system->GetDrawingY() - system->GetHeight() - system->m_systemAligner.GetOverflowBelow(m_doc);
+    return { top, bottom };
+}
+
+std::vector<PageRect> View::GetTileRects(int measureCount) const
+{
+    std::vector<PageRect> rects;
+    if (!m_currentPage) return rects;
+
+    const int pageWidth = m_doc->m_drawingPageWidth;
+    const int pageHeight = m_doc->m_drawingPageMarginTop + m_doc->m_drawingPageContentHeight;
+    // Convert from logical to page coordinates - see IsOutsideClipRect
+    auto toPageY = [this](int y) { return m_doc->m_drawingPageMarginTop + m_doc->m_drawingPageContentHeight - y; };
+    auto toPageX = [this](int x) { return m_doc->m_drawingPageMarginLeft + x; };
+
+    const Page *page = m_currentPage;
+    ListOfConstObjects systems = page->FindAllDescendantsByType(SYSTEM, false, 1);
+    for (const Object *object : systems) {
+        const System *system = vrv_cast<const System *>(object);
+        assert(system);
+        const auto [top, bottom] = this->GetSystemExtent(system);
+        const int y = (system == systems.front()) ? 0 : toPageY(top);
+        const int height = ((system == systems.back()) ? pageHeight : toPageY(bottom)) - y;
+
+        if (measureCount <= 0) {
+            rects.push_back({ 0, y, pageWidth, height });
+            continue;
+        }
+
+        ListOfConstObjects measures = system->FindAllDescendantsByType(MEASURE, false);
+        int count = 0;
+        int x = 0;
+        for (const Object *child : measures) {
+            const Measure *measure = vrv_cast<const Measure *>(child);
+            assert(measure);
+            if ((++count < measureCount) && (measure != measures.back())) continue;
+            const int right
+                = (measure == measures.back()) ? pageWidth : toPageX(measure->GetDrawingX() + measure->GetWidth());
+            rects.push_back({ x, y, right - x, height });
+            x = right;
+            count = 0;
+        }
+    }
+
+    return rects;
+}
+
 double View::GetPPUFactor() const
 {
     if (!m_currentPage) return 1.0;
@@ -1236,6 +1316,22 @@ void View::DrawStaff(DeviceContext *dc, Staff *staff, Measure *measure, System *
         return;
     }
 
+    // Skip the staff if it is outside the clip rectangle, with a margin for content overflowing the measure
+    const StaffAlignment *alignment = staff->GetAlignment();
+    if (alignment && this->HasClipRect()) {
+        const int margin = 2 * m_doc->GetDrawingDoubleUnit(staff->m_drawingStaffSize);
+        const int top = staff->GetDrawingY() + alignment->GetOverflowAbove();
+        const int bottom = staff->GetDrawingY() - alignment->GetStaffHeight() - alignment->GetOverflowBelow();
+        if (this->IsOutsideClipRect(measure->GetDrawingX() - margin, top,
+                measure->GetDrawingX() + measure->GetWidth() + margin, bottom)) {
+            // The spanning elements are drawn at the system level and can extend into the clip rectangle
+            for (Object *spanningElement : staff->m_timeSpanningElements) {
+                system->AddToDrawingListIfNecessary(spanningElement);
+            }
+            return;
+        }
+    }
+
     dc->StartGraphic(staff, "", staff->GetID());
 
     if (m_doc->GetType() == Facs) {
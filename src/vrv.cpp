@@ -41,6 +41,10 @@
 
 #include "vrvdef.h"
 
+#ifndef NO_THREAD_SUPPORT
+#include <mutex>
+#endif
+
 //----------------------------------------------------------------------------
 
 #ifdef __EMSCRIPTEN__
@@ -71,6 +75,11 @@ bool loggingToBuffer = false;
 
 std::vector<std::string> logBuffer;
 
+#ifndef NO_THREAD_SUPPORT
+/** For logging from several threads */
+std::mutex logMutex;
+#endif
+
 void LogElapsedTimeStart()
 {
     gettimeofday(&start, NULL);
@@ -138,6 +147,9 @@ void LogWarning(const char *fmt, ...)
 
 void LogString(std::string message, LogLevel level)
 {
+#ifndef NO_THREAD_SUPPORT
+    std::lock_guard<std::mutex> lock(logMutex);
+#endif
     if (loggingToBuffer) {
         if (LogBufferContains(message)) return;
         logBuffer.push_back(message);
@@ -177,6 +189,14 @@ LogLevel StrToLogLevel(const std::string &level)
     return LOG_WARNING;
 }
 
+void LogBufferClear()
+{
+#ifndef NO_THREAD_SUPPORT
+    std::lock_guard<std::mutex> lock(logMutex);
+#endif
+    logBuffer.clear();
+}
+
 bool LogBufferContains(const std::string &s)
 {
     for (const std::string &logStr : logBuffer) {
@@ -294,6 +314,17 @@ std::string GetFilename(std::string &fullpath)
     return name;
 }
 
+bool RenameReplacing(const std::string &from, const std::string &to)
+{
+#ifndef _WIN32
+    // Replaces the target atomically
+    return (std::rename(from.c_str(), to.c_str()) == 0);
+#else
+    // std::rename fails when the target exists
+    return (MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0);
+#endif
+}
+
 std::string GetVersion()
 {
     std::string dev;
@@ -0,0 +1,469 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        benchmark.cpp
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <getopt.h>
+#else
+#include "win_dirent.h"
+#include "win_getopt.h"
+#endif
+
+//----------------------------------------------------------------------------
+
+#include "jsonwriter.h"
+#include "jsonxx.h"
+#include "options.h"
+#include "toolkit.h"
+#include "vrv.h"
+
+//----------------------------------------------------------------------------
+// Allocation counting
+//----------------------------------------------------------------------------
+
+// The global allocation functions are replaced for counting the allocations of each stage
+static std::atomic<uint64_t> s_allocationCount(0);
+static std::atomic<uint64_t> s_allocationBytes(0);
+
+void *operator new(std::size_t size)
+{
+    ++s_allocationCount;
+    s_allocationBytes += size;
+    void *ptr = std::malloc((size > 0) ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t size) noexcept
+{
+    std::free(ptr);
+}
+
+//----------------------------------------------------------------------------
+// Stages
+//----------------------------------------------------------------------------
+
+// The stages in the order they are run
+// - load: import and data preparation (loaded with --breaks none)
+// - layout: cast-off and layout of the pages (Toolkit::RedoLayout with the breaks option)
+// - svg: rendering of all the pages
+// - midi, timemap, mei: the corresponding output
+// Except for mei, each stage is broken down into the sub-stages recorded by the toolkit profile
+static const std::vector<std::string> k_stages = { "load", "layout", "svg", "midi", "timemap", "mei" };
+// The corresponding stages of the toolkit profile, from which the breakdown of each stage is read
+static const std::vector<std::string> k_profileStages
+    = { "load", "redoLayout", "renderToSVG", "renderToMIDI", "renderToTimemap", "" };
+
+struct StageResult {
+    std::vector<double> m_times;
+    uint64_t m_allocations = 0;
+    uint64_t m_bytes = 0;
+    // The times of the sub-stages (e.g., "import" or "castOff/layOutHorizontally") in the order they are run
+    std::vector<std::pair<std::string, StageResult>> m_breakdown;
+
+    double GetMin() const { return (m_times.empty()) ? 0.0 : *std::min_element(m_times.begin(), m_times.end()); }
+    double GetMax() const { return (m_times.empty()) ? 0.0 : *std::max_element(m_times.begin(), m_times.end()); }
+    double GetMean() const
+    {
+        if (m_times.empty()) return 0.0;
+        double sum = 0.0;
+        for (double time : m_times) sum += time;
+        return sum / m_times.size();
+    }
+
+    StageResult &GetBreakdown(const std::string &name)
+    {
+        for (auto &[subStage, result] : m_breakdown) {
+            if (subStage == name) return result;
+        }
+        m_breakdown.emplace_back(name, StageResult());
+        return m_breakdown.back().second;
+    }
+};
+
+struct FileResult {
+    std::string m_filename;
+    bool m_loaded = false;
+    int m_pageCount = 0;
+    std::vector<StageResult> m_stages = std::vector<StageResult>(k_stages.size());
+};
+
+//----------------------------------------------------------------------------
+// Helpers
+//----------------------------------------------------------------------------
+
+bool is_dir(const std::string &path)
+{
+    struct stat st;
+    return ((stat(path.c_str(), &st) == 0) && (((st.st_mode) & S_IFMT) == S_IFDIR));
+}
+
+bool is_file(const std::string &path)
+{
+    struct stat st;
+    return ((stat(path.c_str(), &st) == 0) && (((st.st_mode) & S_IFMT) == S_IFREG));
+}
+
+// List the files of a directory recursively (without hidden files) in alphabetical order
+void list_files(const std::string &dir, std::vector<std::string> &files)
+{
+    DIR *dp = opendir(dir.c_str());
+    if (!dp) return;
+    std::vector<std::string> entries;
+    for (struct dirent *entry = readdir(dp); entry; entry = readdir(dp)) {
+        const std::string name = entry->d_name;
+        if (name.empty() || (name.at(0) == '.')) continue;
+        entries.push_back(dir + "/" + name);
+    }
+    closedir(dp);
+    std::sort(entries.begin(), entries.end());
+    for (const std::string &entry : entries) {
+        if (is_dir(entry)) {
+            list_files(entry, files);
+        }
+        else if (is_file(entry)) {
+            files.push_back(entry);
+        }
+    }
+}
+
+bool read_file(const std::string &filename, std::string &data)
+{
+    std::ifstream instream(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!instream.is_open()) return false;
+    std::stringstream buffer;
+    buffer << instream.rdbuf();
+    data = buffer.str();
+    return true;
+}
+
+// Run a stage and add its time (in milliseconds) and its allocations to the result
+template <typename Function> void run_stage(StageResult &result, bool measured, Function function)
+{
+    const uint64_t allocationCount = s_allocationCount;
+    const uint64_t allocationBytes = s_allocationBytes;
+    const auto start = std::chrono::steady_clock::now();
+
+    function();
+
+    const auto end = std::chrono::steady_clock::now();
+    if (!measured) return;
+    result.m_times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    // The allocations are the same for each iteration, keep the ones of the last one
+    result.m_allocations = s_allocationCount - allocationCount;
+    result.m_bytes = s_allocationBytes - allocationBytes;
+}
+
+// Add the times of the sub-stages of a profile stage, and of their own sub-stages, to the breakdown of a result
+void add_breakdown(StageResult &result, const jsonxx::Array &stages, const std::string &prefix, int depth)
+{
+    for (int i = 0; i < (int)stages.size(); ++i) {
+        if (!stages.has<jsonxx::Object>(i)) continue;
+        const jsonxx::Object &stage = stages.get<jsonxx::Object>(i);
+        const std::string name = prefix + stage.get<jsonxx::String>("name", "");
+        result.GetBreakdown(name).m_times.push_back(stage.get<jsonxx::Number>("time", 0.0));
+        if ((depth > 1) && stage.has<jsonxx::Array>("stages")) {
+            add_breakdown(result, stage.get<jsonxx::Array>("stages"), name + "/", depth - 1);
+        }
+    }
+}
+
+// Read the breakdown of the stages from the toolkit profile, which covers the stages since the data was loaded
+void read_profile(FileResult &result, const std::string &profile, const std::vector<bool> &enabled)
+{
+    jsonxx::Object json;
+    if (!json.parse(profile) || !json.has<jsonxx::Array>("stages")) return;
+    const jsonxx::Array &stages = json.get<jsonxx::Array>("stages");
+    for (int i = 0; i < (int)stages.size(); ++i) {
+        if (!stages.has<jsonxx::Object>(i)) continue;
+        const jsonxx::Object &stage = stages.get<jsonxx::Object>(i);
+        auto it = std::find(k_profileStages.begin(), k_profileStages.end(), stage.get<jsonxx::String>("name", ""));
+        if ((it == k_profileStages.end()) || !enabled.at(it - k_profileStages.begin())) continue;
+        if (!stage.has<jsonxx::Array>("stages")) continue;
+        add_breakdown(result.m_stages.at(it - k_profileStages.begin()), stage.get<jsonxx::Array>("stages"), "", 2);
+    }
+}
+
+FileResult benchmark_file(vrv::Toolkit &toolkit, const std::string &filename, const std::string &breaks,
+    const std::vector<bool> &enabled, int iterations, int warmup)
+{
+    FileResult result;
+    result.m_filename = filename;
+
+    std::string data;
+    if (!read_file(filename, data)) return result;
+
+    for (int i = 0; i < warmup + iterations; ++i) {
+        const bool measured = (i >= warmup);
+
+        // The layout is measured separately
+        toolkit.SetOptions("{\"breaks\": \"none\"}");
+        bool loaded = false;
+        run_stage(result.m_stages.at(0), measured, [&]() { loaded = toolkit.LoadData(data); });
+        if (!loaded) return result;
+        result.m_loaded = true;
+
+        toolkit.SetOptions(vrv::StringFormat("{\"breaks\": \"%s\"}", breaks.c_str()));
+        if (enabled.at(1)) {
+            run_stage(result.m_stages.at(1), measured, [&]() { toolkit.RedoLayout(); });
+        }
+        result.m_pageCount = toolkit.GetPageCount();
+
+        if (enabled.at(2)) {
+            run_stage(result.m_stages.at(2), measured, [&]() {
+                for (int page = 1; page <= toolkit.GetPageCount(); ++page) toolkit.RenderToSVG(page);
+            });
+        }
+        if (enabled.at(3)) {
+            run_stage(result.m_stages.at(3), measured, [&]() { toolkit.RenderToMIDI(); });
+        }
+        if (enabled.at(4)) {
+            run_stage(result.m_stages.at(4), measured, [&]() { toolkit.RenderToTimemap(); });
+        }
+        if (enabled.at(5)) {
+            run_stage(result.m_stages.at(5), measured, [&]() { toolkit.GetMEI(); });
+        }
+
+        // The profile is reset when loading the data, so it holds the stages of this iteration
+        if (measured) read_profile(result, toolkit.GetProfile(), enabled);
+    }
+
+    return result;
+}
+
+void write_json(const std::vector<FileResult> &results, const std::vector<bool> &enabled, int iterations,
+    const std::string &toolkitOptions, std::string &output)
+{
+    vrv::JsonWriter writer(output);
+    writer.StartObject();
+    writer.StartArray("files");
+    for (const FileResult &result : results) {
+        writer.StartObject();
+        writer.AddString("file", result.m_filename);
+        writer.AddBool("loaded", result.m_loaded);
+        writer.AddNumber("pageCount", result.m_pageCount);
+        writer.StartObject("stages");
+        for (int i = 0; i < (int)k_stages.size(); ++i) {
+            if (!enabled.at(i) || !result.m_loaded) continue;
+            const StageResult &stage = result.m_stages.at(i);
+            writer.StartObject(k_stages.at(i));
+            writer.AddNumber("allocationBytes", (double)stage.m_bytes);
+            writer.AddNumber("allocations", (double)stage.m_allocations);
+            writer.StartObject("breakdown");
+            for (const auto &[subStage, subStageResult] : stage.m_breakdown) {
+                writer.StartObject(subStage);
+                writer.AddNumber("max", subStageResult.GetMax());
+                writer.AddNumber("mean", subStageResult.GetMean());
+                writer.AddNumber("min", subStageResult.GetMin());
+                writer.EndObject();
+            }
+            writer.EndObject();
+            writer.AddNumber("max", stage.GetMax());
+            writer.AddNumber("mean", stage.GetMean());
+            writer.AddNumber("min", stage.GetMin());
+            writer.EndObject();
+        }
+        writer.EndObject();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.AddNumber("iterations", iterations);
+    writer.AddString("options", toolkitOptions);
+    writer.AddString("unit", "ms");
+    writer.AddString("version", vrv::GetVersion());
+    writer.EndObject();
+}
+
+void write_table(
+    const std::vector<FileResult> &results, const std::vector<bool> &enabled, bool breakdown, std::ostream &output)
+{
+    output << std::left << std::setw(48) << "file" << std::right << std::setw(6) << "pages";
+    for (int i = 0; i < (int)k_stages.size(); ++i) {
+        if (enabled.at(i)) output << std::setw(12) << k_stages.at(i);
+    }
+    output << std::endl;
+
+    std::vector<double> totals(k_stages.size(), 0.0);
+    output << std::fixed << std::setprecision(2);
+    for (const FileResult &result : results) {
+        std::string filename = result.m_filename;
+        if (filename.size() > 46) filename = "..." + filename.substr(filename.size() - 43);
+        output << std::left << std::setw(48) << filename << std::right << std::setw(6) << result.m_pageCount;
+        for (int i = 0; i < (int)k_stages.size(); ++i) {
+            if (!enabled.at(i)) continue;
+            if (!result.m_loaded) {
+                output << std::setw(12) << "-";
+                continue;
+            }
+            const double min = result.m_stages.at(i).GetMin();
+            output << std::setw(12) << min;
+            totals.at(i) += min;
+        }
+        output << std::endl;
+
+        if (!breakdown || !result.m_loaded) continue;
+        // One line per sub-stage, with its time in the column of its stage
+        for (int i = 0; i < (int)k_stages.size(); ++i) {
+            if (!enabled.at(i)) continue;
+            for (const auto &[subStage, subStageResult] : result.m_stages.at(i).m_breakdown) {
+                std::string name = "  " + k_stages.at(i) + "/" + subStage;
+                if (name.size() > 52) name = name.substr(0, 49) + "...";
+                output << std::left << std::setw(54) << name << std::right;
+                for (int j = 0; j < i; ++j) {
+                    if (enabled.at(j)) output << std::setw(12) << "";
+                }
+                output << std::setw(12) << subStageResult.GetMin() << std::endl;
+            }
+        }
+    }
+
+    output << std::left << std::setw(54) << "total (min, ms)" << std::right;
+    for (int i = 0; i < (int)k_stages.size(); ++i) {
+        if (enabled.at(i)) output << std::setw(12) << totals.at(i);
+    }
+    output << std::endl;
+}
+
+void display_usage()
+{
+    std::cout << "Usage: verovio-benchmark [options] file|directory..." << std::endl << std::endl;
+    std::cout << " -b, --breakdown         Display the time of the sub-stages of each stage" << std::endl;
+    std::cout << " -i, --iterations <i>    Number of measured iterations (default: 3)" << std::endl;
+    std::cout << " -w, --warmup <i>        Number of iterations run before measuring (default: 1)" << std::endl;
+    std::cout << " -o, --outfile <s>       Output file for the results as JSON" << std::endl;
+    std::cout << " -r, --resources <s>     Path to the directory with Verovio resources" << std::endl;
+    std::cout << " -s, --stages <s>        Comma-separated list of the stages to run after load" << std::endl;
+    std::cout << "                         (default: \"layout,svg,midi,timemap,mei\")" << std::endl;
+    std::cout << " -t, --options <s>       Toolkit options as a JSON object" << std::endl;
+    std::cout << " -h, --help              Display this message" << std::endl;
+}
+
+//----------------------------------------------------------------------------
+// main
+//----------------------------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+    int iterations = 3;
+    int warmup = 1;
+    bool breakdown = false;
+    std::string outfile;
+    std::string stages = "layout,svg,midi,timemap,mei";
+    std::string toolkitOptions = "{}";
+
+    vrv::Toolkit toolkit(false);
+    std::string resourcePath = toolkit.GetResourcePath();
+
+    static struct option long_options[] = { //
+        { "breakdown", no_argument, 0, 'b' }, //
+        { "help", no_argument, 0, 'h' }, //
+        { "iterations", required_argument, 0, 'i' }, //
+        { "outfile", required_argument, 0, 'o' }, //
+        { "resources", required_argument, 0, 'r' }, //
+        { "stages", required_argument, 0, 's' }, //
+        { "options", required_argument, 0, 't' }, //
+        { "warmup", required_argument, 0, 'w' }, //
+        { 0, 0, 0, 0 }
+    };
+
+    int c;
+    int option_index = 0;
+    while ((c = getopt_long(argc, argv, "bhi:o:r:s:t:w:", long_options, &option_index)) != -1) {
+        switch (c) {
+            case 'b': breakdown = true; break;
+            case 'i': iterations = std::max(1, atoi(optarg)); break;
+            case 'o': outfile = optarg; break;
+            case 'r': resourcePath = optarg; break;
+            case 's': stages = optarg; break;
+            case 't': toolkitOptions = optarg; break;
+            case 'w': warmup = std::max(0, atoi(optarg)); break;
+            case 'h': display_usage(); exit(0);
+            default: display_usage(); exit(1);
+        }
+    }
+
+    std::vector<std::string> files;
+    for (int i = optind; i < argc; ++i) {
+        if (is_dir(argv[i])) {
+            list_files(argv[i], files);
+        }
+        else {
+            files.push_back(argv[i]);
+        }
+    }
+    if (files.empty()) {
+        std::cerr << "Expected at least one input file or directory." << std::endl << std::endl;
+        display_usage();
+        exit(1);
+    }
+
+    if (!toolkit.SetResourcePath(resourcePath)) {
+        std::cerr << "The resources could not be loaded from " << resourcePath << "." << std::endl;
+        exit(1);
+    }
+    if (!toolkit.SetOptions(toolkitOptions)) {
+        std::cerr << "The toolkit options could not be set." << std::endl;
+        exit(1);
+    }
+    const std::string breaks = toolkit.GetOptionsObj()->m_breaks.GetStrValue();
+
+    // The load stage is always run
+    std::vector<bool> enabled(k_stages.size(), false);
+    enabled.at(0) = true;
+    std::istringstream stageStream(stages);
+    for (std::string stage; std::getline(stageStream, stage, ',');) {
+        auto it = std::find(k_stages.begin(), k_stages.end(), stage);
+        if (it == k_stages.end()) {
+            std::cerr << "Unknown stage '" << stage << "'." << std::endl;
+            exit(1);
+        }
+        enabled.at(it - k_stages.begin()) = true;
+    }
+
+    std::vector<FileResult> results;
+    for (const std::string &file : files) {
+        results.push_back(benchmark_file(toolkit, file, breaks, enabled, iterations, warmup));
+        if (!results.back().m_loaded) {
+            std::cerr << "The file '" << file << "' could not be loaded." << std::endl;
+        }
+    }
+
+    write_table(results, enabled, breakdown, std::cout);
+
+    if (!outfile.empty()) {
+        std::string json;
+        write_json(results, enabled, iterations, toolkitOptions, json);
+        std::ofstream outstream(outfile.c_str());
+        if (!outstream.is_open()) {
+            std::cerr << "Unable to write the results to " << outfile << "." << std::endl;
+            exit(1);
+        }
+        outstream << json;
+        std::cerr << "Results written to " << outfile << "." << std::endl;
+    }
+
+    return 0;
+}
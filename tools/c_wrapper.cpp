@@ -115,6 +115,13 @@ const char *vrvToolkit_getHumdrum(void *tkPtr)
     return buffer;
 }
 
+const char *vrvToolkit_convertCollection(void *tkPtr, const char *data, const char *options)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->ConvertCollection(data, options));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_convertHumdrumToHumdrum(void *tkPtr, const char *humdrumData)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -192,6 +199,13 @@ int vrvToolkit_getPageWithElement(void *tkPtr, const char *xmlId)
     return tk->GetPageWithElement(xmlId);
 }
 
+const char *vrvToolkit_getProfile(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetProfile());
+    return tk->GetCString();
+}
+
 double vrvToolkit_getTimeForElement(void *tkPtr, const char *xmlId)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -218,6 +232,12 @@ bool vrvToolkit_loadData(void *tkPtr, const char *data)
     return tk->LoadData(data);
 }
 
+bool vrvToolkit_loadDataBuffer(void *tkPtr, char *data, int length)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return tk->LoadDataBuffer(data, length);
+}
+
 bool vrvToolkit_loadZipDataBase64(void *tkPtr, const char *data)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -249,6 +269,20 @@ const char *vrvToolkit_renderData(void *tkPtr, const char *data, const char *opt
     return tk->GetCString();
 }
 
+const char *vrvToolkit_renderExcerptToSVG(void *tkPtr, const char *c_selection, int page_no)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->RenderExcerptToSVG(c_selection, page_no));
+    return tk->GetCString();
+}
+
+const char *vrvToolkit_renderExcerptsToSVG(void *tkPtr, const char *c_options)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->RenderExcerptsToSVG(c_options));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_renderToExpansionMap(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -277,6 +311,21 @@ const char *vrvToolkit_renderToSVG(void *tkPtr, int page_no, bool xmlDeclaration
     return tk->GetCString();
 }
 
+const char *vrvToolkit_renderToSVGRegion(
+    void *tkPtr, int page_no, int x, int y, int width, int height, bool xmlDeclaration)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->RenderToSVGRegion(page_no, x, y, width, height, xmlDeclaration));
+    return tk->GetCString();
+}
+
+const char *vrvToolkit_renderToSVGTiles(void *tkPtr, int page_no, const char *c_options)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->RenderToSVGTiles(page_no, c_options));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -284,6 +333,13 @@ const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options)
     return tk->GetCString();
 }
 
+const unsigned char *vrvToolkit_renderToTimemapBuffer(void *tkPtr, const char *c_options, int *length)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCBuffer(tk->RenderToTimemapBuffer(c_options));
+    return tk->GetCBuffer(length);
+}
+
 void vrvToolkit_resetOptions(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -28,6 +28,7 @@ const char *vrvToolkit_getElementAttr(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getElementsAtTime(void *tkPtr, int millisec);
 const char *vrvToolkit_getExpansionIdsForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getHumdrum(void *tkPtr);
+const char *vrvToolkit_convertCollection(void *tkPtr, const char *data, const char *options);
 const char *vrvToolkit_convertHumdrumToHumdrum(void *tkPtr, const char *humdrumData);
 const char *vrvToolkit_convertHumdrumToMIDI(void *tkPtr, const char *humdrumData);
 const char *vrvToolkit_convertMEIToHumdrum(void *tkPtr, const char *meiData);
@@ -39,19 +40,27 @@ const char *vrvToolkit_getOptions(void *tkPtr);
 const char *vrvToolkit_getOptionUsageString(void *tkPtr);
 int vrvToolkit_getPageCount(void *tkPtr);
 int vrvToolkit_getPageWithElement(void *tkPtr, const char *xmlId);
+const char *vrvToolkit_getProfile(void *tkPtr);
 double vrvToolkit_getTimeForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getVersion(void *tkPtr);
 bool vrvToolkit_loadData(void *tkPtr, const char *data);
+bool vrvToolkit_loadDataBuffer(void *tkPtr, char *data, int length);
 bool vrvToolkit_loadZipDataBase64(void *tkPtr, const char *data);
 bool vrvToolkit_loadZipDataBuffer(void *tkPtr, const unsigned char *data, int length);
 void vrvToolkit_redoLayout(void *tkPtr, const char *c_options);
 void vrvToolkit_redoPagePitchPosLayout(void *tkPtr);
 const char *vrvToolkit_renderData(void *tkPtr, const char *data, const char *options);
+const char *vrvToolkit_renderExcerptToSVG(void *tkPtr, const char *c_selection, int page_no);
+const char *vrvToolkit_renderExcerptsToSVG(void *tkPtr, const char *c_options);
 const char *vrvToolkit_renderToExpansionMap(void *tkPtr);
 const char *vrvToolkit_renderToMIDI(void *tkPtr, const char *c_options);
 const char *vrvToolkit_renderToPAE(void *tkPtr);
 const char *vrvToolkit_renderToSVG(void *tkPtr, int page_no, bool xmlDeclaration);
+const char *vrvToolkit_renderToSVGRegion(
+    void *tkPtr, int page_no, int x, int y, int width, int height, bool xmlDeclaration);
+const char *vrvToolkit_renderToSVGTiles(void *tkPtr, int page_no, const char *c_options);
 const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options);
+const unsigned char *vrvToolkit_renderToTimemapBuffer(void *tkPtr, const char *c_options, int *length);
 void vrvToolkit_resetOptions(void *tkPtr);
 void vrvToolkit_resetXmlIdSeed(void *tkPtr, int seed);
 bool vrvToolkit_select(void *tkPtr, const char *selection);
@@ -5,23 +5,29 @@
 // Copyright (c) Authors and others. All rights reserved.
 /////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
 
 #ifndef _WIN32
+#include <dirent.h>
 #include <getopt.h>
 #else
+#include "win_dirent.h"
 #include "win_getopt.h"
 #endif
 
 //----------------------------------------------------------------------------
 
 #include "options.h"
+#include "threadpool.h"
 #include "toolkit.h"
 #include "vrv.h"
 
@@ -58,6 +64,29 @@ bool dir_exists(std::string dir)
     }
 }
 
+bool file_exists(std::string file)
+{
+    struct stat st;
+    return ((stat(file.c_str(), &st) == 0) && (((st.st_mode) & S_IFMT) == S_IFREG));
+}
+
+// List the files of a directory (not recursively and without hidden files) in alphabetical order
+std::vector<std::string> list_files(std::string dir)
+{
+    std::vector<std::string> files;
+    DIR *dp = opendir(dir.c_str());
+    if (!dp) return files;
+    for (struct dirent *entry = readdir(dp); entry; entry = readdir(dp)) {
+        const std::string name = entry->d_name;
+        if (name.empty() || (name.at(0) == '.')) continue;
+        const std::string file = dir + "/" + name;
+        if (file_exists(file)) files.push_back(file);
+    }
+    closedir(dp);
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
 void display_version()
 {
     std::cout << "Verovio " << vrv::GetVersion() << std::endl;
@@ -72,17 +101,304 @@ bool optionExists(const std::string &option, int argc, char **argv, std::string
     return false;
 }
 
+// Write the output of a loaded file in a batch conversion
+bool write_batch_output(vrv::Toolkit &toolkit, const std::string &outfile, const std::string &outformat, int all_pages,
+    int page, bool remove_ids, std::vector<std::string> &written)
+{
+    if (outformat == "svg") {
+        const int from = (all_pages) ? 1 : page;
+        const int to = (all_pages) ? toolkit.GetPageCount() : page;
+        if ((from < 1) || (to > toolkit.GetPageCount())) return false;
+        for (int p = from; p <= to; ++p) {
+            std::string cur_outfile = outfile;
+            if (all_pages) cur_outfile += vrv::StringFormat("_%03d", p);
+            cur_outfile += ".svg";
+            if (!toolkit.RenderToSVGFile(cur_outfile, p)) return false;
+            written.push_back(cur_outfile);
+        }
+        return true;
+    }
+
+    std::string cur_outfile = outfile;
+    bool success = false;
+    if (outformat == "midi") {
+        cur_outfile += ".mid";
+        success = toolkit.RenderToMIDIFile(cur_outfile);
+    }
+    else if (outformat == "timemap") {
+        cur_outfile += ".json";
+        success = toolkit.RenderToTimemapFile(cur_outfile);
+    }
+    else if (outformat == "expansionmap") {
+        cur_outfile += "-em.json";
+        success = toolkit.RenderToExpansionMapFile(cur_outfile);
+    }
+    else if (outformat == "pae") {
+        cur_outfile += ".pae";
+        success = toolkit.RenderToPAEFile(cur_outfile);
+    }
+    else {
+        const char *scoreBased = (outformat == "mei-pb") ? "false" : "true";
+        const char *basic = (outformat == "mei-basic") ? "true" : "false";
+        const char *removeIds = (remove_ids) ? "true" : "false";
+        std::string params
+            = vrv::StringFormat("{'scoreBased': %s, 'basic': %s, 'removeIds': %s}", scoreBased, basic, removeIds);
+        if (!all_pages) {
+            params = vrv::StringFormat(
+                "{'scoreBased': %s, 'basic': %s, 'pageNo': %d, 'removeIds': %s}", scoreBased, basic, page, removeIds);
+        }
+        cur_outfile += ".mei";
+        success = toolkit.SaveFile(cur_outfile, params);
+    }
+    if (success) written.push_back(cur_outfile);
+    return success;
+}
+
+// Create a toolkit with the resource path and the options of the toolkit given as parameter, and the input format
+// This has to be done in the main thread since the resource path is thread local
+vrv::Toolkit *create_worker(vrv::Toolkit &toolkit, const std::string &input_from)
+{
+    vrv::Toolkit *worker = new vrv::Toolkit(false);
+    worker->SetResourcePath(toolkit.GetResourcePath());
+    worker->SetOptions(toolkit.GetOptions());
+    if (!input_from.empty()) worker->SetInputFrom(input_from);
+    return worker;
+}
+
+// Convert several input files with a pool of toolkits, one for each thread
+bool convert_batch(vrv::Toolkit &toolkit, const std::string &input_from, const std::vector<std::string> &infiles,
+    const std::string &outdir, const std::string &outformat, int all_pages, int page, int thread_count)
+{
+    if (thread_count <= 0) thread_count = vrv::ThreadPool::GetHardwareThreadCount();
+    thread_count = std::max(1, std::min(thread_count, (int)infiles.size()));
+
+    const vrv::Options *toolkitOptions = toolkit.GetOptionsObj();
+    const uint32_t seed = toolkitOptions->m_xmlIdSeed.GetValue();
+    const bool remove_ids = toolkitOptions->m_removeIds.GetValue();
+
+    std::vector<vrv::Toolkit *> toolkits;
+    for (int i = 0; i < thread_count; ++i) {
+        toolkits.push_back(create_worker(toolkit, input_from));
+    }
+
+    std::atomic<int> next(0);
+    std::atomic<int> failures(0);
+    std::mutex output_mutex;
+
+    {
+        vrv::ThreadPool threadPool(thread_count);
+        for (int i = 0; i < thread_count; ++i) {
+            threadPool.Enqueue([&, i]() {
+                vrv::Toolkit *worker = toolkits.at(i);
+                // Each toolkit takes the next file to convert
+                for (int j = next++; j < (int)infiles.size(); j = next++) {
+                    const std::string &infile = infiles.at(j);
+                    const std::string outfile = (outdir.empty()) ? removeExtension(infile)
+                                                                 : outdir + "/" + removeExtension(basename(infile));
+                    // Deterministic IDs are seeded for each file since the ID counter is thread local
+                    if (seed != 0) vrv::Object::SeedID(seed);
+                    std::vector<std::string> written;
+                    const bool loaded = worker->LoadFile(infile);
+                    const bool success = loaded
+                        && write_batch_output(*worker, outfile, outformat, all_pages, page, remove_ids, written);
+
+                    std::lock_guard<std::mutex> lock(output_mutex);
+                    for (const std::string &file : written) {
+                        std::cerr << "Output written to " << file << "." << std::endl;
+                    }
+                    if (!loaded) {
+                        std::cerr << "The file '" << infile << "' could not be opened." << std::endl;
+                    }
+                    else if (!success) {
+                        std::cerr << "Unable to write the output of '" << infile << "'." << std::endl;
+                    }
+                    if (!success) ++failures;
+                }
+            });
+        }
+        threadPool.Wait();
+    }
+
+    for (vrv::Toolkit *worker : toolkits) {
+        delete worker;
+    }
+
+    return (failures == 0);
+}
+
+// Serialize a JSON object on a single line
+// Newlines and tabs are escaped within jsonxx strings, so the remaining ones are only indentation
+std::string to_json_line(const jsonxx::Object &object)
+{
+    std::string json = object.json();
+    json.erase(std::remove_if(json.begin(), json.end(), [](char c) { return ((c == '\n') || (c == '\t')); }),
+        json.end());
+    return json;
+}
+
+// Process a request of the server mode and return the response
+// The options of the toolkit are reset to the base ones before applying the options of the request
+std::string process_request(
+    vrv::Toolkit &toolkit, const vrv::Options &base_options, std::string &loaded_font, const std::string &line)
+{
+    jsonxx::Object request;
+    jsonxx::Object response;
+
+    if (!request.parse(line)) {
+        response << "success" << false;
+        response << "error" << "The request is not a JSON object";
+        return to_json_line(response);
+    }
+
+    if (request.has<jsonxx::String>("id")) {
+        response << "id" << request.get<jsonxx::String>("id");
+    }
+    else if (request.has<jsonxx::Number>("id")) {
+        response << "id" << request.get<jsonxx::Number>("id");
+    }
+
+    jsonxx::Array outputs;
+    if (request.has<jsonxx::Array>("outputs")) outputs = request.get<jsonxx::Array>("outputs");
+    jsonxx::Object request_options;
+    if (request.has<jsonxx::Object>("options")) request_options = request.get<jsonxx::Object>("options");
+
+    // Skip the layout if only MIDI or timemap are requested, as for the command-line
+    bool needs_layout = false;
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        if (!outputs.has<jsonxx::String>(i)) continue;
+        const std::string output = outputs.get<jsonxx::String>(i);
+        if ((output != "midi") && (output != "timemap")) needs_layout = true;
+    }
+    if (!needs_layout && !request_options.has<jsonxx::String>("breaks")) request_options << "breaks" << "none";
+
+    // Reset the options without reloading the font unless the previous request changed it
+    vrv::Options *options = toolkit.GetOptionsObj();
+    *options = base_options;
+    if (!request_options.has<jsonxx::String>("font") && (options->m_font.GetValue() != loaded_font)) {
+        request_options << "font" << options->m_font.GetValue();
+    }
+    toolkit.SetOptions(request_options.json());
+    loaded_font = options->m_font.GetValue();
+
+    // Deterministic IDs are seeded for each request since the ID counter is thread local
+    const uint32_t seed = options->m_xmlIdSeed.GetValue();
+    if (seed != 0) vrv::Object::SeedID(seed);
+
+    bool loaded = false;
+    if (request.has<jsonxx::String>("input")) {
+        loaded = toolkit.LoadFile(request.get<jsonxx::String>("input"));
+    }
+    else if (request.has<jsonxx::String>("data")) {
+        loaded = toolkit.LoadData(request.get<jsonxx::String>("data"));
+    }
+    if (!loaded) {
+        response << "success" << false;
+        response << "error" << "The input could not be loaded";
+        return to_json_line(response);
+    }
+
+    bool success = true;
+    response << "pageCount" << toolkit.GetPageCount();
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        const std::string output = (outputs.has<jsonxx::String>(i)) ? outputs.get<jsonxx::String>(i) : "";
+        if (output == "svg") {
+            // All the pages unless one is given
+            int from = 1;
+            int to = toolkit.GetPageCount();
+            if (request.has<jsonxx::Number>("page")) {
+                from = to = request.get<jsonxx::Number>("page");
+            }
+            jsonxx::Array pages;
+            for (int page = from; page <= to; ++page) {
+                pages << toolkit.RenderToSVG(page);
+            }
+            response << "svg" << pages;
+        }
+        else if (output == "midi") {
+            response << "midi" << toolkit.RenderToMIDI();
+        }
+        else if (output == "mei") {
+            const std::string mei_options
+                = (request.has<jsonxx::Object>("mei")) ? request.get<jsonxx::Object>("mei").json() : "";
+            response << "mei" << toolkit.GetMEI(mei_options);
+        }
+        else if (output == "timemap") {
+            const std::string timemap_options
+                = (request.has<jsonxx::Object>("timemap")) ? request.get<jsonxx::Object>("timemap").json() : "";
+            jsonxx::Array timemap;
+            timemap.parse(toolkit.RenderToTimemap(timemap_options));
+            response << "timemap" << timemap;
+        }
+        else {
+            response << "error" << vrv::StringFormat("Unsupported output '%s'", output.c_str());
+            success = false;
+        }
+    }
+    response << "success" << success;
+
+    return to_json_line(response);
+}
+
+// Run the server mode with a pool of toolkits, one for each thread
+// Each thread reads the next request, processes it and writes the response on its own line
+void run_server(vrv::Toolkit &toolkit, const std::string &input_from, int thread_count)
+{
+    if (thread_count <= 0) thread_count = vrv::ThreadPool::GetHardwareThreadCount();
+
+    std::vector<vrv::Toolkit *> toolkits;
+    for (int i = 0; i < thread_count; ++i) {
+        toolkits.push_back(create_worker(toolkit, input_from));
+    }
+
+    std::mutex input_mutex;
+    std::mutex output_mutex;
+
+    {
+        vrv::ThreadPool threadPool(thread_count);
+        for (int i = 0; i < thread_count; ++i) {
+            threadPool.Enqueue([&, i]() {
+                vrv::Toolkit *worker = toolkits.at(i);
+                vrv::Options base_options;
+                base_options = *worker->GetOptionsObj();
+                std::string loaded_font = base_options.m_font.GetValue();
+
+                std::string line;
+                while (true) {
+                    {
+                        std::lock_guard<std::mutex> lock(input_mutex);
+                        if (!std::getline(std::cin, line)) break;
+                    }
+                    if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+
+                    const std::string response = process_request(*worker, base_options, loaded_font, line);
+
+                    std::lock_guard<std::mutex> lock(output_mutex);
+                    std::cout << response << std::endl;
+                }
+            });
+        }
+        threadPool.Wait();
+    }
+
+    for (vrv::Toolkit *worker : toolkits) {
+        delete worker;
+    }
+}
+
 int main(int argc, char **argv)
 {
     std::string infile;
     std::string svgdir;
     std::string outfile;
     std::string outformat = "svg";
+    std::string input_from;
     bool std_output = false;
 
     int all_pages = 0;
     int page = 1;
     int show_version = 0;
+    int thread_count = 1;
+    int server = 0;
 
     // Create the toolkit instance without loading the font because
     // the resource path might be specified in the parameters
@@ -103,6 +419,10 @@ int main(int argc, char **argv)
         { "xml-id-seed", required_argument, 0, 'x' }, //
         // standard input - long options only or - as filename
         { "stdin", no_argument, 0, 'z' }, //
+        // number of threads - long option only
+        { "threads", required_argument, 0, 'j' }, //
+        // server mode - long option only
+        { "server", no_argument, 0, 'y' }, //
         { 0, 0, 0, 0 }
     };
 
@@ -187,6 +507,14 @@ int main(int argc, char **argv)
                 if (!toolkit.SetInputFrom(std::string(optarg))) {
                     exit(1);
                 };
+                input_from = std::string(optarg);
+                break;
+
+            case 'j':
+                if (!options->m_threads.SetValue(optarg)) {
+                    vrv::LogWarning("Setting threads with %s failed, default value used", optarg);
+                }
+                thread_count = options->m_threads.GetValue();
                 break;
 
             case 'l': vrv::EnableLog(vrv::StrToLogLevel(std::string(optarg))); break;
@@ -210,6 +538,8 @@ int main(int argc, char **argv)
 
             case 'v': show_version = 1; break;
 
+            case 'y': server = 1; break;
+
             case 'x':
                 if (!options->m_xmlIdSeed.SetValue(optarg)) {
                     vrv::LogWarning("Setting xml id seed with %s failed, default value used", optarg);
@@ -248,8 +578,38 @@ int main(int argc, char **argv)
         toolkit.InitClock();
     }
 
+    if (server) {
+        if (!dir_exists(resourcePath) || !toolkit.SetResourcePath(resourcePath)) {
+            std::cerr << "The resource path " << resourcePath << " could not be loaded." << std::endl;
+            exit(1);
+        }
+        if (!toolkit.SetOptions(vrv::StringFormat("{\"font\": \"%s\" }", options->m_font.GetValue().c_str()))) {
+            std::cerr << "Font '" << options->m_font.GetValue() << "' could not be loaded." << std::endl;
+            exit(1);
+        }
+        run_server(toolkit, input_from, thread_count);
+        free(long_options);
+        return 0;
+    }
+
     std::cerr << infile;
-    if (optind <= argc - 1) {
+    // Several input files or a directory are converted in batch
+    std::vector<std::string> batch_infiles;
+    if (optind < argc - 1) {
+        batch_infiles.assign(argv + optind, argv + argc);
+    }
+    else if ((optind == argc - 1) && dir_exists(argv[optind])) {
+        batch_infiles = list_files(argv[optind]);
+        if (batch_infiles.empty()) {
+            std::cerr << "The directory " << argv[optind] << " does not contain any file." << std::endl;
+            exit(1);
+        }
+    }
+
+    if (!batch_infiles.empty()) {
+        infile = batch_infiles.front();
+    }
+    else if (optind <= argc - 1) {
         infile = std::string(argv[optind]);
     }
     else if (infile != "-") {
@@ -288,6 +648,26 @@ int main(int argc, char **argv)
         exit(1);
     }
 
+    if (!batch_infiles.empty()) {
+        // With several input files the output file is a directory
+        if ((outformat == "humdrum") || (outformat == "hum")) {
+            std::cerr << "Humdrum output is not supported for several input files." << std::endl;
+            exit(1);
+        }
+        if ((outfile == "-") || (!outfile.empty() && !dir_exists(outfile))) {
+            std::cerr << "The output has to be an existing directory for several input files." << std::endl;
+            exit(1);
+        }
+        // Skip the layout for MIDI and timemap output by setting --breaks to none
+        if ((outformat == "midi") || (outformat == "timemap") || (outformat == "expansionmap")) {
+            toolkit.SetOptions("{'breaks': 'none'}");
+        }
+        const bool success
+            = convert_batch(toolkit, input_from, batch_infiles, outfile, outformat, all_pages, page, thread_count);
+        free(long_options);
+        return (success) ? 0 : 1;
+    }
+
     // Make sure we provide a file name or output to std output with std input
     if ((infile == "-") && (outfile.empty())) {
         std::cerr << "Standard input can be used only with standard output or output filename." << std::endl;
@@ -350,7 +730,17 @@ int main(int argc, char **argv)
         to = toolkit.GetPageCount() + 1;
     }
 
-    if (outformat == "svg") {
+    if ((outformat == "svg") && all_pages && !std_output && (thread_count != 1)) {
+        // Render and write the pages concurrently
+        if (!toolkit.RenderToSVGFiles(outfile, from, to - 1, thread_count)) {
+            std::cerr << "Unable to write SVG to " << outfile << "_*.svg." << std::endl;
+            exit(1);
+        }
+        for (int p = from; p < to; ++p) {
+            std::cerr << "Output written to " << outfile << vrv::StringFormat("_%03d", p) << ".svg." << std::endl;
+        }
+    }
+    else if (outformat == "svg") {
         int p;
         for (p = from; p < to; ++p) {
             std::string cur_outfile = outfile;